@@ -0,0 +1,44 @@
+/**
+ * \file homesim/builtin_components.h
+ *
+ * \brief Registration of the built-in component library.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_BUILTIN_COMPONENTS_HEADER_GUARD
+# define HOMESIM_BUILTIN_COMPONENTS_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <homesim/component.h>
+
+namespace homesim {
+
+/**
+ * \brief Register every built-in part with the given component factory.
+ *
+ * The following component types are registered, with pins named as in the
+ * part's datasheet:
+ *
+ *  - and_gate, or_gate, nand_gate, nor_gate, xor_gate, xnor_gate: pins a, b,
+ *    and y.
+ *  - inverter, buffer: pins a and y.
+ *  - ic7400, ic7402, ic7404, ic7408, ic7432, ic7486, ic74173, ic74245: pins in
+ *    DIP package order, such as 1a, 1b, 1y.
+ *  - icrom: a 32K x 8 ROM with pins a0-a14, d0-d7, ce, and oe.  The ROM image
+ *    is loaded from the file given by config["image"].
+ *  - icram: a 32K x 8 RAM with pins a0-a14, d0-d7, ce, oe, and we.  The RAM is
+ *    optionally preloaded from the file given by config["image"].
+ *
+ * Every built-in part accepts config["propagation_delay"], in seconds.
+ *
+ * \param factory       The factory in which the parts are registered.
+ */
+void register_builtin_components(component_factory& factory);
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_BUILTIN_COMPONENTS_HEADER_GUARD*/
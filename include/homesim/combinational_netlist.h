@@ -0,0 +1,162 @@
+/**
+ * \file homesim/combinational_netlist.h
+ *
+ * \brief Declarations for combinational netlists and lookup-table synthesis.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_COMBINATIONAL_NETLIST_HEADER_GUARD
+# define HOMESIM_COMBINATIONAL_NETLIST_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <cstddef>
+#include <homesim/ic/lut.h>
+#include <homesim/wire.h>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace homesim {
+
+/**
+ * \brief The operation performed by a gate in a combinational netlist.
+ */
+enum lut_gate_op
+{
+    LUT_GATE_OP_BUFFER,
+    LUT_GATE_OP_INVERTER,
+    LUT_GATE_OP_AND,
+    LUT_GATE_OP_OR,
+    LUT_GATE_OP_NAND,
+    LUT_GATE_OP_NOR,
+    LUT_GATE_OP_XOR,
+    LUT_GATE_OP_XNOR
+};
+
+/**
+ * \brief A combinational netlist describes a cluster of gates, such as a
+ * decoder or a mux tree, before it is elaborated into components.
+ *
+ * Nodes are numbered in the order they are added, and a gate may only refer to
+ * nodes added before it, so the netlist is always acyclic.  When elaborated,
+ * the cone of each output is traced back to the netlist inputs.  Outputs whose
+ * cones have few enough inputs are grouped, their truth tables are computed by
+ * exhaustive evaluation, and each group becomes a single \ref iclut.  The
+ * internal nets of these cones are never created, so they cost no events.
+ * Outputs with larger cones fall back to individual gates.
+ */
+class combinational_netlist
+{
+public:
+
+    /**
+     * \brief Combinational netlist constructor.
+     */
+    combinational_netlist();
+
+    /* elaborated components capture internal wires, so it can't be copied. */
+    combinational_netlist(const combinational_netlist&) = delete;
+    combinational_netlist& operator=(const combinational_netlist&) = delete;
+
+    /**
+     * \brief Add an input to the netlist.
+     *
+     * \param w         The wire driving this input.
+     *
+     * \returns the node for this input.
+     */
+    int add_input(wire* w);
+
+    /**
+     * \brief Add a single input gate to the netlist.
+     *
+     * \param op        The gate operation; a buffer or an inverter.
+     * \param a         The input node.
+     * \param delay     The gate delay in seconds.
+     *
+     * \returns the node for the gate output.
+     */
+    int add_gate(lut_gate_op op, int a, double delay);
+
+    /**
+     * \brief Add a two input gate to the netlist.
+     *
+     * \param op        The gate operation.
+     * \param a         The first input node.
+     * \param b         The second input node.
+     * \param delay     The gate delay in seconds.
+     *
+     * \returns the node for the gate output.
+     */
+    int add_gate(lut_gate_op op, int a, int b, double delay);
+
+    /**
+     * \brief Drive an output wire from a node.
+     *
+     * \param node      The node driving this output.
+     * \param w         The output wire.
+     */
+    void add_output(int node, wire* w);
+
+    /**
+     * \brief Elaborate the netlist into components.
+     *
+     * The delay of each lookup table is the longest path delay of the cones it
+     * replaces.  A netlist can only be elaborated once.
+     *
+     * \param max_inputs    The maximum number of inputs for a lookup table.
+     */
+    void elaborate(unsigned int max_inputs = lut_max_inputs);
+
+    /**
+     * \brief Return the number of lookup tables created by elaboration.
+     */
+    std::size_t luts() const;
+
+    /**
+     * \brief Return the number of fallback gates created by elaboration.
+     */
+    std::size_t fallback_gates() const;
+
+private:
+    struct node
+    {
+        lut_gate_op op;
+        int a;
+        int b;
+        double delay;
+        wire* input;
+    };
+
+    std::vector<node> nodes;
+    std::vector<std::pair<int, wire*>> outputs;
+    bool elaborated;
+    std::vector<std::shared_ptr<iclut>> lut_list;
+    std::vector<std::shared_ptr<void>> gate_list;
+    std::vector<std::shared_ptr<wire>> internal_wires;
+
+    /**
+     * \brief Mark every node in the cone of the given node.
+     *
+     * \param n         The root of the cone.
+     * \param in_cone   Set to true for each node in the cone.
+     */
+    void mark_cone(int n, std::vector<bool>& in_cone) const;
+
+    /**
+     * \brief Instantiate the gates for a node that can't be collapsed.
+     *
+     * \param n         The node to instantiate.
+     * \param node_wire The wire for each node instantiated so far.
+     * \param outp      The wire to drive, or nullptr for an internal wire.
+     */
+    void instantiate(int n, std::vector<wire*>& node_wire, wire* outp);
+};
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_COMBINATIONAL_NETLIST_HEADER_GUARD*/
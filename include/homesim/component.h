@@ -13,9 +13,15 @@
 # error This file requires C++14 or greater.
 #endif
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <homesim/config_value.h>
 #include <homesim/wire.h>
+#include <initializer_list>
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -69,6 +75,106 @@ public:
     }
 };
 
+/**
+ * \brief The invalid config error is thrown when a component is given a
+ * configuration key or value it does not understand.
+ */
+class invalid_config_error : public std::runtime_error
+{
+public:
+    invalid_config_error(const std::string& what)
+        : runtime_error(what)
+    {
+    }
+};
+
+/**
+ * \brief The component pin table maps the pin names of a component type to
+ * dense pin indices.
+ *
+ * A component type builds its pin table once and shares it between all of its
+ * instances, so pin names are only resolved at analysis time.  Names are found
+ * with a perfect hash built when the table is constructed, so a lookup costs
+ * one hash and one string comparison.
+ */
+class component_pin_table
+{
+public:
+
+    /**
+     * \brief Constructor for a component pin table.
+     *
+     * \param pins      Initializer list of pins, in pin index order.
+     *
+     * \throws \ref invalid_pin_error if a pin name is repeated.
+     */
+    component_pin_table(std::initializer_list<std::string> pins);
+
+    /**
+     * \brief Constructor for a component pin table.
+     *
+     * \param pins      Vector of pins, in pin index order.
+     *
+     * \throws \ref invalid_pin_error if a pin name is repeated.
+     */
+    component_pin_table(const std::vector<std::string>& pins);
+
+    /**
+     * \brief Get the shared pin table for a list of pins.
+     *
+     * Components that list their pins at construction share a single table
+     * per distinct pin list.  Interned tables live for the whole process.
+     *
+     * \param pins      Initializer list of pins, in pin index order.
+     */
+    static const component_pin_table& intern(
+        std::initializer_list<std::string> pins);
+
+    /**
+     * \brief Get the number of pins in this table.
+     */
+    int size() const;
+
+    /**
+     * \brief Get the pin name for the given index.
+     *
+     * \param index     The index of the pin name to get.
+     */
+    const std::string& name(int index) const;
+
+    /**
+     * \brief Find the index of a pin by name.
+     *
+     * \param name      The name of the pin to find.
+     *
+     * \returns the pin index, or -1 if there is no such pin.
+     */
+    int find(const std::string& name) const;
+
+private:
+    std::vector<std::string> names;
+    std::vector<std::uint32_t> seeds;
+    std::vector<int> slots;
+    std::uint32_t slot_mask;
+
+    /**
+     * \brief Hash a pin name with the given seed.
+     *
+     * \param name      The pin name to hash.
+     * \param seed      The seed for this hash.
+     */
+    static std::uint32_t hash(const std::string& name, std::uint32_t seed);
+
+    /**
+     * \brief Attempt to build the perfect hash with the given slot count.
+     *
+     * \param slot_count    The number of slots, a power of two.
+     *
+     * \returns true if every pin found a slot.
+     */
+    bool build_hash(std::size_t slot_count);
+};
+
 /**
  * \brief The component abstraction allows gates and components to be treated
  * generically.
@@ -77,6 +183,8 @@ class component
 {
 public:
 
+    virtual ~component() { }
+
     /**
      * \brief Set a pin to the given wire.
      *
@@ -89,6 +197,27 @@ public:
      */
     void set_pin(const std::string& name, wire* w);
 
+    /**
+     * \brief Set a pin, by index, to the given wire.
+     *
+     * \param index     The index of the pin to set.
+     * \param w         The wire to set.
+     *
+     * \throws
+     *      - \ref invalid_pin_error if the pin index is invalid.
+     *      - \ref pin_binding_error if the pin is already bound.
+     */
+    void set_pin(int index, wire* w);
+
+    /**
+     * \brief Get the index of a pin by name.
+     *
+     * \param name      The name of the pin.
+     *
+     * \returns the pin index, or -1 if there is no such pin.
+     */
+    int pin_index(const std::string& name) const;
+
     /**
      * \brief Get the number of pins for this component.
      */
@@ -101,11 +230,62 @@ public:
      */
     const std::string& pin_name(int index) const;
 
+    /**
+     * \brief Configure this component.
+     *
+     * By default, components have no configuration.
+     *
+     * \param key       The configuration key.
+     * \param value     The evaluated configuration value.
+     *
+     * \throws \ref invalid_config_error if the key or value is invalid.
+     */
+    virtual void configure(const std::string& key, const std::string& value);
+
+    /**
+     * \brief Configure this component with a typed value.
+     *
+     * By default, the value is formatted as a string and passed to the
+     * string overload, so components only need to accept typed values where
+     * it saves parsing.
+     *
+     * \param key       The configuration key.
+     * \param value     The folded configuration value.
+     *
+     * \throws \ref invalid_config_error if the key or value is invalid.
+     */
+    virtual void configure(const std::string& key, const config_value& value);
+
     /**
      * \brief Build the component instance.
      */
     virtual void build() = 0;
 
+    /**
+     * \brief Get the wire for a pin.
+     *
+     * \param pin_name  The name of the pin to get.
+     *
+     * \throws \ref missing_wire_error if the wire is missing.
+     */
+    wire* get_wire(const std::string& pin_name);
+
+    /**
+     * \brief Get the wire for a pin by index.
+     *
+     * \param index     The index of the pin to get.
+     *
+     * \throws \ref missing_wire_error if the wire is missing.
+     */
+    wire* get_wire(int index);
+
+    /**
+     * \brief Is a wire bound to the given pin?
+     *
+     * \param index     The index of the pin.
+     */
+    bool is_bound(int index) const;
+
 protected:
 
     /**
@@ -116,17 +296,16 @@ protected:
     component(std::initializer_list<std::string> pins);
 
     /**
-     * \brief Get the wire for a pin.
-     *
-     * \param pin_name  The name of the pin to get.
+     * \brief Constructor for component with a shared pin table.
      *
-     * \throws \ref missing_wire_error if the wire is missing.
+     * \param table     The pin table for this component type, which must
+     *                  outlive this instance.
      */
-    wire* get_wire(const std::string& pin_name);
+    component(const component_pin_table& table);
 
 private:
-    std::map<std::string, wire*> pin_map;
-    std::vector<std::string> pin_name_array;
+    const component_pin_table* table;
+    std::vector<wire*> pin_wires;
 };
 
 /**
@@ -160,9 +339,42 @@ public:
      */
     std::shared_ptr<component> create(const std::string& type);
 
+    /**
+     * \brief Register a component constructor that allocates from an arena.
+     *
+     * \param type      The type of the component to register.
+     * \param ctor      The arena component constructor function to register.
+     */
+    void register_arena_component(
+        const std::string& type,
+        std::function<std::shared_ptr<component> (netlist_arena&)> ctor);
+
+    /**
+     * \brief Create a component by type, allocating it from an arena if the
+     * type supports it.
+     *
+     * \param type      The name of the component to create.
+     * \param arena     The arena for this component, which must outlive it.
+     *
+     * \throws \ref unknown_component_error if the component type is unknown.
+     */
+    std::shared_ptr<component> create(
+        const std::string& type, netlist_arena& arena);
+
+    /**
+     * \brief Check whether a component type is registered.
+     *
+     * \param type      The name of the component type.
+     */
+    bool contains(const std::string& type) const;
+
 private:
     std::map<std::string, std::function<std::shared_ptr<component> ()>>
     component_map;
+    std::map<
+        std::string,
+        std::function<std::shared_ptr<component> (netlist_arena&)>>
+    arena_component_map;
 };
 
 } /* namespace homesim */
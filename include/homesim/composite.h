@@ -0,0 +1,240 @@
+/**
+ * \file homesim/composite.h
+ *
+ * \brief Declarations for hierarchical composite components.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_COMPOSITE_HEADER_GUARD
+# define HOMESIM_COMPOSITE_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <cstddef>
+#include <homesim/component.h>
+#include <homesim/netlist_arena.h>
+#include <homesim/wire.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace homesim {
+
+/**
+ * \brief The hierarchy names table maps flattened wires and components back to
+ * their hierarchical names.
+ *
+ * Flattened netlists don't need names to simulate, so names are only recorded
+ * when a caller asks for them, in this side table, and never in the wires or
+ * components themselves.
+ */
+class hierarchy_names
+{
+public:
+
+    /**
+     * \brief Record the hierarchical name of an object.
+     *
+     * \param object    The wire or component.
+     * \param path      The hierarchical name, such as "cpu.a.reg".
+     */
+    void add(const void* object, const std::string& path);
+
+    /**
+     * \brief Find the hierarchical name of an object.
+     *
+     * \param object    The wire or component.
+     *
+     * \returns the name of this object, or an empty string if it has none.
+     */
+    std::string find(const void* object) const;
+
+    /**
+     * \brief Return the number of names recorded.
+     */
+    std::size_t size() const;
+
+private:
+    std::unordered_map<const void*, std::string> names;
+};
+
+/**
+ * \brief A composite definition describes a component built from
+ * sub-components.
+ *
+ * The definition lists the children, the nets that connect their pins, and
+ * which nets are exported as the pins of the composite.  Child pins are
+ * resolved to pin indices when they are connected, so instances are wired
+ * without any string lookups.  Once built, a definition is shared, immutable,
+ * by every instance of the composite, so memory scales with the number of
+ * unique definitions rather than the number of instances.
+ */
+class composite_definition
+{
+public:
+
+    /**
+     * \brief Composite definition constructor.
+     *
+     * \param factory   The factory used to create the children.  This must
+     *                  outlive the definition and its instances.
+     */
+    explicit composite_definition(component_factory& factory);
+
+    /**
+     * \brief Add a child component.
+     *
+     * \param name      The name of the child within this composite.
+     * \param type      The component type of the child.
+     *
+     * \returns the index of the child.
+     *
+     * \throws \ref unknown_component_error if the type is unknown.
+     */
+    int add_child(const std::string& name, const std::string& type);
+
+    /**
+     * \brief Configure a child component.
+     *
+     * \param child     The index of the child.
+     * \param key       The configuration key.
+     * \param value     The configuration value.
+     */
+    void configure_child(
+        int child, const std::string& key, const std::string& value);
+
+    /**
+     * \brief Add a net.
+     *
+     * \param name      The name of the net within this composite.
+     * \param exported  If true, this net is also a pin of the composite.
+     *
+     * \returns the index of the net.
+     */
+    int add_net(const std::string& name, bool exported);
+
+    /**
+     * \brief Connect a child pin to a net.
+     *
+     * \param net       The index of the net.
+     * \param child     The index of the child.
+     * \param pin       The name of the child pin.
+     *
+     * \throws \ref invalid_pin_error if the child has no such pin.
+     */
+    void connect(int net, int child, const std::string& pin);
+
+    /**
+     * \brief Get the pin table of the composite, which lists its exported
+     * nets.  The table is built once, on first use, after every net has been
+     * added.
+     *
+     * \throws \ref invalid_pin_error if two exported nets share a name.
+     */
+    const component_pin_table& pin_table() const;
+
+    /**
+     * \brief Create an unbound instance of this composite.
+     *
+     * \param def       The shared definition.
+     * \param arena     The arena for the instance and its children, or
+     *                  nullptr to use the heap.
+     */
+    static std::shared_ptr<component> instantiate(
+        std::shared_ptr<const composite_definition> def,
+        netlist_arena* arena = nullptr);
+
+private:
+    friend class composite_component;
+
+    struct child
+    {
+        std::string name;
+        std::string type;
+        std::vector<std::pair<std::string, std::string>> config;
+    };
+
+    struct net
+    {
+        std::string name;
+        int port;
+        std::vector<std::pair<int, int>> pins;
+    };
+
+    component_factory* factory;
+    std::vector<child> children;
+    std::vector<net> nets;
+    std::vector<std::string> ports;
+    /* built from the ports on first use; instances may be created from
+     * several threads. */
+    mutable std::mutex pins_lock;
+    mutable std::unique_ptr<component_pin_table> pins;
+
+    /* unbuilt children, only used to resolve pin names while defining. */
+    std::vector<std::shared_ptr<component>> prototypes;
+};
+
+/**
+ * \brief A composite component is an instance of a composite definition.
+ *
+ * Building a composite flattens it: each child is created, wired to the
+ * internal nets or to the wires bound to the composite's pins, and built in
+ * turn.  Once built, no trace of the hierarchy remains on the simulation path.
+ */
+class composite_component : public component
+{
+public:
+
+    /**
+     * \brief Composite component constructor.
+     *
+     * \param def       The shared definition.
+     * \param arena     The arena for the children, or nullptr for the heap.
+     */
+    composite_component(
+        std::shared_ptr<const composite_definition> def, netlist_arena* arena);
+
+    /**
+     * \brief Record hierarchical names for this instance when it is built.
+     *
+     * \param names     The side table for the names.
+     * \param path      The hierarchical name of this instance.
+     */
+    void set_hierarchy(hierarchy_names* names, const std::string& path);
+
+    /**
+     * \brief Flatten this composite into its children and build them.
+     */
+    virtual void build() override;
+
+private:
+    std::shared_ptr<const composite_definition> def;
+    netlist_arena* arena;
+    hierarchy_names* names;
+    std::string path;
+    bool built;
+    std::vector<wire*> net_wires;
+    std::vector<std::unique_ptr<wire>> heap_wires;
+    std::vector<std::shared_ptr<component>> children;
+};
+
+/**
+ * \brief Register a composite definition as a component type.
+ *
+ * \param factory   The factory in which the composite is registered.
+ * \param type      The component type name for the composite.
+ * \param def       The shared definition.
+ */
+void register_composite(
+    component_factory& factory, const std::string& type,
+    std::shared_ptr<const composite_definition> def);
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_COMPOSITE_HEADER_GUARD*/
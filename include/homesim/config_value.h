@@ -0,0 +1,101 @@
+/**
+ * \file homesim/config_value.h
+ *
+ * \brief Declarations for typed configuration values.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_CONFIG_VALUE_HEADER_GUARD
+# define HOMESIM_CONFIG_VALUE_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace homesim {
+
+/**
+ * \brief This exception is thrown when a configuration value is malformed or
+ * has the wrong type.
+ */
+class config_value_error : public std::runtime_error
+{
+public:
+    config_value_error(const std::string& what)
+        : runtime_error(what)
+    {
+    }
+};
+
+/**
+ * \brief The type of a configuration value.
+ */
+enum config_value_type
+{
+    CONFIG_VALUE_NUMBER,
+    CONFIG_VALUE_TIME,
+    CONFIG_VALUE_BOOLEAN,
+    CONFIG_VALUE_STRING,
+    CONFIG_VALUE_IDENTIFIER
+};
+
+/**
+ * \brief A configuration value, folded from its expression when the module is
+ * parsed.
+ *
+ * Only the field for the value's type is meaningful.  A time is an integer
+ * count of ticks, and a string keeps its quotes, as written in the source.
+ */
+struct config_value
+{
+    config_value_type type;
+    double number;
+    std::int64_t ticks;
+    bool boolean;
+    std::string text;
+
+    /**
+     * \brief Get this value in seconds.
+     *
+     * \returns the value of a time, or of a plain number taken as seconds.
+     *
+     * \throws a \ref config_value_error if this value is not numeric.
+     */
+    double seconds() const;
+
+    /**
+     * \brief Format this value as a string.
+     *
+     * Times are formatted in seconds.
+     */
+    std::string str() const;
+};
+
+/**
+ * \brief Parse a number, without allocating or consulting the locale.
+ *
+ * \param begin         The start of the text.
+ * \param end           One past the end of the text.
+ * \param out           Set to the number on success.
+ *
+ * \returns true if the whole text, ignoring surrounding blanks, is a number.
+ */
+bool config_parse_number(const char* begin, const char* end, double& out);
+
+/**
+ * \brief Format a number in its shortest form that reads back exactly.
+ *
+ * \param x             The number to format.
+ *
+ * \returns the formatted number.
+ */
+std::string config_format_number(double x);
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_CONFIG_VALUE_HEADER_GUARD*/
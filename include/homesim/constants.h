@@ -14,6 +14,8 @@
 # error This file requires C++14 or greater.
 #endif
 
+#include <cstdint>
+
 namespace homesim {
 
 /**
@@ -36,6 +38,27 @@ constexpr double milliseconds_to_seconds_scale = 1.0 / 1000.0;
  */
 constexpr double kohms_to_ohms_scale = 1000.0;
 
+/**
+ * \brief The number of ticks in a second.  Folded time values are stored as
+ * an integer count of ticks, which are picoseconds.
+ */
+constexpr std::int64_t ticks_per_second = 1000000000000;
+
+/**
+ * \brief The number of ticks in a nanosecond.
+ */
+constexpr std::int64_t nanoseconds_to_ticks_scale = 1000;
+
+/**
+ * \brief The number of ticks in a microsecond.
+ */
+constexpr std::int64_t microseconds_to_ticks_scale = 1000000;
+
+/**
+ * \brief The number of ticks in a millisecond.
+ */
+constexpr std::int64_t milliseconds_to_ticks_scale = 1000000000;
+
 } /* namespace homesim */
 
 #endif /*HOMESIM_CONSTANTS_HEADER_GUARD*/
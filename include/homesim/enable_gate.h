@@ -0,0 +1,83 @@
+/**
+ * \file homesim/enable_gate.h
+ *
+ * \brief Declarations for sleeping deselected components.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_ENABLE_GATE_HEADER_GUARD
+# define HOMESIM_ENABLE_GATE_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <functional>
+#include <homesim/wire.h>
+#include <initializer_list>
+#include <vector>
+
+namespace homesim {
+
+/**
+ * \brief The enable gate puts a component to sleep while it is deselected.
+ *
+ * A component declares its active low enable pins with an enable gate, and
+ * subscribes to its data inputs through the gate instead of directly on the
+ * wire.  While any enable pin is high, the component is asleep, and data input
+ * changes are dropped before they can schedule any events.  When every enable
+ * pin goes low again, the wake action runs once so the component can catch up
+ * on any inputs that changed while it slept.
+ *
+ * The enable gate must be constructed before the component subscribes to its
+ * enable pins, so that the wake action runs before the component reacts to
+ * being enabled.
+ */
+class enable_gate
+{
+public:
+
+    /**
+     * \brief Enable gate constructor.
+     *
+     * \param enables   The active low enable pins for the component.
+     * \param wake      The catch-up action to run when the component wakes,
+     *                  if any inputs changed while it was asleep.
+     */
+    enable_gate(
+        std::initializer_list<wire*> enables,
+        std::function<void ()> wake = nullptr);
+
+    /* the enable actions capture this instance, so it can't be copied. */
+    enable_gate(const enable_gate&) = delete;
+    enable_gate& operator=(const enable_gate&) = delete;
+
+    /**
+     * \brief Subscribe to a data input, suspending the action while asleep.
+     *
+     * \param w         The data input wire.
+     * \param action    The action to run on input change while awake.
+     */
+    void add_action(wire* w, std::function<void ()> action);
+
+    /**
+     * \brief Return true if every enable pin is low.
+     */
+    bool awake() const;
+
+private:
+    std::vector<wire*> enables;
+    std::function<void ()> wake;
+    bool is_awake;
+    bool missed;
+
+    /**
+     * \brief Re-evaluate the enable pins, waking the component if needed.
+     */
+    void update();
+};
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_ENABLE_GATE_HEADER_GUARD*/
@@ -13,18 +13,24 @@
 # error This file requires C++14 or greater.
 #endif
 
+#include <map>
 #include <memory>
+#include <string>
 
 namespace homesim {
 
 class component_factory;
+class composite_definition;
 
 class environment
 {
 public:
 
     /**
-     * \brief Construct an empty environment.
+     * \brief Construct a default environment.
+     *
+     * The component factory of a default environment holds the built-in
+     * parts; see \ref register_builtin_components.
      */
     environment();
 
@@ -33,8 +39,48 @@ public:
      */
     component_factory& get_component_factory();
 
+    /**
+     * \brief Find a module imported into this environment.
+     *
+     * \param path      The canonical path of the module file.
+     *
+     * \returns the shared definition of the module, or nullptr if it has not
+     * been imported.
+     */
+    std::shared_ptr<const composite_definition> find_import(
+        const std::string& path) const;
+
+    /**
+     * \brief Record a module imported into this environment, so that later
+     * imports of the same file share its definition.
+     *
+     * \param path      The canonical path of the module file.
+     * \param def       The definition of the module.
+     */
+    void add_import(
+        const std::string& path,
+        std::shared_ptr<const composite_definition> def);
+
+    /**
+     * \brief Set the number of worker threads used to parse and analyze
+     * imported modules.
+     *
+     * \param count     The number of workers, or zero for one per hardware
+     *                  thread.
+     */
+    void set_worker_count(unsigned count);
+
+    /**
+     * \brief Get the number of worker threads used to parse and analyze
+     * imported modules, or zero for one per hardware thread.
+     */
+    unsigned get_worker_count() const;
+
 private:
     std::shared_ptr<component_factory> cf;
+    std::map<std::string, std::shared_ptr<const composite_definition>>
+    imports;
+    unsigned workers;
 };
 
 } /* namespace homesim */
@@ -0,0 +1,469 @@
+/**
+ * \file homesim/flat_ast.h
+ *
+ * \brief Declarations for the flat AST and its symbol table.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_FLAT_AST_HEADER_GUARD
+# define HOMESIM_FLAT_AST_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <homesim/config_value.h>
+#include <homesim/parser.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace homesim {
+
+/**
+ * \brief The symbol table interns names, giving each distinct name a dense
+ * integer id.
+ *
+ * The text of every name is stored once, in a single character pool.
+ */
+class symbol_table
+{
+public:
+
+    /**
+     * \brief Create an empty symbol table.
+     */
+    symbol_table();
+
+    /**
+     * \brief Intern the given name.
+     *
+     * \param begin         The start of the name.
+     * \param end           One past the end of the name.
+     *
+     * \returns the id of the name.
+     */
+    int intern(const char* begin, const char* end);
+
+    /**
+     * \brief Intern the given name.
+     *
+     * \param name          The name to intern.
+     *
+     * \returns the id of the name.
+     */
+    int intern(const std::string& name);
+
+    /**
+     * \brief Find the id of a name, without interning it.
+     *
+     * \param name          The name to find.
+     *
+     * \returns the id of the name, or -1 if it has not been interned.
+     */
+    int find(const std::string& name) const;
+
+    /**
+     * \brief Get the name for the given id.
+     *
+     * \param id            The id of the name.
+     *
+     * \returns the name.
+     */
+    std::string str(int id) const;
+
+    /**
+     * \brief Get the number of interned names.
+     */
+    int size() const;
+
+private:
+    std::vector<char> pool;
+    std::vector<size_t> offsets;
+    std::vector<size_t> lengths;
+    std::vector<int> slots;
+
+    int lookup(const char* name, size_t length, size_t hash) const;
+    void rehash();
+    static size_t hash(const char* name, size_t length);
+};
+
+/**
+ * \brief A configuration or step expression.
+ *
+ * A simple expression has no functor, and its value is the token text.  A
+ * complex expression applies its functor to a single argument.  Every
+ * expression is folded to a typed value when it is parsed; the folded number
+ * or tick count is kept alongside the source text.
+ */
+struct flat_ast_expression
+{
+    token ty;
+    int value;
+    int functor;
+    config_value_type folded;
+    double number;
+    std::int64_t ticks;
+};
+
+/**
+ * \brief A configuration entry of a component.
+ */
+struct flat_ast_config
+{
+    int key;
+    int expression;
+};
+
+/**
+ * \brief A component, or the pullup / pulldown of a wire.
+ *
+ * A component array, such as reg[16], has a count; its elements are named
+ * reg[0] through reg[15].  A scalar component has a count of zero.
+ */
+struct flat_ast_component
+{
+    int name;
+    int type;
+    int first_config;
+    int config_count;
+    int count;
+};
+
+/**
+ * \brief A connection from a wire to a component pin.
+ *
+ * The component may be indexed, as in reg[3], or ranged, as in reg[0:7].  The
+ * pin may also be ranged, as in pin["d"][0:7], which names pins d0 through
+ * d7.  Unset indices are -1.  A range may run down as well as up.
+ */
+struct flat_ast_connection
+{
+    int component;
+    int pin;
+    int first;
+    int last;
+    int pin_first;
+    int pin_last;
+};
+
+/**
+ * \brief A wire and its connections.
+ *
+ * A wire array, such as bus[8], has a count; its elements are named bus[0]
+ * through bus[7].  A scalar wire has a count of zero.  Each connection of a
+ * wire array must be as wide as the array, and element i of the wire binds to
+ * element i of the connection.  A ranged connection on a scalar wire binds
+ * every element to the one wire.
+ */
+struct flat_ast_wire
+{
+    int name;
+    bool exported;
+    bool external_source;
+    int first_connection;
+    int connection_count;
+    int pull;
+    int count;
+};
+
+/**
+ * \brief A signal or state probe.
+ */
+struct flat_ast_probe
+{
+    int name;
+    int type;
+    int sub_type;
+    int first_wire_ref;
+    int wire_ref_count;
+};
+
+/**
+ * \brief A scenario and its executions.
+ */
+struct flat_ast_scenario
+{
+    int name;
+    int first_execution;
+    int execution_count;
+};
+
+/**
+ * \brief An execution and its steps.
+ *
+ * The step range includes the bodies of repeat blocks, so step_count is the
+ * total number of steps in the execution.
+ */
+struct flat_ast_execution
+{
+    int name;
+    int first_step;
+    int step_count;
+};
+
+/**
+ * \brief A step, with its pin assignments and assertions.
+ *
+ * A repeat block is a step whose expression is its repeat count.  Its body is
+ * the body_count steps that follow it, which may include nested repeat
+ * blocks.  The body is stored once, however many times it is run.
+ */
+struct flat_ast_step
+{
+    int type;
+    int expression;
+    int first_pin_assignment;
+    int pin_assignment_count;
+    int first_assertion;
+    int assertion_count;
+    int body_count;
+};
+
+/**
+ * \brief The assignment of a value to a component pin in a step.
+ */
+struct flat_ast_pin_assignment
+{
+    int component;
+    int element;
+    int pin;
+    int expression;
+};
+
+/**
+ * \brief An assertion or expectation on a wire signal in a step.
+ */
+struct flat_ast_assertion
+{
+    int type;
+    int wire;
+    int element;
+    int expression;
+};
+
+/**
+ * \brief The flat AST holds a module as flat vectors of nodes.
+ *
+ * Nodes refer to each other by index, and to names by symbol id.  The
+ * children of a node are contiguous, so each parent records the index of its
+ * first child and a count.  Unset references are -1.  Nodes appear in source
+ * order, including duplicates, which are left for semantic analysis to
+ * reject.
+ */
+struct flat_module
+{
+    /**
+     * \brief Create an empty flat module.
+     */
+    flat_module();
+
+    /**
+     * \brief Get the type of an expression.
+     *
+     * \param expression    The index of the expression.
+     *
+     * \returns the token type of the expression's value.
+     */
+    token type(int expression) const;
+
+    /**
+     * \brief Evaluate an expression.
+     *
+     * \param expression    The index of the expression.
+     *
+     * \returns the string value of the expression.
+     */
+    std::string eval(int expression) const;
+
+    /**
+     * \brief Get the folded value of an expression.
+     *
+     * \param expression    The index of the expression.
+     *
+     * \returns the typed value of the expression.
+     */
+    config_value value(int expression) const;
+
+    /**
+     * \brief Get the name of an element of a component or wire.
+     *
+     * \param name          The symbol id of the component or wire name.
+     * \param count         The array count, or zero for a scalar.
+     * \param element       The element index, ignored for a scalar.
+     *
+     * \returns the name, with its index if this is an array.
+     */
+    std::string element_name(int name, int count, int element) const;
+
+    /**
+     * \brief Get the number of component pins that a connection names.
+     *
+     * \param connection    The index of the connection.
+     */
+    int connection_width(int connection) const;
+
+    /**
+     * \brief Get the component and pin names for an element of a connection.
+     *
+     * \param connection    The index of the connection.
+     * \param element       The element, from zero to the connection width.
+     * \param component     Set to the component name.
+     * \param pin           Set to the pin name.
+     */
+    void connection_target(
+        int connection, int element, std::string& component,
+        std::string& pin) const;
+
+    /**
+     * \brief Get the component array index for an element of a connection.
+     *
+     * \param connection    The index of the connection.
+     * \param element       The element, from zero to the connection width.
+     *
+     * \returns the index into the component array, or -1 if the connection
+     * names a scalar component.
+     */
+    int connection_element(int connection, int element) const;
+
+    /**
+     * \brief Get the pin name for an element of a connection.
+     *
+     * \param connection    The index of the connection.
+     * \param element       The element, from zero to the connection width.
+     *
+     * \returns the pin name.
+     */
+    std::string connection_pin(int connection, int element) const;
+
+    /**
+     * \brief Get an element of an index range.  A single index names the
+     * same element for every element of a connection.
+     *
+     * \param first         The first index of the range.
+     * \param last          The last index of the range.
+     * \param element       The element, from zero to the range width.
+     *
+     * \returns the index.
+     */
+    static int range_element(int first, int last, int element);
+
+    symbol_table symbols;
+    int name;
+    /* the symbol ids of the paths of imported module files. */
+    std::vector<int> imports;
+    std::vector<flat_ast_component> components;
+    std::vector<flat_ast_component> pulls;
+    std::vector<flat_ast_config> configs;
+    std::vector<flat_ast_expression> expressions;
+    std::vector<flat_ast_wire> wires;
+    std::vector<flat_ast_connection> connections;
+    std::vector<flat_ast_probe> probes;
+    std::vector<int> wire_refs;
+    std::vector<flat_ast_scenario> scenarios;
+    std::vector<flat_ast_execution> executions;
+    std::vector<flat_ast_step> steps;
+    std::vector<flat_ast_pin_assignment> pin_assignments;
+    std::vector<flat_ast_assertion> assertions;
+};
+
+/**
+ * \brief Apply a configuration functor, such as ns or kohms, to its argument.
+ *
+ * Time functors fold to an integer count of ticks, and kohms folds to a
+ * number of ohms.
+ *
+ * \param functor       The name of the functor.
+ * \param begin         The start of the argument text.
+ * \param end           One past the end of the argument text.
+ *
+ * \returns the folded value.
+ *
+ * \throws a \ref config_value_error if the functor is unknown or the argument
+ * is not a number.
+ */
+config_value fold_functor(
+    const std::string& functor, const char* begin, const char* end);
+
+/**
+ * \brief Fold an expression to its typed value.
+ *
+ * \param symbols       The symbol table for the expression.
+ * \param expr          The expression to fold.  Its type, value, and functor
+ *                      must be set.
+ *
+ * \throws a \ref config_value_error if the expression can't be folded.
+ */
+void fold_expression(const symbol_table& symbols, flat_ast_expression& expr);
+
+/**
+ * \brief A module listener receives the nodes of a module as they are parsed.
+ *
+ * Each event passes the module being built, which holds every node parsed so
+ * far, and the index of the new node.  A wire is announced when its name is
+ * read, before its connections; its other fields are final once the next
+ * wire, component, or the end of the module is announced.  By default, every
+ * event is ignored.
+ */
+class module_listener
+{
+public:
+
+    virtual ~module_listener() { }
+
+    /**
+     * \brief The module name has been parsed.
+     */
+    virtual void on_module(const flat_module&) { }
+
+    /**
+     * \brief An import has been parsed.
+     */
+    virtual void on_import(const flat_module&, int /*import*/) { }
+
+    /**
+     * \brief A component and its configuration have been parsed.
+     */
+    virtual void on_component(const flat_module&, int /*component*/) { }
+
+    /**
+     * \brief The name of a wire has been parsed.
+     */
+    virtual void on_wire(const flat_module&, int /*wire*/) { }
+
+    /**
+     * \brief A connection of the current wire has been parsed.
+     */
+    virtual void on_connection(
+        const flat_module&, int /*wire*/, int /*connection*/) { }
+
+    /**
+     * \brief The end of the module has been parsed.
+     */
+    virtual void on_module_end(const flat_module&) { }
+};
+
+/**
+ * \brief Build a flat module from a config AST.
+ *
+ * \param mod           The config AST to flatten.
+ *
+ * \returns the flat module.
+ */
+std::shared_ptr<flat_module> make_flat_module(const config_ast_module& mod);
+
+/**
+ * \brief Build a config AST from a flat module.
+ *
+ * \param mod           The flat module to expand.
+ *
+ * \returns the config AST.
+ */
+std::shared_ptr<config_ast_module> make_config_ast(const flat_module& mod);
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_FLAT_AST_HEADER_GUARD*/
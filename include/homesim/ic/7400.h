@@ -15,7 +15,7 @@
 
 #include <functional>
 #include <homesim/constants.h>
-#include <homesim/nand_gate.h>
+#include <homesim/ic/packed_gate_array.h>
 #include <homesim/wire.h>
 
 namespace homesim {
@@ -57,10 +57,7 @@ public:
         wire* in4b, wire* in4a, double delay = ic7400_delay);
 
 private:
-    nand_gate g1;
-    nand_gate g2;
-    nand_gate g3;
-    nand_gate g4;
+    packed_gate_array gates;
 };
 
 } /* namespace homesim */
@@ -15,7 +15,7 @@
 
 #include <functional>
 #include <homesim/constants.h>
-#include <homesim/nor_gate.h>
+#include <homesim/ic/packed_gate_array.h>
 #include <homesim/wire.h>
 
 namespace homesim {
@@ -57,10 +57,7 @@ public:
         wire* in4b, wire* out4y, double delay = ic7402_delay);
 
 private:
-    nor_gate g1;
-    nor_gate g2;
-    nor_gate g3;
-    nor_gate g4;
+    packed_gate_array gates;
 };
 
 } /* namespace homesim */
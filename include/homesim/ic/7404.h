@@ -15,7 +15,7 @@
 
 #include <functional>
 #include <homesim/constants.h>
-#include <homesim/inverter.h>
+#include <homesim/ic/packed_gate_array.h>
 #include <homesim/wire.h>
 
 namespace homesim {
@@ -57,13 +57,7 @@ public:
         double delay = ic7404_delay);
 
 private:
-
-    inverter g1;
-    inverter g2;
-    inverter g3;
-    inverter g4;
-    inverter g5;
-    inverter g6;
+    packed_gate_array gates;
 };
 
 } /* namespace homesim */
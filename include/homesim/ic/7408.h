@@ -14,8 +14,8 @@
 #endif
 
 #include <functional>
-#include <homesim/and_gate.h>
 #include <homesim/constants.h>
+#include <homesim/ic/packed_gate_array.h>
 #include <homesim/wire.h>
 
 namespace homesim {
@@ -57,11 +57,7 @@ public:
         wire* in4a, wire* in4b, double delay = ic7408_delay);
 
 private:
-
-    and_gate g1;
-    and_gate g2;
-    and_gate g3;
-    and_gate g4;
+    packed_gate_array gates;
 };
 
 } /* namespace homesim */
@@ -15,6 +15,7 @@
 
 #include <functional>
 #include <homesim/constants.h>
+#include <homesim/enable_gate.h>
 #include <homesim/nand_gate.h>
 #include <homesim/wire.h>
 
@@ -66,6 +67,7 @@ public:
 private:
     wire_connection_type conn_type_a;
     wire_connection_type conn_type_b;
+    enable_gate enable;
 };
 
 } /* namespace homesim */
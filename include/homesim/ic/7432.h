@@ -15,7 +15,7 @@
 
 #include <functional>
 #include <homesim/constants.h>
-#include <homesim/or_gate.h>
+#include <homesim/ic/packed_gate_array.h>
 #include <homesim/wire.h>
 
 namespace homesim {
@@ -57,11 +57,7 @@ public:
         wire* in4a, wire* in4b, double delay = ic7432_delay);
 
 private:
-
-    or_gate g1;
-    or_gate g2;
-    or_gate g3;
-    or_gate g4;
+    packed_gate_array gates;
 };
 
 } /* namespace homesim */
@@ -15,7 +15,7 @@
 
 #include <functional>
 #include <homesim/constants.h>
-#include <homesim/xor_gate.h>
+#include <homesim/ic/packed_gate_array.h>
 #include <homesim/wire.h>
 
 namespace homesim {
@@ -57,11 +57,7 @@ public:
         wire* in4a, wire* in4b, double delay = ic7486_delay);
 
 private:
-
-    xor_gate g1;
-    xor_gate g2;
-    xor_gate g3;
-    xor_gate g4;
+    packed_gate_array gates;
 };
 
 } /* namespace homesim */
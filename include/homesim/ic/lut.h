@@ -0,0 +1,96 @@
+/**
+ * \file homesim/ic/lut.h
+ *
+ * \brief Declarations for a lookup-table component.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_IC_LUT_HEADER_GUARD
+# define HOMESIM_IC_LUT_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <homesim/agenda.h>
+#include <homesim/wire.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace homesim {
+
+/**
+ * \brief The maximum number of inputs for a lookup table.
+ *
+ * A twelve input table holds 4096 entries, which keeps exhaustive evaluation
+ * and table storage cheap.
+ */
+constexpr unsigned int lut_max_inputs = 12;
+
+/**
+ * \brief The maximum number of outputs for a lookup table.
+ */
+constexpr unsigned int lut_max_outputs = 32;
+
+/**
+ * \brief The lut error occurs when a lookup table or the cone it is built from
+ * is malformed.
+ */
+class lut_error : public std::runtime_error
+{
+public:
+    lut_error(const std::string& what)
+        : runtime_error(what)
+    {
+    }
+};
+
+/**
+ * \brief The iclut simulates a block of combinational logic as a single lookup
+ * table.
+ *
+ * Like the ROM, the inputs form an address that is tracked incrementally, and
+ * each table entry holds the packed outputs for that address.  Input changes
+ * in the same simulation instant share a single output update, and only the
+ * outputs that changed are driven.
+ */
+class iclut
+{
+public:
+
+    /**
+     * \brief iclut constructor.
+     *
+     * \param inputs    The input wires, in address bit order.
+     * \param outputs   The output wires, in table bit order.
+     * \param table     The shared truth table, with one entry per address.
+     * \param delay     The delay in seconds.
+     */
+    iclut(
+        const std::vector<wire*>& inputs, const std::vector<wire*>& outputs,
+        std::shared_ptr<const std::vector<std::uint32_t>> table,
+        double delay);
+
+    /* the input actions capture this instance, so it can't be copied. */
+    iclut(const iclut&) = delete;
+    iclut& operator=(const iclut&) = delete;
+
+private:
+    std::vector<wire*> in;
+    std::vector<wire*> out;
+    std::shared_ptr<const std::vector<std::uint32_t>> table;
+    double delay;
+    std::size_t address;
+    std::uint32_t y_bits;
+    bool y_valid;
+    double scheduled_time;
+};
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_IC_LUT_HEADER_GUARD*/
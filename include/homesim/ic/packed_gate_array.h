@@ -0,0 +1,100 @@
+/**
+ * \file homesim/ic/packed_gate_array.h
+ *
+ * \brief Declarations for a packed array of identical logic gates.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_IC_PACKED_GATE_ARRAY_HEADER_GUARD
+# define HOMESIM_IC_PACKED_GATE_ARRAY_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <cstdint>
+#include <homesim/agenda.h>
+#include <homesim/wire.h>
+#include <initializer_list>
+#include <vector>
+
+namespace homesim {
+
+/**
+ * \brief A packed gate function evaluates every gate in an array at once.
+ *
+ * Bit n of each argument holds the signal for input A / input B of gate n, and
+ * bit n of the result holds the output of gate n.  Bits above the gate count
+ * are ignored.
+ */
+typedef std::uint32_t (*packed_gate_fn)(std::uint32_t a, std::uint32_t b);
+
+/**
+ * \brief The packed_gate_array simulates a group of identical gates, such as
+ * those found in a quad or hex gate IC, as a single unit.
+ *
+ * Rather than registering a closure and scheduling an event per gate, the
+ * inputs and outputs of all gates are kept as packed bit-fields.  An input
+ * change updates a single bit, and a single output update event re-evaluates
+ * every gate with one bitwise expression.  Input changes that land in the same
+ * simulation instant share the same output update event.
+ */
+class packed_gate_array
+{
+public:
+
+    /**
+     * \brief Packed gate array constructor.
+     *
+     * \param a         The A input for each gate, in gate order.
+     * \param b         The B input for each gate, in gate order.  This is empty
+     *                  for single input gates, such as inverters.
+     * \param y         The output for each gate, in gate order.
+     * \param fn        The packed gate function used to evaluate all gates.
+     * \param delay     The delay in seconds.
+     */
+    packed_gate_array(
+        std::initializer_list<wire*> a, std::initializer_list<wire*> b,
+        std::initializer_list<wire*> y, packed_gate_fn fn, double delay);
+
+    /* the input actions capture this instance, so it can't be copied. */
+    packed_gate_array(const packed_gate_array&) = delete;
+    packed_gate_array& operator=(const packed_gate_array&) = delete;
+
+private:
+    std::vector<wire*> in_a;
+    std::vector<wire*> in_b;
+    std::vector<wire*> out;
+    packed_gate_fn eval;
+    double delay;
+    std::uint32_t a_bits;
+    std::uint32_t b_bits;
+    std::uint32_t y_bits;
+    bool y_valid;
+    double scheduled_time;
+
+    /**
+     * \brief Watch an input wire, mirroring its signal in the given bit.
+     *
+     * \param w         The input wire to watch.
+     * \param bits      The packed bit-field to update.
+     * \param mask      The bit in this field owned by the wire.
+     */
+    void watch_input(wire* w, std::uint32_t* bits, std::uint32_t mask);
+
+    /**
+     * \brief Schedule an output update, unless one is already scheduled for
+     * the same simulation instant.
+     */
+    void schedule_update();
+
+    /**
+     * \brief Evaluate all gates and drive any outputs that changed.
+     */
+    void update();
+};
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_IC_PACKED_GATE_ARRAY_HEADER_GUARD*/
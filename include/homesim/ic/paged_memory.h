@@ -0,0 +1,167 @@
+/**
+ * \file homesim/ic/paged_memory.h
+ *
+ * \brief Declarations for sparse, page-granular memory storage.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_IC_PAGED_MEMORY_HEADER_GUARD
+# define HOMESIM_IC_PAGED_MEMORY_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace homesim {
+
+/**
+ * \brief The default page size, in bytes, for paged memory.
+ */
+constexpr std::size_t paged_memory_page_size = 4096;
+
+/**
+ * \brief The memory error occurs when paged memory is configured incorrectly,
+ * or when a memory image can't be loaded or dumped.
+ */
+class memory_error : public std::runtime_error
+{
+public:
+    memory_error(const std::string& what)
+        : runtime_error(what)
+    {
+    }
+};
+
+/**
+ * \brief Paged memory provides the backing storage for large RAM and EEPROM
+ * models.
+ *
+ * Memory is addressed in words of 8, 16, or 32 bits, stored little endian.
+ * Backing storage is allocated lazily, one page at a time, the first time a
+ * non-zero word is written to that page.  Pages that have never been written
+ * read as zero, so a mostly empty address space only costs the pages touched.
+ */
+class paged_memory
+{
+public:
+
+    /**
+     * \brief Paged memory constructor.
+     *
+     * \param address_bits      The number of address bits (1 - 32).
+     * \param word_bits         The word width in bits (8, 16, or 32).
+     * \param page_size         The page size in bytes, which must be a power
+     *                          of two that is at least one word.
+     *
+     * \throws \ref memory_error if the configuration is invalid.
+     */
+    paged_memory(
+        unsigned int address_bits, unsigned int word_bits,
+        std::size_t page_size = paged_memory_page_size);
+
+    /**
+     * \brief Get the number of address bits for this memory.
+     */
+    unsigned int address_bits() const;
+
+    /**
+     * \brief Get the word width in bits for this memory.
+     */
+    unsigned int word_bits() const;
+
+    /**
+     * \brief Get the capacity of this memory in bytes.
+     */
+    std::size_t size() const;
+
+    /**
+     * \brief Get the number of pages that have been allocated.
+     */
+    std::size_t pages() const;
+
+    /**
+     * \brief Read a word from memory.  Address bits above the width of this
+     * memory are ignored, as they would be by the hardware.
+     *
+     * \param address       The word address to read.
+     *
+     * \returns the word at this address, or zero if it was never written.
+     */
+    std::uint32_t read(std::size_t address) const;
+
+    /**
+     * \brief Write a word to memory.  Address bits above the width of this
+     * memory are ignored, as they would be by the hardware.
+     *
+     * \param address       The word address to write.
+     * \param word          The word to write.
+     */
+    void write(std::size_t address, std::uint32_t word);
+
+    /**
+     * \brief Load the contents of a binary file into memory.
+     *
+     * The file is mapped read-only and copied into memory starting at the
+     * given byte offset.  Pages of the file that are entirely zero are not
+     * allocated.
+     *
+     * \param path          The path of the binary file to load.
+     * \param offset        The byte offset at which the file is loaded.
+     *
+     * \throws \ref memory_error if the file can't be mapped or does not fit.
+     */
+    void load(const std::string& path, std::size_t offset = 0);
+
+    /**
+     * \brief Dump the contents of this memory into a binary file.
+     *
+     * The file is sized to the full capacity of this memory and mapped for
+     * writing.  Only allocated pages are written, so unallocated pages become
+     * holes on file systems that support sparse files.
+     *
+     * \param path          The path of the binary file to write.
+     *
+     * \throws \ref memory_error if the file can't be created or mapped.
+     */
+    void dump(const std::string& path) const;
+
+private:
+    unsigned int addr_bits;
+    unsigned int word_bytes;
+    std::size_t page_bytes;
+    unsigned int page_shift;
+    std::unordered_map<std::size_t, std::unique_ptr<std::uint8_t[]>> page_map;
+    mutable std::size_t cached_index;
+    mutable std::uint8_t* cached_page;
+
+    /**
+     * \brief Find the page with the given index.
+     *
+     * \param index         The page index.
+     *
+     * \returns the page, or nullptr if it has not been allocated.
+     */
+    std::uint8_t* find_page(std::size_t index) const;
+
+    /**
+     * \brief Get the page with the given index, allocating a zeroed page if
+     * it is missing.
+     *
+     * \param index         The page index.
+     *
+     * \returns the page.
+     */
+    std::uint8_t* get_or_create_page(std::size_t index);
+};
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_IC_PAGED_MEMORY_HEADER_GUARD*/
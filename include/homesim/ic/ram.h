@@ -0,0 +1,84 @@
+/**
+ * \file homesim/ic/ram.h
+ *
+ * \brief Declarations for parallel RAM and EEPROM ICs.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_IC_RAM_HEADER_GUARD
+# define HOMESIM_IC_RAM_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <cstdint>
+#include <homesim/constants.h>
+#include <homesim/enable_gate.h>
+#include <homesim/ic/paged_memory.h>
+#include <homesim/wire.h>
+#include <memory>
+#include <vector>
+
+namespace homesim {
+
+/**
+ * \brief RAM output change delay.
+ *
+ * By default, this delay mimics worst-case performance for a fast SRAM.
+ */
+constexpr double icram_delay = 10.0 * nanoseconds_to_seconds_scale;
+
+/**
+ * \brief The icram simulates a parallel SRAM or EEPROM interface.
+ *
+ * The data bus can be 8, 16, or 32 bits wide, and the contents are held in a
+ * shared \ref paged_memory instance, so large and mostly empty address spaces
+ * only cost the pages that are touched.  Because the memory is shared, its
+ * contents can be loaded before the simulation starts or dumped afterward.
+ *
+ * All control lines are active low.  While CE and WE are both low, the data
+ * bus is high-Z and the word on the data bus is written to the current
+ * address.  While CE and OE are low and WE is high, the word at the current
+ * address is driven onto the data bus.  Otherwise, the data bus is high-Z.
+ */
+class icram
+{
+public:
+
+    /**
+     * \brief icram constructor.
+     *
+     * \param addresses         Vector of address wire pointers, least
+     *                          significant first.  This must match the number
+     *                          of address bits for the memory.
+     * \param data              Vector of data wire pointers, least significant
+     *                          first.  This must match the word width of the
+     *                          memory.
+     * \param memory            The backing memory for this IC.
+     * \param ce                Chip Enable wire (low = chip enabled).
+     * \param oe                Output Enable wire (low = output words).
+     * \param we                Write Enable wire (low = write words).
+     * \param delay             The optional delay in seconds.
+     *
+     * \throws \ref memory_error if the wires don't match the memory.
+     */
+    icram(
+        const std::vector<wire*>& addresses, const std::vector<wire*>& data,
+        std::shared_ptr<paged_memory> memory, wire* ce, wire* oe, wire* we,
+        double delay = icram_delay);
+
+private:
+    std::shared_ptr<paged_memory> mem;
+    std::vector<wire*> addr;
+    std::vector<wire*> data_bus;
+    std::size_t address;
+    std::uint32_t last_word;
+    wire_connection_type conn_type_bus;
+    enable_gate enable;
+};
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_IC_RAM_HEADER_GUARD*/
@@ -10,7 +10,10 @@
 
 #include <cstdint>
 #include <homesim/constants.h>
+#include <homesim/enable_gate.h>
+#include <homesim/ic/rom_image.h>
 #include <homesim/wire.h>
+#include <memory>
 #include <vector>
 
 /** C++ version check. */
@@ -80,10 +83,44 @@ public:
         wire* oe, wire* ce, wire* b0, wire* b1, wire* b2, wire* b3, wire* b4,
         wire* b5, wire* b6, wire* b7, double delay = icrom_delay);
 
+    /**
+     * \brief icrom constructor for a shared ROM image.
+     *
+     * This constructor works like the byte vector constructor, except that
+     * the ROM bytes are provided as a shared, immutable image.  The image is
+     * not copied, so any number of ROM instances can share a single image,
+     * such as one mapped from a binary file.
+     *
+     * \param addresses         Vector of address wire pointers.
+     * \param image             The shared ROM image.
+     * \param oe                Output Enable wire (low = output bytes; high =
+     *                          bus line is high Z).
+     * \param ce                Chip Enable wire (low = chip enabled; high =
+     *                          bus line is high Z).
+     * \param b0                Bus line 0.
+     * \param b1                Bus line 1.
+     * \param b2                Bus line 2.
+     * \param b3                Bus line 3.
+     * \param b4                Bus line 4.
+     * \param b5                Bus line 5.
+     * \param b6                Bus line 6.
+     * \param b7                Bus line 7.
+     * \param delay             The optional delay in seconds.
+     */
+    icrom(
+        const std::vector<wire*>& addresses,
+        std::shared_ptr<const rom_image> image,
+        wire* oe, wire* ce, wire* b0, wire* b1, wire* b2, wire* b3, wire* b4,
+        wire* b5, wire* b6, wire* b7, double delay = icrom_delay);
+
 private:
-    std::vector<std::uint8_t> rom;
+    std::shared_ptr<const rom_image> rom;
     std::vector<wire*> addr;
+    wire* data_bus[8];
+    std::size_t address;
+    std::uint8_t last_byte;
     wire_connection_type conn_type_bus;
+    enable_gate enable;
 };
 
 } /* namespace homesim */
@@ -0,0 +1,133 @@
+/**
+ * \file homesim/ic/rom_image.h
+ *
+ * \brief Declarations for shared, immutable ROM images.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_IC_ROM_IMAGE_HEADER_GUARD
+# define HOMESIM_IC_ROM_IMAGE_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace homesim {
+
+/**
+ * \brief The ROM image error occurs when a ROM image file can't be opened or
+ * mapped.
+ */
+class rom_image_error : public std::runtime_error
+{
+public:
+    rom_image_error(const std::string& what)
+        : runtime_error(what)
+    {
+    }
+};
+
+/**
+ * \brief A rom_image is an immutable block of memory bytes that can be shared
+ * by any number of ROM instances.
+ *
+ * The image is either backed by a byte vector held in memory, or by a binary
+ * file mapped read-only into memory.  A mapped image is backed by the page
+ * cache, so every process that maps the same file shares one physical copy.
+ * Images are meant to be held by a std::shared_ptr, so that every ROM using
+ * the image shares the same instance.
+ */
+class rom_image
+{
+public:
+
+    /**
+     * \brief Create a ROM image that takes ownership of the given bytes.
+     *
+     * \param bytes         The ROM bytes, starting at a zero index.
+     */
+    explicit rom_image(std::vector<std::uint8_t>&& bytes);
+
+    /**
+     * \brief Create a ROM image that shares the given bytes.
+     *
+     * The bytes must not be modified for the lifetime of this image.
+     *
+     * \param shared_bytes  The ROM bytes, starting at a zero index.
+     */
+    explicit rom_image(
+        std::shared_ptr<const std::vector<std::uint8_t>> shared_bytes);
+
+    /**
+     * \brief Create a ROM image by mapping a binary file read-only.
+     *
+     * \param path          The path of the binary file to map.
+     *
+     * \throws \ref rom_image_error if the file can't be opened or mapped.
+     */
+    explicit rom_image(const std::string& path);
+
+    /**
+     * \brief Release the ROM image, unmapping it if it was mapped.
+     */
+    ~rom_image();
+
+    /* an image owns its mapping, so it can't be copied. */
+    rom_image(const rom_image&) = delete;
+    rom_image& operator=(const rom_image&) = delete;
+
+    /**
+     * \brief Get the number of bytes in this image.
+     */
+    std::size_t size() const
+    {
+        return length;
+    }
+
+    /**
+     * \brief Get a pointer to the first byte of this image.
+     */
+    const std::uint8_t* data() const
+    {
+        return bytes;
+    }
+
+    /**
+     * \brief Get the byte at the given address.
+     *
+     * \param address       The address of the byte, which must be in range.
+     */
+    std::uint8_t operator[](std::size_t address) const
+    {
+        return bytes[address];
+    }
+
+private:
+    const std::uint8_t* bytes;
+    std::size_t length;
+    std::shared_ptr<const std::vector<std::uint8_t>> owner;
+    void* mapping;
+};
+
+/**
+ * \brief Write a ROM image to a binary file, so it can later be mapped.
+ *
+ * \param path          The path of the binary file to write.
+ * \param bytes         The ROM bytes to write.
+ *
+ * \throws \ref rom_image_error if the file can't be written.
+ */
+void write_rom_image(
+    const std::string& path, const std::vector<std::uint8_t>& bytes);
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_IC_ROM_IMAGE_HEADER_GUARD*/
@@ -0,0 +1,182 @@
+/**
+ * \file homesim/macro_model.h
+ *
+ * \brief Declarations for behavioral macro-model substitution.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_MACRO_MODEL_HEADER_GUARD
+# define HOMESIM_MACRO_MODEL_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <homesim/constants.h>
+#include <homesim/wire.h>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+
+namespace homesim {
+
+/**
+ * \brief The ways in which a composite with a behavioral macro-model can be
+ * elaborated.
+ */
+enum macro_model_mode
+{
+    /** \brief Elaborate the composite from its sub-components. */
+    MACRO_MODEL_MODE_STRUCTURAL,
+    /** \brief Substitute the behavioral model for the composite. */
+    MACRO_MODEL_MODE_BEHAVIORAL,
+    /** \brief Elaborate both, and flag any divergence at the pins. */
+    MACRO_MODEL_MODE_COSIMULATE
+};
+
+/**
+ * \brief A divergence between a structural composite and its behavioral
+ * model, found during co-simulation.
+ */
+struct macro_model_divergence
+{
+    double time;
+    std::string composite;
+    std::string pin;
+    bool structural_signal;
+    bool behavioral_signal;
+};
+
+/**
+ * \brief The macro-model registry tracks which composites have a behavioral
+ * model, and how each of them should be elaborated.
+ *
+ * A composite registers its behavioral model by name, and then asks the
+ * registry for its mode when it is built.  Composites with a registered model
+ * use the default mode, which substitutes the behavioral model, unless a mode
+ * has been set for that composite.  Composites without a registered model are
+ * always structural.
+ */
+class macro_model_registry
+{
+public:
+
+    /**
+     * \brief Create a macro-model registry.
+     */
+    macro_model_registry();
+
+    /**
+     * \brief Register a behavioral model for the given composite.
+     *
+     * \param composite     The name of the composite.
+     */
+    void register_model(const std::string& composite);
+
+    /**
+     * \brief Set the mode used by composites without an explicit mode.
+     *
+     * \param mode          The default mode.
+     */
+    void set_default_mode(macro_model_mode mode);
+
+    /**
+     * \brief Set the mode used by the given composite.
+     *
+     * \param composite     The name of the composite.
+     * \param mode          The mode for this composite.
+     */
+    void set_mode(const std::string& composite, macro_model_mode mode);
+
+    /**
+     * \brief Get the mode for the given composite.
+     *
+     * \param composite     The name of the composite.
+     *
+     * \returns the mode to use when building this composite.
+     */
+    macro_model_mode mode(const std::string& composite) const;
+
+    /**
+     * \brief Report a divergence found during co-simulation.
+     *
+     * \param divergence    The divergence to report.
+     */
+    void report_divergence(const macro_model_divergence& divergence);
+
+    /**
+     * \brief Get the divergences reported so far.
+     */
+    const std::list<macro_model_divergence>& divergences() const;
+
+    /**
+     * \brief Clear the divergences reported so far.
+     */
+    void clear_divergences();
+
+private:
+    /* components may be created on worker threads during analysis. */
+    mutable std::mutex model_lock;
+    std::set<std::string> models;
+    std::map<std::string, macro_model_mode> modes;
+    macro_model_mode default_mode;
+    std::list<macro_model_divergence> divergence_list;
+};
+
+/**
+ * \brief The global macro-model registry.
+ */
+extern macro_model_registry global_macro_models;
+
+/**
+ * \brief The default time that pins may disagree during co-simulation before
+ * a divergence is reported.
+ */
+constexpr double cosim_tolerance = 5.0 * nanoseconds_to_seconds_scale;
+
+/**
+ * \brief The co-simulation monitor compares pins driven by a structural
+ * composite against the same pins driven by its behavioral model.
+ *
+ * The behavioral model drives shadow wires, which are compared against the
+ * real wires driven by the structural composite.  The two models may have
+ * slightly different internal timing, so a comparison is made once the pins
+ * have had the tolerance time to settle after either one changes.  Any
+ * mismatch is reported to the global macro-model registry.
+ */
+class cosim_monitor
+{
+public:
+
+    /**
+     * \brief Create a co-simulation monitor.
+     *
+     * \param composite     The name of the composite being monitored.
+     * \param tolerance     The time pins may disagree, in seconds.
+     */
+    cosim_monitor(
+        const std::string& composite, double tolerance = cosim_tolerance);
+
+    /**
+     * \brief Watch a pair of wires for divergence.
+     *
+     * Any pull-ups or pull-downs on the structural wire are mirrored onto the
+     * behavioral wire, so that both wires settle the same way when released.
+     *
+     * \param pin           The name of the pin being watched.
+     * \param structural    The wire driven by the structural composite.
+     * \param behavioral    The shadow wire driven by the behavioral model.
+     */
+    void watch(const std::string& pin, wire* structural, wire* behavioral);
+
+private:
+    std::string name;
+    double tolerance;
+};
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_MACRO_MODEL_HEADER_GUARD*/
@@ -0,0 +1,204 @@
+/**
+ * \file homesim/netlist_arena.h
+ *
+ * \brief Declarations for the netlist arena.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_NETLIST_ARENA_HEADER_GUARD
+# define HOMESIM_NETLIST_ARENA_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace homesim {
+
+/**
+ * \brief The default size, in bytes, of a netlist arena block.
+ */
+constexpr std::size_t netlist_arena_block_size = 64 * 1024;
+
+/**
+ * \brief The netlist arena provides bulk storage for the wires, components,
+ * and fanout records of a single simulation.
+ *
+ * Objects are bump allocated from large blocks, so building a netlist costs a
+ * handful of allocations rather than one or more per object.  Individual
+ * objects are never freed; instead, the arena runs the destructor of every
+ * object it created, in reverse order, and releases all of its blocks at once
+ * when it is destroyed.  Anything allocated from the arena must not outlive
+ * it.
+ */
+class netlist_arena
+{
+public:
+
+    /**
+     * \brief Netlist arena constructor.
+     *
+     * \param block_size    The size of each block allocated by the arena.
+     */
+    explicit netlist_arena(std::size_t block_size = netlist_arena_block_size);
+
+    /**
+     * \brief Netlist arena destructor.
+     *
+     * Destroys every object created by this arena, then frees its blocks.
+     */
+    ~netlist_arena();
+
+    /* objects in the arena refer to its blocks, so it can't be copied. */
+    netlist_arena(const netlist_arena&) = delete;
+    netlist_arena& operator=(const netlist_arena&) = delete;
+
+    /**
+     * \brief Reserve space ahead of a bulk build.
+     *
+     * After this call, at least the given number of bytes can be allocated
+     * without allocating another block.
+     *
+     * \param bytes         The number of bytes to reserve.
+     */
+    void reserve(std::size_t bytes);
+
+    /**
+     * \brief Allocate raw memory from the arena.
+     *
+     * \param bytes         The number of bytes to allocate.
+     * \param alignment     The alignment of the allocation.
+     *
+     * \returns the allocated memory, which is freed with the arena.
+     */
+    void* allocate(std::size_t bytes, std::size_t alignment);
+
+    /**
+     * \brief Create an object in the arena.
+     *
+     * \param args          The constructor arguments for the object.
+     *
+     * \returns the new object, which is destroyed with the arena.
+     */
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+        void* mem = allocate(sizeof(T), alignof(T));
+        T* obj = new (mem) T(std::forward<Args>(args)...);
+
+        if (!std::is_trivially_destructible<T>::value)
+            add_destructor(obj, [](void* p) { static_cast<T*>(p)->~T(); });
+
+        return obj;
+    }
+
+    /**
+     * \brief Return the number of bytes allocated from this arena.
+     */
+    std::size_t size() const;
+
+private:
+    struct destructor_record
+    {
+        destructor_record* next;
+        void* obj;
+        void (*destroy)(void*);
+    };
+
+    std::size_t block_size;
+    std::vector<std::unique_ptr<unsigned char[]>> blocks;
+    unsigned char* cursor;
+    unsigned char* limit;
+    std::size_t allocated;
+    destructor_record* destructors;
+
+    /**
+     * \brief Start a new block with at least the given free space.
+     *
+     * \param bytes         The minimum free space for the new block.
+     */
+    void add_block(std::size_t bytes);
+
+    /**
+     * \brief Record the destructor for an object created in this arena.
+     *
+     * \param obj           The object to destroy with the arena.
+     * \param destroy       The function which destroys this object.
+     */
+    void add_destructor(void* obj, void (*destroy)(void*));
+};
+
+/**
+ * \brief A standard allocator that allocates from a netlist arena.
+ *
+ * An allocator without an arena uses the global heap, so containers using this
+ * allocator work the same whether or not their owner lives in an arena.
+ */
+template <typename T>
+class arena_allocator
+{
+public:
+    typedef T value_type;
+
+    arena_allocator() noexcept
+        : arena(nullptr)
+    {
+    }
+
+    explicit arena_allocator(netlist_arena* arena) noexcept
+        : arena(arena)
+    {
+    }
+
+    template <typename U>
+    arena_allocator(const arena_allocator<U>& other) noexcept
+        : arena(other.get_arena())
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if (nullptr == arena)
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+
+        return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept
+    {
+        /* arena memory is released with the arena. */
+        if (nullptr == arena)
+            ::operator delete(p);
+    }
+
+    netlist_arena* get_arena() const noexcept
+    {
+        return arena;
+    }
+
+private:
+    netlist_arena* arena;
+};
+
+template <typename T, typename U>
+bool operator==(const arena_allocator<T>& a, const arena_allocator<U>& b)
+{
+    return a.get_arena() == b.get_arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const arena_allocator<T>& a, const arena_allocator<U>& b)
+{
+    return a.get_arena() != b.get_arena();
+}
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_NETLIST_ARENA_HEADER_GUARD*/
@@ -0,0 +1,121 @@
+/**
+ * \file homesim/netlist_cache.h
+ *
+ * \brief Declarations for the binary netlist cache.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_NETLIST_CACHE_HEADER_GUARD
+# define HOMESIM_NETLIST_CACHE_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <cstdint>
+#include <homesim/flat_ast.h>
+#include <stdexcept>
+#include <string>
+
+namespace homesim {
+
+/**
+ * \brief The version of the netlist cache format.  Bump this whenever the
+ * format changes.
+ */
+constexpr uint32_t netlist_cache_version = 6;
+
+/**
+ * \brief The magic bytes at the start of a netlist cache.
+ */
+constexpr char netlist_cache_magic[8] =
+    { 'H', 'S', 'N', 'E', 'T', 'C', 'A', 'C' };
+
+/**
+ * \brief The record sizes stored in a netlist cache, four bits apart.
+ */
+constexpr uint64_t netlist_cache_record_sizes =
+    sizeof(flat_ast_component)
+  ^ (sizeof(flat_ast_config) << 4)
+  ^ (sizeof(flat_ast_expression) << 8)
+  ^ (sizeof(flat_ast_wire) << 12)
+  ^ (sizeof(flat_ast_connection) << 16)
+  ^ (sizeof(flat_ast_probe) << 20)
+  ^ (sizeof(flat_ast_step) << 24)
+  ^ (sizeof(flat_ast_assertion) << 28)
+  ^ (uint64_t(sizeof(flat_ast_pin_assignment)) << 32);
+
+/**
+ * \brief A fingerprint of the record layouts stored in a netlist cache, so
+ * that a cache written by a build with different layouts is rejected.
+ */
+constexpr uint32_t netlist_cache_layout =
+    static_cast<uint32_t>(
+        netlist_cache_record_sizes ^ (netlist_cache_record_sizes >> 32));
+
+/**
+ * \brief The header of a netlist cache file.
+ *
+ * The header is followed by a fixed sequence of sections.  Each section is a
+ * 64-bit record count followed by the records, padded to eight bytes.  The
+ * checksum covers every byte after the header.
+ */
+struct netlist_cache_header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t layout;
+    uint64_t source_hash;
+    uint64_t size;
+    uint64_t checksum;
+    int32_t name;
+    int32_t reserved;
+};
+
+/**
+ * \brief A pin binding resolved during analysis.  Wires are numbered by
+ * element, in module order, and components likewise.
+ */
+struct netlist_cache_target
+{
+    int32_t wire;
+    int32_t component;
+    int32_t pin;
+};
+
+/**
+ * \brief The pin layout of a component type when a cache was written.
+ */
+struct netlist_cache_fingerprint
+{
+    int32_t type;
+    int32_t pins;
+    uint64_t hash;
+};
+
+/**
+ * \brief This exception is thrown when a netlist cache can't be written.
+ */
+class netlist_cache_error : public std::runtime_error
+{
+public:
+    netlist_cache_error(const std::string& what)
+        : runtime_error(what)
+    {
+    }
+};
+
+/**
+ * \brief Compute the content hash that keys a netlist cache.
+ *
+ * \param begin         The start of the source text.
+ * \param end           One past the end of the source text.
+ *
+ * \returns the hash of the source text.
+ */
+uint64_t netlist_cache_hash(const char* begin, const char* end);
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_NETLIST_CACHE_HEADER_GUARD*/
@@ -0,0 +1,42 @@
+/**
+ * \file homesim/parallel.h
+ *
+ * \brief Declarations for running independent work on worker threads.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#ifndef  HOMESIM_PARALLEL_HEADER_GUARD
+# define HOMESIM_PARALLEL_HEADER_GUARD
+
+/** C++ version check. */
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# error This file requires C++14 or greater.
+#endif
+
+#include <cstddef>
+#include <functional>
+
+namespace homesim {
+
+/**
+ * \brief Run a loop body for each index from zero to count on a pool of
+ * worker threads.
+ *
+ * The calling thread is one of the workers.  Indices are handed out in order
+ * but may finish in any order, so the body must only write to state owned by
+ * its index.  If any body throws, the exception from the lowest failing index
+ * is rethrown once every worker has finished, so the result does not depend
+ * on scheduling.
+ *
+ * \param count         The number of indices.
+ * \param body          The loop body, called once per index.
+ * \param workers       The number of worker threads, or zero for one per
+ *                      hardware thread.
+ */
+void parallel_for(
+    size_t count, const std::function<void (size_t)>& body,
+    unsigned workers = 0);
+
+} /* namespace homesim */
+
+#endif /*HOMESIM_PARALLEL_HEADER_GUARD*/
@@ -10,8 +10,8 @@
 # define HOMESIM_PARSER_HEADER_GUARD
 
 /** C++ version check. */
-#if !defined(__cplusplus) || __cplusplus < 201402L
-# error This file requires C++14 or greater.
+#if !defined(__cplusplus) || __cplusplus < 201703L
+# error This file requires C++17 or greater.
 #endif
 
 #include <functional>
@@ -22,6 +22,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 
 namespace homesim {
 
@@ -42,6 +43,8 @@ enum token
     HOMESIM_TOKEN_BRACKET_LEFT,
     /* right bracket. */
     HOMESIM_TOKEN_BRACKET_RIGHT,
+    /* colon. */
+    HOMESIM_TOKEN_COLON,
     /* dot. */
     HOMESIM_TOKEN_DOT,
     /* equals. */
@@ -68,6 +71,8 @@ enum token
     HOMESIM_TOKEN_KEYWORD_EXTERNAL,
     /* false keyword. */
     HOMESIM_TOKEN_KEYWORD_FALSE,
+    /* import keyword. */
+    HOMESIM_TOKEN_KEYWORD_IMPORT,
     /* module keyword. */
     HOMESIM_TOKEN_KEYWORD_MODULE,
     /* pin keyword. */
@@ -78,6 +83,8 @@ enum token
     HOMESIM_TOKEN_KEYWORD_PULLDOWN,
     /* pullup keyword. */
     HOMESIM_TOKEN_KEYWORD_PULLUP,
+    /* repeat keyword. */
+    HOMESIM_TOKEN_KEYWORD_REPEAT,
     /* scenario keyword. */
     HOMESIM_TOKEN_KEYWORD_SCENARIO,
     /* signal keyword. */
@@ -122,9 +129,66 @@ token_pair;
  */
 std::string token_to_description(token t);
 
+/**
+ * \brief A read-only memory mapping of a source file.
+ *
+ * The mapping lives as long as this instance, so a lexer or parser created
+ * over its range must not outlive it.
+ */
+class mapped_file
+{
+public:
+
+    /**
+     * \brief Map the given file into memory.
+     *
+     * \param path          The path of the file to map.
+     *
+     * \throws a mapped_file_error if the file can't be opened or mapped.
+     */
+    mapped_file(const std::string& path);
+
+    /**
+     * \brief Unmap the file.
+     */
+    ~mapped_file();
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    /**
+     * \brief Get the start of the mapped file contents.
+     */
+    const char* begin() const;
+
+    /**
+     * \brief Get the end of the mapped file contents.
+     */
+    const char* end() const;
+
+private:
+    const char* data;
+    size_t length;
+};
+
+/**
+ * \brief Exception thrown when a source file can't be mapped.
+ */
+class mapped_file_error : public std::runtime_error
+{
+public:
+    mapped_file_error(const std::string& what)
+        : runtime_error(what)
+    {
+    }
+};
+
 /**
  * \brief The lexer tokenizes an input stream.  These tokens can then be passed
  * to a parser instance to parse a homesim stream.
+ *
+ * The lexer scans a contiguous buffer.  Tokens are ranges into that buffer,
+ * and line and column information is only computed when requested.
  */
 class lexer
 {
@@ -133,10 +197,23 @@ public:
     /**
      * \brief Create a lexer instance backed by the given input stream.
      *
+     * The stream is read into a buffer owned by this instance.
+     *
      * \param input         The input stream for this instance.
      */
     lexer(std::istream& input);
 
+    /**
+     * \brief Create a lexer instance over the given buffer, without copying it.
+     *
+     * \param begin         The start of the buffer.
+     * \param end           One past the end of the buffer.
+     */
+    lexer(const char* begin, const char* end);
+
+    lexer(const lexer&) = delete;
+    lexer& operator=(const lexer&) = delete;
+
     /**
      * \brief Read a token from the stream.
      *
@@ -168,32 +245,30 @@ public:
      */
     std::string get_token_string();
 
+    /**
+     * \brief Get the text of the current token, as a view of the source
+     * buffer.  The view is valid as long as the lexer.
+     */
+    std::string_view get_token_view() const;
+
 private:
-    std::istream& in;
-    std::list<char> tokenbuf;
-    std::list<int> putbackbuf;
-    int curline;
-    int curcol;
-    int start_line;
-    int start_col;
-    int end_line;
-    int end_col;
+    std::string storage;
+    const char* begin;
+    const char* end;
+    const char* pos;
+    const char* last;
+    const char* token_begin;
+    const char* token_end;
+    mutable const char* line_pos;
+    mutable const char* line_begin;
+    mutable int line;
 
     int read_char();
     void start(int ch);
     void accept(int ch);
     void put_back(int ch);
 
-    token matchSequence(
-        const std::string& seq, std::function<token ()> onAccept,
-        std::function<token ()> onFail);
-
-    token matchKeywordOrIdentifier(
-        const std::string& seq, token keywordToken);
-
-    token matchEndOfKeyword(
-        std::function<token ()> onAccept,
-        std::function<token ()> onFail);
+    static token keyword(const char* begin, const char* end);
 
     token maybeReadAssign();
     token maybeReadAsterisk();
@@ -203,17 +278,7 @@ private:
     token maybeReadDecimalNumber();
     token maybeReadExponentNumberWithSign();
     token maybeReadExponentNumber();
-    token maybeReadKeywordAfterAssertAtOrIdentifier();
-    token maybeReadKeywordExamineExecutionExpectExportExternalOrIdentifier();
-    token maybeReadKeywordExpectExportOrIdentifier();
-    token maybeReadKeywordPinProbePulldownPullupOrIdentifier();
-    token maybeReadKeywordPulldownPullupOrIdentifier();
-    token maybeReadKeywordPullupOrIdentifier();
-    token maybeReadKeywordScenarioSignalStartStateOrIdentifier();
-    token maybeReadKeywordStartStateOrIdentifier();
-    token maybeReadKeywordTrueTypeOrIdentifier();
     token maybeReadIdentifier();
-    token maybeReadStartIdentifier();
     token maybeReadString();
 };
 
@@ -224,6 +289,9 @@ struct config_ast_wire;
 struct config_ast_probe;
 struct config_ast_scenario;
 struct config_ast_expression;
+struct flat_module;
+class module_listener;
+struct flat_ast_component;
 struct config_ast_execution;
 struct config_ast_step;
 struct config_ast_assertion;
@@ -231,6 +299,7 @@ struct config_ast_assertion;
 struct config_ast_module
 {
     std::string name;
+    std::list<std::string> import_list;
     std::multimap<std::string, std::shared_ptr<config_ast_component>>
     component_map;
     std::multimap<std::string, std::shared_ptr<config_ast_wire>> wire_map;
@@ -297,6 +366,19 @@ struct config_ast_complex_expression : public config_ast_expression
     std::list<token_pair> args;
 };
 
+/**
+ * \brief Apply a configuration functor, such as ns or kohms, to its argument.
+ *
+ * \param functor       The name of the functor.
+ * \param arg           The argument text.
+ *
+ * \returns the string value of the result.
+ *
+ * \throws a \ref parser_error if the functor is unknown or the argument is
+ * not a number.
+ */
+std::string eval_functor(const std::string& functor, const std::string& arg);
+
 struct config_ast_assignment
 {
     std::string lhs_major;
@@ -318,6 +400,8 @@ struct config_ast_step
     std::shared_ptr<config_ast_expression> step_expression;
     std::list<std::shared_ptr<config_ast_assignment>> pin_assignments;
     std::list<std::shared_ptr<config_ast_assertion>> assertion_list;
+    /* the steps of a repeat block. */
+    std::list<std::shared_ptr<config_ast_step>> step_list;
 };
 
 struct config_ast_assertion
@@ -347,6 +431,10 @@ class parser
 {
 public:
 
+    /** \brief The most elements an array can have.  Element indices and
+     * ranges are below this bound. */
+    static const int max_count = 65536;
+
     /**
      * \brief Create a parser instance backed by the given input stream.
      *
@@ -354,6 +442,15 @@ public:
      */
     parser(std::istream& input);
 
+    /**
+     * \brief Create a parser instance over the given buffer, without copying
+     * it.
+     *
+     * \param begin         The start of the buffer.
+     * \param end           One past the end of the buffer.
+     */
+    parser(const char* begin, const char* end);
+
     /**
      * \brief Parse the input stream producing a config ast.
      *
@@ -363,58 +460,85 @@ public:
      */
     std::shared_ptr<config_ast_module> parse();
 
+    /**
+     * \brief Parse the input stream producing a flat AST.
+     *
+     * \returns the flat module on success.
+     *
+     * \throws a parser_error on failure.
+     */
+    std::shared_ptr<flat_module> parse_flat();
+
+    /**
+     * \brief Parse the input stream producing a flat AST, announcing each
+     * node to a listener as it is parsed.
+     *
+     * \param listener      The listener for parse events.
+     *
+     * \returns the flat module on success.
+     *
+     * \throws a parser_error on failure, or any exception thrown by the
+     * listener.
+     */
+    std::shared_ptr<flat_module> parse_flat(module_listener& listener);
+
 private:
-    lexer in;
-    std::list<token_pair> lookahead;
 
-    token_pair read();
-    void put_back(const token_pair&);
-    std::shared_ptr<config_ast_component> parse_component();
-    std::shared_ptr<config_ast_component> parse_pull(const std::string& type);
-    std::shared_ptr<config_ast_wire> parse_wire();
+    /**
+     * \brief A token read by the parser, as a range in the source buffer.
+     */
+    struct parser_token
+    {
+        token type;
+        const char* begin;
+        const char* end;
+    };
+
+    /** \brief The most tokens that can be put back at once. */
+    static const int lookahead_max = 2;
+
+    lexer in;
+    parser_token lookahead[lookahead_max];
+    int lookahead_count;
+    std::shared_ptr<flat_module> flat;
+    module_listener* listener;
+
+    parser_token read();
+    void put_back(const parser_token&);
+    parser_token expect(token t);
+    parser_token choose(std::initializer_list<token> choices);
+    void parse_import();
+    void parse_component();
+    int parse_pull(const parser_token& type);
+    void parse_wire(bool exported);
     void parse_wire_signal_source();
-    std::shared_ptr<config_ast_wire> parse_export_wire();
-    std::shared_ptr<config_ast_probe> parse_probe(const std::string& type);
-    std::shared_ptr<config_ast_assignment> parse_assign(const std::string& id);
-    std::shared_ptr<config_ast_assignment>
-    parse_pin_assign(const std::string& id);
-    std::shared_ptr<config_ast_connection>
-    parse_connection(const std::string& id);
-    std::shared_ptr<config_ast_scenario> parse_scenario();
-    std::shared_ptr<config_ast_execution> parse_execution();
-    std::shared_ptr<config_ast_step> parse_step(const std::string& type);
-    std::shared_ptr<config_ast_assertion>
-    parse_assertion(const std::string& type);
-    std::shared_ptr<std::function<void(const token_pair&)>>
-    simple_assignment_maker(
-        std::shared_ptr<config_ast_assignment>);
+    void parse_export_wire();
+    void parse_probe(const parser_token& type);
+    void parse_assign(const parser_token& id, flat_ast_component& component);
+    void parse_pin_assign(const parser_token& id);
+    void parse_connection(const parser_token& id, int count);
+    void parse_scenario();
+    void parse_execution();
+    void parse_step_block();
+    void parse_step(const parser_token& type);
+    void parse_repeat(const parser_token& type);
+    void parse_assertion(const parser_token& type);
     void handle_assignment(
-        std::shared_ptr<config_ast_component> component,
-        std::shared_ptr<config_ast_assignment> assignment);
-    std::shared_ptr<std::string> parse_type();
-    std::shared_ptr<std::string> parse_wire_ref();
-    std::shared_ptr<config_ast_expression>
-    parse_complex_expression(const std::string&);
-    std::shared_ptr<config_ast_expression>
-    parse_inner_expression(const std::string&);
-
-    void
-    parse_sequence(
-        std::initializer_list<
-            std::pair<
-                token,
-                std::shared_ptr<std::function<void (const token_pair&)>>>>
-            seq);
-
-    void
-    parse_choose(
-        std::initializer_list<
-            std::pair<
-                token,
-                std::shared_ptr<std::function<void (const token_pair&)>>>>
-            choices);
-
-    std::string trim_string(const std::string& str);
+        flat_ast_component& component, int key, int expression);
+    int parse_type();
+    int parse_wire_ref();
+    int parse_element_ref(const parser_token& id);
+    int parse_element_index();
+    int parse_count();
+    void parse_range(int& first, int& last);
+    int parse_integer(const parser_token& t, int min, int max);
+    int parse_complex_expression(const parser_token& id);
+    int parse_inner_expression(const parser_token& id);
+    int simple_expression(const parser_token& t);
+    int add_expression(token ty, int value, int functor);
+    parser_error error_at(const std::string& message);
+    int intern(const parser_token& t);
+    int intern_trimmed(const parser_token& t);
 };
 
 } /* namespace homesim */
@@ -13,7 +13,13 @@
 # error This file requires C++14 or greater.
 #endif
 
+#include <iosfwd>
+#include <homesim/flat_ast.h>
 #include <homesim/parser.h>
+#include <homesim/wire.h>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace homesim {
 
@@ -22,7 +28,9 @@ class environment;
 class simulation;
 class schematic;
 class component;
-class wire;
+class composite_definition;
+class netlist_arena;
+struct netlist_cache_target;
 
 /**
  * \brief This exception is thrown when an error is found during semantic
@@ -37,7 +45,33 @@ public:
     }
 };
 
-class semantic_analyzer
+/**
+ * \brief This exception is thrown when a scenario assertion fails, or when a
+ * scenario step can't be run.
+ */
+class scenario_error : public std::runtime_error
+{
+public:
+    scenario_error(const std::string& what)
+        : runtime_error(what)
+    {
+    }
+};
+
+/**
+ * \brief The changes made to a netlist by \ref semantic_analyzer::update.
+ */
+struct netlist_update
+{
+    int components_kept;
+    int components_built;
+    int components_removed;
+    int wires_kept;
+    int wires_created;
+    int wires_removed;
+};
+
+class semantic_analyzer : private module_listener
 {
 public:
 
@@ -51,12 +85,52 @@ public:
         std::shared_ptr<environment> en,
         std::shared_ptr<config_ast_module> mod);
 
+    /**
+     * \brief Semantic analyzer for a flat homesim AST.
+     *
+     * \param en                The environment for this analysis.
+     * \param mod               The flat module to analyze.
+     * \param directory         The directory against which relative import
+     *                          paths are resolved, or empty for the current
+     *                          directory.
+     */
+    semantic_analyzer(
+        std::shared_ptr<environment> en,
+        std::shared_ptr<const flat_module> mod,
+        const std::string& directory = std::string());
+
+    /**
+     * \brief Parse a module and analyze it as it is parsed.
+     *
+     * Components and wires are built as the parser announces them, so the
+     * netlist is elaborated in the same pass as parsing.  A connection to a
+     * component that has not been parsed yet is bound at the end of the
+     * module.
+     *
+     * \param en            The environment for this analysis.
+     * \param p             The parser for the module.
+     * \param directory     The directory against which relative import paths
+     *                      are resolved, or empty for the current directory.
+     *
+     * \returns an analyzed semantic_analyzer on success.
+     *
+     * \throws a \ref parser_error or \ref semantic_error on failure.
+     */
+    static std::shared_ptr<semantic_analyzer> analyze_stream(
+        std::shared_ptr<environment> en, parser& p,
+        const std::string& directory = std::string());
+
     /**
      * \brief Extract a simulation from the analyzer.
      *
+     * The simulation owns a netlist of its own, built from the module, with
+     * its own agenda; the analyzer's netlist is left as it was.  A pin left
+     * unconnected floats on a net of its own.
+     *
      * \returns a simulation on success.
      *
-     * \throws a \ref semantic_analysis_error on failure.
+     * \throws a \ref semantic_error if analysis fails, or a
+     * \ref scenario_error if a component can't be built.
      */
     std::shared_ptr<simulation> extract_simulation();
 
@@ -78,12 +152,202 @@ public:
      */
     std::shared_ptr<component> extract_component();
 
+    /**
+     * \brief Extract a composite definition from the analyzer.
+     *
+     * The components of the module become the children of the composite, its
+     * wires become nets, and its exported wires become the composite's pins.
+     * The definition can be registered as a component type with
+     * \ref register_composite.
+     *
+     * \returns a shared composite definition on success.
+     *
+     * \throws a \ref semantic_error on failure.
+     */
+    std::shared_ptr<const composite_definition> extract_definition();
+
+    /**
+     * \brief Analyze the module and write the result to a netlist cache.
+     *
+     * The cache holds the module along with every pin binding resolved by
+     * analysis, so that \ref read_cache can rebuild the netlist without
+     * lexing, parsing, or looking up pins by name.
+     *
+     * \param path          The path of the cache file.
+     * \param source_hash   The \ref netlist_cache_hash of the source text.
+     *
+     * \throws a \ref semantic_error if analysis fails, or a
+     * \ref netlist_cache_error if the cache can't be written.
+     */
+    void write_cache(const std::string& path, uint64_t source_hash);
+
+    /**
+     * \brief Create an analyzer from a netlist cache.
+     *
+     * \param en            The environment for this analysis.
+     * \param path          The path of the cache file.
+     * \param source_hash   The \ref netlist_cache_hash of the source text.
+     *
+     * Imports are resolved against the directory of the cache file.
+     *
+     * \returns an analyzed semantic_analyzer, or nullptr if the cache is
+     * missing, corrupt, or stale, or if an import or a component's
+     * configuration fails.
+     */
+    static std::shared_ptr<semantic_analyzer> read_cache(
+        std::shared_ptr<environment> en, const std::string& path,
+        uint64_t source_hash);
+
+    /**
+     * \brief Run each execution of a scenario against the netlist.
+     *
+     * Each execution starts at time zero.  A step first checks its
+     * assertions and expectations against the signals at the step time, and
+     * then applies its pin assignments.  Steps are interpreted directly from
+     * the flat AST, so a repeat block runs its body in place, and a scenario
+     * runs in constant memory however many steps it takes.
+     *
+     * \param name          The name of the scenario.
+     * \param log           The stream to which failed expectations are
+     *                      written.
+     *
+     * \returns the number of failed expectations.
+     *
+     * \throws a \ref scenario_error if an assertion fails, or a step can't be
+     * run, or a \ref semantic_error if analysis fails.
+     */
+    int run_scenario(const std::string& name, std::ostream& log);
+
+    /**
+     * \brief Run every scenario in the module, in source order.
+     *
+     * \param log           The stream to which failed expectations are
+     *                      written.
+     *
+     * \returns the number of failed expectations.
+     *
+     * \throws a \ref scenario_error if an assertion fails, or a step can't be
+     * run, or a \ref semantic_error if analysis fails.
+     */
+    int run_scenarios(std::ostream& log);
+
+    /**
+     * \brief Record what each component adds to its wires as it is built, so
+     * that \ref update can replace components in place.  This must be called
+     * before the netlist is built.
+     */
+    void enable_updates();
+
+    /**
+     * \brief Update the analyzed netlist to match an edited module.
+     *
+     * The new module is compared with the current one.  A component whose
+     * type, configuration, and pin bindings are unchanged is kept, along with
+     * its state, and so is every wire whose name is unchanged.  Every other
+     * component is detached from its wires and built anew.  Pending agenda
+     * events are discarded.  On failure, the netlist is left as it was.
+     *
+     * Imported modules are shared for the life of the environment, so an
+     * edit to an imported file is not seen.
+     *
+     * \param mod           The edited module.
+     *
+     * \returns the changes made to the netlist.
+     *
+     * \throws a \ref semantic_error if the new module fails analysis or
+     * updates were not enabled, or a \ref scenario_error if a rebuilt
+     * component can't be built.
+     */
+    netlist_update update(std::shared_ptr<const flat_module> mod);
+
 private:
+
+    /**
+     * \brief An element of a connection that names a component not yet
+     * parsed.
+     */
+    struct pending_connection
+    {
+        int wire;
+        int connection;
+        int element;
+    };
+
+    /**
+     * \brief The dense ids of the components or wires declared with a name.
+     * A name may be declared as a scalar and as an array.  Unused ids are -1.
+     */
+    struct element_range
+    {
+        int scalar;
+        int first;
+        int count;
+    };
+
+    /**
+     * \brief The name of a component or wire element: the text of its name
+     * symbol and its index, or -1 for a scalar.  The hash is built from both
+     * when the key is made; equal hashes are confirmed by the name.
+     */
+    struct element_key
+    {
+        std::uint64_t hash;
+        std::string name;
+        int index;
+
+        bool operator==(const element_key& other) const
+        {
+            return
+                hash == other.hash && index == other.index
+             && name == other.name;
+        }
+    };
+
+    struct element_key_hash
+    {
+        std::size_t operator()(const element_key& key) const
+        {
+            return key.hash;
+        }
+    };
+
+    /**
+     * \brief The signature of a component or wire element, keyed by its
+     * name, so that an update can find what an edit changed.
+     */
+    struct element_signature
+    {
+        std::uint64_t signature;
+        int index;
+        int item;
+        int element;
+    };
+
+    typedef
+    std::unordered_map<element_key, element_signature, element_key_hash>
+    signature_map;
+
     std::shared_ptr<environment> env;
-    std::shared_ptr<config_ast_module> module;
-    std::map<std::string, std::shared_ptr<component>> component_map;
-    std::map<std::string, std::shared_ptr<wire>> wire_map;
+    std::shared_ptr<const flat_module> module;
+    std::string directory;
+    /* the arena is declared first so it outlives everything built in it. */
+    std::shared_ptr<netlist_arena> arena;
+    /* components and wires are numbered densely, in module order.  Their
+     * names are only formatted for diagnostics. */
+    std::vector<std::shared_ptr<component>> component_list;
+    std::vector<std::shared_ptr<wire>> wire_list;
+    /* the ids declared with each name, by symbol id. */
+    std::vector<element_range> component_ids;
+    std::vector<element_range> wire_ids;
+    std::vector<pending_connection> pending;
+    /* streamed imports not yet imported, which are imported together. */
+    std::vector<std::string> pending_imports;
     bool analyzed;
+    bool updates;
+    /* the owner of each component, by id. */
+    std::vector<std::unique_ptr<wire_owner>> owners;
+    signature_map component_signatures;
+    signature_map wire_signatures;
 
     /**
      * \brief Perform analysis on the AST, verifying all details.
@@ -91,8 +355,43 @@ private:
      * \throws a \ref semantic_error on failure.
      */
     void analyze();
+    void analyze_imports();
+    void import_modules(const std::vector<std::string>& paths);
+    void reserve_netlist();
     void analyze_components();
     void analyze_wires();
+    void create_component(
+        const flat_module& mod, const flat_ast_component& c, int element);
+    int add_component(
+        const flat_module& mod, const flat_ast_component& c, int element,
+        std::shared_ptr<component> comp);
+    wire* create_wire(
+        const flat_module& mod, const flat_ast_wire& w, int element);
+    int add_wire(
+        const flat_module& mod, const flat_ast_wire& w, int element,
+        std::shared_ptr<wire> wp);
+    static int find_element(
+        const std::vector<element_range>& ids, int name, int index);
+    static std::string component_name(const flat_module& mod, int id);
+    void connect(const flat_module& mod, int w, int conn, bool required);
+    bool bind_connection(
+        const flat_module& mod, int w, int conn, int element, bool required);
+    virtual void on_module(const flat_module& mod) override;
+    void import_pending();
+    virtual void on_import(const flat_module& mod, int i) override;
+    virtual void on_component(const flat_module& mod, int c) override;
+    virtual void on_wire(const flat_module& mod, int w) override;
+    virtual void on_connection(
+        const flat_module& mod, int w, int conn) override;
+    virtual void on_module_end(const flat_module& mod) override;
+    void bind_wires(const netlist_cache_target* targets, size_t count);
+    void build_component(const flat_module& mod, int id, wire_owner* owner);
+    void build_netlist();
+    int run_steps(
+        const std::string& where, int first, int count, double& time,
+        std::ostream& log);
+    static void advance_to(double time);
+    static uint64_t pin_fingerprint(const component& comp);
 };
 
 } /* namespace homesim */
@@ -13,20 +13,194 @@
 # error This file requires C++14 or greater.
 #endif
 
-#include <homesim/parser.h>
+#include <cstddef>
+#include <homesim/agenda.h>
+#include <homesim/netlist_arena.h>
+#include <homesim/wire.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace homesim {
 
+/* forward declarations. */
+class component;
+class semantic_analyzer;
+
+/**
+ * \brief This exception is thrown when a simulation is asked to drive a net
+ * that is not an input, to read a port that does not exist, or to run
+ * backwards in time.
+ */
+class simulation_error : public std::runtime_error
+{
+public:
+    simulation_error(const std::string& what)
+        : runtime_error(what)
+    {
+    }
+};
+
+/**
+ * \brief A component pin bound to a net.
+ */
+struct simulation_pin
+{
+    int component;
+    int pin;
+};
+
 /**
  * \brief A container that holds the simulation.
+ *
+ * A simulation owns a built netlist: its component instances and nets are
+ * held in contiguous arrays, indexed by the dense ids assigned during
+ * analysis, and the fanout of each net is a contiguous range of component
+ * pins.  Names are only kept for the ports, which are the exported wires and
+ * the wires with an external signal source; only the latter are inputs.
+ *
+ * The simulation has its own agenda, so its time and pending events are
+ * independent of any scenario run by the analyzer, and of any other
+ * simulation.  Nets start out false, and nothing is evaluated until an input
+ * changes.
  */
 class simulation
 {
 public:
     /**
-     * \brief Default constructor for simulation.
+     * \brief Default constructor for simulation, which creates an empty
+     * simulation.  Use \ref semantic_analyzer::extract_simulation to create a
+     * simulation of a module.
      */
     simulation();
+
+    simulation(const simulation&) = delete;
+    simulation& operator=(const simulation&) = delete;
+
+    /**
+     * \brief Find a port by name.
+     *
+     * \param name      The name of the wire, such as "in" or "bus[3]".
+     *
+     * \returns the net id of the port, or -1 if there is no such port.
+     */
+    int find_port(const std::string& name) const;
+
+    /**
+     * \brief Drive an input to the given signal at the current time.
+     *
+     * \param net       The net id of the input.
+     * \param signal    The new signal.
+     *
+     * \throws a \ref simulation_error if the net is not an input.
+     */
+    void set_input(int net, bool signal);
+
+    /**
+     * \brief Drive an input to the given signal at the current time.
+     *
+     * \param name      The name of the input.
+     * \param signal    The new signal.
+     *
+     * \throws a \ref simulation_error if there is no such input.
+     */
+    void set_input(const std::string& name, bool signal);
+
+    /**
+     * \brief Get the current signal of a net.
+     *
+     * \param net       The net id.
+     */
+    bool get_signal(int net) const;
+
+    /**
+     * \brief Get the current signal of a port.
+     *
+     * \param name      The name of the port.
+     *
+     * \throws a \ref simulation_error if there is no such port.
+     */
+    bool get_signal(const std::string& name) const;
+
+    /**
+     * \brief Run every event scheduled up to the given time, leaving later
+     * events pending.
+     *
+     * \param time      The time to run to, in seconds.
+     *
+     * \throws a \ref simulation_error if the time is before the current time.
+     */
+    void run_until(double time);
+
+    /**
+     * \brief Get the current simulation time, in seconds.
+     */
+    double current_time() const;
+
+    /**
+     * \brief Get the number of component instances.
+     */
+    std::size_t component_count() const;
+
+    /**
+     * \brief Get the number of nets.
+     */
+    std::size_t net_count() const;
+
+    /**
+     * \brief Get the component pins bound to a net.
+     *
+     * \param net       The net id.
+     *
+     * \returns the range of pins, as a pair of begin and end pointers.
+     */
+    std::pair<const simulation_pin*, const simulation_pin*> fanout(
+        int net) const;
+
+private:
+    friend class semantic_analyzer;
+
+    /**
+     * \brief Make the agenda of a simulation the global agenda for the
+     * lifetime of this scope, so that components schedule their events on
+     * it.
+     */
+    class schedule_scope
+    {
+    public:
+        explicit schedule_scope(simulation& sim);
+        ~schedule_scope();
+
+        schedule_scope(const schedule_scope&) = delete;
+        schedule_scope& operator=(const schedule_scope&) = delete;
+
+    private:
+        agenda& schedule;
+    };
+
+    /**
+     * \brief A named wire on the boundary of the simulation.
+     */
+    struct port
+    {
+        int net;
+        bool input;
+    };
+
+    /* the arena is declared first so it outlives everything built in it. */
+    std::shared_ptr<netlist_arena> arena;
+    std::vector<std::shared_ptr<component>> component_list;
+    std::vector<std::shared_ptr<wire>> net_list;
+    /* the pins of net i are fanout_list[fanout_first[i]] up to
+     * fanout_list[fanout_first[i + 1]]. */
+    std::vector<int> fanout_first;
+    std::vector<simulation_pin> fanout_list;
+    std::vector<bool> inputs;
+    std::unordered_map<std::string, port> ports;
+    agenda schedule;
 };
 
 } /* namespace homesim */
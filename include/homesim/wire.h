@@ -14,10 +14,14 @@
 #endif
 
 #include <functional>
+#include <homesim/netlist_arena.h>
 #include <list>
+#include <vector>
 
 namespace homesim {
 
+class wire_owner;
+
 /**
  * \brief Types of connections that can be made to a wire.
  */
@@ -53,6 +57,14 @@ public:
      */
     wire();
 
+    /**
+     * \brief Constructor for a wire whose fanout records live in an arena.
+     *
+     * \param arena     The arena for this wire's action lists, or nullptr to
+     *                  use the heap.  The arena must outlive this wire.
+     */
+    explicit wire(netlist_arena* arena);
+
     /**
      * \brief Add a connection of the given type, enabling DRC checks.
      *
@@ -158,6 +170,8 @@ public:
     bool has_fault() const;
 
 private:
+    friend class wire_owner;
+
     bool signal;
     bool floating;
     bool fault;
@@ -167,8 +181,12 @@ private:
     int pull_downs;
     int pull_ups;
 
-    std::list<std::function<void ()>> actions;
-    std::list<std::function<void ()>> state_change_actions;
+    typedef std::list<
+        std::function<void ()>, arena_allocator<std::function<void ()>>>
+    action_list;
+
+    action_list actions;
+    action_list state_change_actions;
 
     /**
      * \brief Perform an adjustment on a connection type counter.
@@ -182,6 +200,95 @@ private:
      * \brief Perform a fault check on this wire.
      */
     void fault_check();
+
+    /**
+     * \brief Wrap an action so that it runs with the current wire owner, if
+     * any, and record it for that owner once added to the given list.
+     */
+    void add_owned_action(action_list& list, std::function<void ()> action);
+};
+
+/**
+ * \brief A wire owner records the actions and connections that a component
+ * adds to wires, so that they can be removed when the component is replaced.
+ *
+ * Changes are recorded for the owner that is current on this thread; see
+ * \ref wire_owner::scope.  Actions and agenda events added while an owner is
+ * current run with that owner current, so the connection changes that they
+ * make later are recorded too.  With no current owner, nothing is recorded.
+ */
+class wire_owner
+{
+public:
+
+    /**
+     * \brief Make a wire owner current on this thread for the lifetime of
+     * this scope.
+     */
+    class scope
+    {
+    public:
+
+        /**
+         * \brief Make the given owner current.
+         *
+         * \param owner     The owner, or nullptr to record nothing.
+         */
+        explicit scope(wire_owner* owner);
+
+        /**
+         * \brief Restore the previously current owner.
+         */
+        ~scope();
+
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+
+    private:
+        wire_owner* previous;
+    };
+
+    /**
+     * \brief Create a wire owner with nothing recorded.
+     */
+    wire_owner();
+
+    wire_owner(const wire_owner&) = delete;
+    wire_owner& operator=(const wire_owner&) = delete;
+
+    /**
+     * \brief Remove every action recorded for this owner, and undo every
+     * connection change.  The wires must still be alive.
+     */
+    void detach();
+
+    /**
+     * \brief Get the wire owner that is current on this thread.
+     *
+     * \returns the current owner, or nullptr if there is none.
+     */
+    static wire_owner* current();
+
+private:
+    friend class wire;
+
+    struct action_record
+    {
+        wire::action_list* list;
+        wire::action_list::iterator action;
+    };
+
+    struct connection_record
+    {
+        wire* w;
+        wire_connection_type type;
+        int adjustment;
+    };
+
+    std::vector<action_record> actions;
+    std::vector<connection_record> connections;
+
+    static thread_local wire_owner* current_owner;
 };
 
 } /* namespace homesim */
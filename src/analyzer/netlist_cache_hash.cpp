@@ -0,0 +1,34 @@
+/**
+ * \file analyzer/netlist_cache_hash.cpp
+ *
+ * \brief Compute the content hash that keys a netlist cache.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/netlist_cache.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Compute the content hash that keys a netlist cache.
+ *
+ * This is a 64-bit FNV-1a hash.
+ *
+ * \param begin         The start of the source text.
+ * \param end           One past the end of the source text.
+ *
+ * \returns the hash of the source text.
+ */
+uint64_t homesim::netlist_cache_hash(const char* begin, const char* end)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (const char* i = begin; i != end; ++i)
+    {
+        hash ^= static_cast<unsigned char>(*i);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
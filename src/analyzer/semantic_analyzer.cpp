@@ -5,6 +5,7 @@
  *
  * \copyright Copyright 2020 Justin Handville. All rights reserved.
  */
+#include <homesim/netlist_arena.h>
 #include <homesim/semantic_analyzer.h>
 
 using namespace homesim;
@@ -19,8 +20,31 @@ using namespace std;
 homesim::semantic_analyzer::semantic_analyzer(
     std::shared_ptr<environment> en,
     std::shared_ptr<config_ast_module> mod)
+        : env(en)
+        , module(make_flat_module(*mod))
+        , arena(make_shared<netlist_arena>())
+        , analyzed(false)
+        , updates(false)
+{
+}
+
+/**
+ * \brief Semantic analyzer for a flat homesim AST.
+ *
+ * \param en                The environment for this analysis.
+ * \param mod               The flat module to analyze.
+ * \param dir               The directory against which relative import paths
+ *                          are resolved, or empty for the current directory.
+ */
+homesim::semantic_analyzer::semantic_analyzer(
+    std::shared_ptr<environment> en,
+    std::shared_ptr<const flat_module> mod,
+    const std::string& dir)
         : env(en)
         , module(mod)
+        , directory(dir)
+        , arena(make_shared<netlist_arena>())
         , analyzed(false)
+        , updates(false)
 {
 }
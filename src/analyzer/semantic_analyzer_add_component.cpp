@@ -0,0 +1,60 @@
+/**
+ * \file analyzer/semantic_analyzer_add_component.cpp
+ *
+ * \brief Give an element of a component its dense id.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Add an element of a component to the netlist, giving it the next
+ * dense id.  The ids of an array are claimed with its first element.
+ *
+ * \param mod           The module that holds the component.
+ * \param c             The component.
+ * \param element       The element of a component array, or zero.
+ * \param comp          The component object, which may be set later.
+ *
+ * \returns the id of the element.
+ *
+ * \throws a \ref semantic_error if the name is already defined.
+ */
+int homesim::semantic_analyzer::add_component(
+    const flat_module& mod, const flat_ast_component& c, int element,
+    shared_ptr<component> comp)
+{
+    int id = component_list.size();
+
+    if (0 == element)
+    {
+        if ((size_t)c.name >= component_ids.size())
+            component_ids.resize(
+                mod.symbols.size(), element_range{ -1, -1, 0 });
+
+        /* verify that a component by this name does not already exist. */
+        auto& range = component_ids[c.name];
+        if ((0 == c.count && range.scalar >= 0)
+         || (c.count > 0 && range.first >= 0))
+            throw semantic_error(
+                string("Duplicate definition for component ")
+              + mod.element_name(c.name, c.count, 0) + " found.");
+
+        if (0 == c.count)
+        {
+            range.scalar = id;
+        }
+        else
+        {
+            range.first = id;
+            range.count = c.count;
+        }
+    }
+
+    component_list.push_back(comp);
+
+    return id;
+}
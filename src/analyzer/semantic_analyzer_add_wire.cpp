@@ -0,0 +1,59 @@
+/**
+ * \file analyzer/semantic_analyzer_add_wire.cpp
+ *
+ * \brief Give an element of a wire its dense id.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Add an element of a wire to the netlist, giving it the next dense
+ * id.  The ids of an array are claimed with its first element.
+ *
+ * \param mod           The module that holds the wire.
+ * \param w             The wire.
+ * \param element       The element of a wire array, or zero.
+ * \param wp            The wire object.
+ *
+ * \returns the id of the element.
+ *
+ * \throws a \ref semantic_error if the name is already defined.
+ */
+int homesim::semantic_analyzer::add_wire(
+    const flat_module& mod, const flat_ast_wire& w, int element,
+    shared_ptr<wire> wp)
+{
+    int id = wire_list.size();
+
+    if (0 == element)
+    {
+        if ((size_t)w.name >= wire_ids.size())
+            wire_ids.resize(mod.symbols.size(), element_range{ -1, -1, 0 });
+
+        /* verify that a wire by this name does not already exist. */
+        auto& range = wire_ids[w.name];
+        if ((0 == w.count && range.scalar >= 0)
+         || (w.count > 0 && range.first >= 0))
+            throw semantic_error(
+                string("Duplicate definition for wire ")
+              + mod.element_name(w.name, w.count, 0) + " found.");
+
+        if (0 == w.count)
+        {
+            range.scalar = id;
+        }
+        else
+        {
+            range.first = id;
+            range.count = w.count;
+        }
+    }
+
+    wire_list.push_back(wp);
+
+    return id;
+}
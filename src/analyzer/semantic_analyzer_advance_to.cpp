@@ -0,0 +1,36 @@
+/**
+ * \file analyzer/semantic_analyzer_advance_to.cpp
+ *
+ * \brief Run the simulation up to a given time.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/agenda.h>
+#include <homesim/semantic_analyzer.h>
+#include <memory>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Run every agenda action scheduled up to the given time, leaving
+ * later actions on the agenda.
+ *
+ * \param time          The time to run to, in seconds.
+ */
+void homesim::semantic_analyzer::advance_to(double time)
+{
+    /* a marker action stops the run once the agenda reaches the time.  It owns
+     * its flag, so if an action throws and leaves it queued, it is harmless
+     * when it runs later. */
+    auto reached = make_shared<bool>(false);
+    global_agenda.add(
+        time - global_agenda.current_time(), [reached]() { *reached = true; });
+
+    while (!*reached)
+    {
+        auto a = global_agenda.next();
+        global_agenda.pop();
+        a.second();
+    }
+}
@@ -24,12 +24,20 @@ void homesim::semantic_analyzer::analyze()
         return;
 
     /* the name should not be blank. */
-    if (string("") == module->name)
+    if (module->name < 0 || module->symbols.str(module->name).empty())
         throw semantic_error("Invalid module name.");
 
+    /* imported modules define component types, so they come first. */
+    analyze_imports();
+
+    /* size the arena for the whole netlist up front. */
+    reserve_netlist();
+
     /* perform component analysis. */
     analyze_components();
 
     /* perform wire analysis. */
     analyze_wires();
+
+    analyzed = true;
 }
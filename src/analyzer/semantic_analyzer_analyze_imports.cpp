@@ -0,0 +1,27 @@
+/**
+ * \file analyzer/semantic_analyzer_analyze_imports.cpp
+ *
+ * \brief Import each module file named by the module.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Import each module file named by the module, registering each
+ * imported module as a component type.
+ *
+ * \throws a \ref semantic_error on failure.
+ */
+void homesim::semantic_analyzer::analyze_imports()
+{
+    vector<string> paths;
+    paths.reserve(module->imports.size());
+    for (auto i : module->imports)
+        paths.push_back(module->symbols.str(i));
+
+    import_modules(paths);
+}
@@ -0,0 +1,37 @@
+/**
+ * \file analyzer/semantic_analyzer_analyze_stream.cpp
+ *
+ * \brief Parse a module and analyze it as it is parsed.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Parse a module and analyze it as it is parsed.
+ *
+ * \param en            The environment for this analysis.
+ * \param p             The parser for the module.
+ * \param directory     The directory against which relative import paths are
+ *                      resolved, or empty for the current directory.
+ *
+ * \returns an analyzed semantic_analyzer on success.
+ *
+ * \throws a \ref parser_error or \ref semantic_error on failure.
+ */
+shared_ptr<semantic_analyzer> homesim::semantic_analyzer::analyze_stream(
+    shared_ptr<environment> en, parser& p, const string& directory)
+{
+    auto retval =
+        make_shared<semantic_analyzer>(
+            en, shared_ptr<const flat_module>(), directory);
+
+    /* the analyzer builds the netlist from the parse events. */
+    retval->module = p.parse_flat(*retval);
+    retval->analyzed = true;
+
+    return retval;
+}
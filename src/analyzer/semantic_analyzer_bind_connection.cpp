@@ -0,0 +1,79 @@
+/**
+ * \file analyzer/semantic_analyzer_bind_connection.cpp
+ *
+ * \brief Bind a wire to the component pin named by a connection.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Bind a wire to the component pin named by an element of a
+ * connection.  The component and wire are found by id; their names are only
+ * formatted for diagnostics.
+ *
+ * \param mod           The module that holds the wire.
+ * \param w             The index of the wire.
+ * \param conn          The index of the connection.
+ * \param element       The element of the connection.
+ * \param required      If false, a connection to an undefined component is
+ *                      not an error.
+ *
+ * \returns false if the component is undefined and the connection is not
+ * required, otherwise true.
+ *
+ * \throws a \ref semantic_error on failure.
+ */
+bool homesim::semantic_analyzer::bind_connection(
+    const flat_module& mod, int w, int conn, int element, bool required)
+{
+    auto& wd = mod.wires[w];
+    int k = wd.count > 0 ? element : 0;
+
+    /* look up the component. */
+    int id =
+        find_element(
+            component_ids, mod.connections[conn].component,
+            mod.connection_element(conn, element));
+    if (id < 0 && !required)
+        return false;
+
+    string component, pin;
+    if (id < 0)
+    {
+        mod.connection_target(conn, element, component, pin);
+        throw semantic_error(
+            string("In wire ") + mod.element_name(wd.name, wd.count, k)
+            + ": reference to unknown component " + component + ".");
+    }
+
+    /* attempt to set the pin with this wire. */
+    int wire_id = find_element(wire_ids, wd.name, wd.count > 0 ? k : -1);
+    try
+    {
+        component_list[id]->set_pin(
+            mod.connection_pin(conn, element), wire_list[wire_id].get());
+    }
+    catch (invalid_pin_error& e)
+    {
+        mod.connection_target(conn, element, component, pin);
+        throw semantic_error(
+            string("In wire ") + mod.element_name(wd.name, wd.count, k)
+          + ": reference to unknown pin " + component
+          + ".pin[\"" + pin + "\"].");
+    }
+    catch (pin_binding_error& e)
+    {
+        mod.connection_target(conn, element, component, pin);
+        throw semantic_error(
+            string("In wire ") + mod.element_name(wd.name, wd.count, k)
+          + ": pin " + component
+          + ".pin[\"" + pin + "\"] is already bound.");
+    }
+
+    return true;
+}
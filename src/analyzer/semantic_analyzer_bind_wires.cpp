@@ -0,0 +1,46 @@
+/**
+ * \file analyzer/semantic_analyzer_bind_wires.cpp
+ *
+ * \brief Bind wires to pins resolved by an earlier analysis.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <algorithm>
+#include <homesim/component.h>
+#include <homesim/netlist_cache.h>
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Create the wires of the module and bind them to the given targets.
+ *
+ * This is the counterpart of \ref analyze_wires for a netlist cache.  The
+ * module has already been analyzed, so each binding is made by wire,
+ * component, and pin index instead of by name.
+ *
+ * \param targets       The bindings resolved by analysis.
+ * \param count         The number of bindings.
+ *
+ * \throws
+ *      - \ref invalid_pin_error if a pin index is invalid.
+ *      - \ref pin_binding_error if a pin is already bound.
+ */
+void homesim::semantic_analyzer::bind_wires(
+    const netlist_cache_target* targets, size_t count)
+{
+    for (auto& i : module->wires)
+    {
+        for (int k = 0; k < max(i.count, 1); ++k)
+            create_wire(*module, i, k);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto& target = targets[i];
+
+        component_list[target.component]->set_pin(
+            target.pin, wire_list[target.wire].get());
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * \file analyzer/semantic_analyzer_build_component.cpp
+ *
+ * \brief Build a component element of the netlist.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+#include <homesim/ic/paged_memory.h>
+#include <homesim/ic/rom.h>
+#include <homesim/ic/rom_image.h>
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Build a component element, reporting a build error with the name of
+ * the component.
+ *
+ * \param mod           The module that holds the component.
+ * \param id            The id of the component element.
+ * \param owner         The owner recording what the build adds to wires, or
+ *                      nullptr.
+ *
+ * \throws a \ref scenario_error if the component has an unbound pin, is
+ * missing configuration, or can't load its image.
+ */
+void homesim::semantic_analyzer::build_component(
+    const flat_module& mod, int id, wire_owner* owner)
+{
+    wire_owner::scope s(owner);
+
+    auto in_component = [&](const exception& e) {
+        return scenario_error(
+            string("In component ") + component_name(mod, id) + ": "
+          + e.what());
+    };
+
+    /* these are the errors a component throws when it can't be built. */
+    try
+    {
+        component_list[id]->build();
+    }
+    catch (missing_wire_error& e)
+    {
+        throw in_component(e);
+    }
+    catch (invalid_config_error& e)
+    {
+        throw in_component(e);
+    }
+    catch (rom_image_error& e)
+    {
+        throw in_component(e);
+    }
+    catch (rom_mismatch_error& e)
+    {
+        throw in_component(e);
+    }
+    catch (memory_error& e)
+    {
+        throw in_component(e);
+    }
+}
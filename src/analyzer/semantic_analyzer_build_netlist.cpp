@@ -0,0 +1,39 @@
+/**
+ * \file analyzer/semantic_analyzer_build_netlist.cpp
+ *
+ * \brief Build every component in the netlist.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Build every component in the netlist, so that it can be simulated.
+ * Building a component twice has no effect.
+ *
+ * \throws a \ref scenario_error if a component has an unbound pin, is
+ * missing configuration, or can't load its image.
+ */
+void homesim::semantic_analyzer::build_netlist()
+{
+    if (updates)
+        owners.resize(component_list.size());
+
+    for (size_t i = 0; i < component_list.size(); ++i)
+    {
+        /* with updates enabled, record what the build adds to wires. */
+        wire_owner* owner = nullptr;
+        if (updates)
+        {
+            if (!owners[i])
+                owners[i] = make_unique<wire_owner>();
+            owner = owners[i].get();
+        }
+
+        build_component(*module, i, owner);
+    }
+}
@@ -0,0 +1,36 @@
+/**
+ * \file analyzer/semantic_analyzer_component_name.cpp
+ *
+ * \brief Get the name of a component element, for diagnostics.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <algorithm>
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the name of a component element.  Names are not kept, so this
+ * walks the module; it is only used for diagnostics.
+ *
+ * \param mod           The module that holds the component.
+ * \param id            The id of the component element.
+ *
+ * \returns the name of the element.
+ */
+string homesim::semantic_analyzer::component_name(
+    const flat_module& mod, int id)
+{
+    for (auto& c : mod.components)
+    {
+        int count = max(c.count, 1);
+        if (id < count)
+            return mod.element_name(c.name, c.count, id);
+
+        id -= count;
+    }
+
+    return string();
+}
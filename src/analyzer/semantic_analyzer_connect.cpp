@@ -0,0 +1,37 @@
+/**
+ * \file analyzer/semantic_analyzer_connect.cpp
+ *
+ * \brief Bind the elements of a wire to the pins named by a connection.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Bind the elements of a wire to the pins named by a connection.
+ *
+ * Element i of a wire array binds to element i of the connection.  A scalar
+ * wire binds to every element of the connection.
+ *
+ * \param mod           The module that holds the wire.
+ * \param w             The index of the wire.
+ * \param conn          The index of the connection.
+ * \param required      If false, a pin of an undefined component is deferred
+ *                      until the end of the module.
+ *
+ * \throws a \ref semantic_error on failure.
+ */
+void homesim::semantic_analyzer::connect(
+    const flat_module& mod, int w, int conn, bool required)
+{
+    int width = mod.connection_width(conn);
+
+    for (int j = 0; j < width; ++j)
+    {
+        if (!bind_connection(mod, w, conn, j, required))
+            pending.push_back(pending_connection{ w, conn, j });
+    }
+}
@@ -0,0 +1,78 @@
+/**
+ * \file analyzer/semantic_analyzer_create_component.cpp
+ *
+ * \brief Create and configure a component of the module.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+#include <homesim/environment.h>
+#include <homesim/netlist_arena.h>
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Create and configure an element of a component, giving it the next
+ * dense id.  A scalar component has the single element zero.
+ *
+ * \param mod           The module that holds the component.
+ * \param c             The component to create.
+ * \param element       The element of a component array to create.
+ *
+ * \throws a \ref semantic_error on failure.
+ */
+void homesim::semantic_analyzer::create_component(
+    const flat_module& mod, const flat_ast_component& c, int element)
+{
+    int id = add_component(mod, c, element, nullptr);
+
+    /* verify that the component's type is specified. */
+    if (c.type < 0)
+        throw semantic_error(
+            string("Component ") + mod.element_name(c.name, c.count, element)
+          + " is missing a type.");
+
+    string type = mod.symbols.str(c.type);
+
+    try
+    {
+        /* look up the component from the environment by type. */
+        auto component = env->get_component_factory().create(type, *arena);
+
+        /* apply the component configuration. */
+        for (int i = 0; i < c.config_count; ++i)
+        {
+            auto& config = mod.configs[c.first_config + i];
+
+            try
+            {
+                component->configure(
+                    mod.symbols.str(config.key),
+                    mod.value(config.expression));
+            }
+            catch (invalid_config_error& e)
+            {
+                throw semantic_error(
+                    string("In component ")
+                  + mod.element_name(c.name, c.count, element) + ": "
+                  + e.what());
+            }
+            catch (config_value_error& e)
+            {
+                throw semantic_error(
+                    string("In component ")
+                  + mod.element_name(c.name, c.count, element) + ": "
+                  + e.what());
+            }
+        }
+
+        component_list[id] = component;
+    }
+    catch (unknown_component_error& e)
+    {
+        throw semantic_error(
+            string("Component type ") + type + " can't be found.");
+    }
+}
@@ -0,0 +1,36 @@
+/**
+ * \file analyzer/semantic_analyzer_create_wire.cpp
+ *
+ * \brief Create a wire of the module.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/netlist_arena.h>
+#include <homesim/semantic_analyzer.h>
+#include <homesim/wire.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Create an element of a wire, giving it the next dense id.
+ *
+ * \param mod           The module that holds the wire.
+ * \param w             The wire to create.
+ * \param element       The element to create, if the wire is an array.
+ *
+ * \returns the new wire.
+ *
+ * \throws a \ref semantic_error if the wire is already defined.
+ */
+wire* homesim::semantic_analyzer::create_wire(
+    const flat_module& mod, const flat_ast_wire& w, int element)
+{
+    auto retval =
+        allocate_shared<wire>(
+            arena_allocator<wire>(arena.get()), arena.get());
+
+    add_wire(mod, w, element, retval);
+
+    return retval.get();
+}
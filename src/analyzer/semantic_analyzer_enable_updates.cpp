@@ -0,0 +1,21 @@
+/**
+ * \file analyzer/semantic_analyzer_enable_updates.cpp
+ *
+ * \brief Enable in-place updates of the netlist.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Record what each component adds to its wires as it is built, so that
+ * \ref update can replace components in place.  This must be called before
+ * the netlist is built.
+ */
+void homesim::semantic_analyzer::enable_updates()
+{
+    updates = true;
+}
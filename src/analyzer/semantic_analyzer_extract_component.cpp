@@ -0,0 +1,26 @@
+/**
+ * \file analyzer/semantic_analyzer_extract_component.cpp
+ *
+ * \brief Extract a component from the analyzer.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Extract a component from the analyzer.
+ *
+ * The component is an unbound instance of the module's composite definition.
+ *
+ * \returns a component on success.
+ *
+ * \throws a \ref semantic_analysis_error on failure.
+ */
+shared_ptr<component> homesim::semantic_analyzer::extract_component()
+{
+    return composite_definition::instantiate(extract_definition());
+}
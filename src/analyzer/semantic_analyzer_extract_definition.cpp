@@ -0,0 +1,103 @@
+/**
+ * \file analyzer/semantic_analyzer_extract_definition.cpp
+ *
+ * \brief Extract a composite definition from the analyzer.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <algorithm>
+#include <homesim/composite.h>
+#include <homesim/environment.h>
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Extract a composite definition from the analyzer.
+ *
+ * The components of the module become the children of the composite, its
+ * wires become nets, and its exported wires become the composite's pins.
+ *
+ * \returns a shared composite definition on success.
+ *
+ * \throws a \ref semantic_error on failure.
+ */
+shared_ptr<const composite_definition>
+homesim::semantic_analyzer::extract_definition()
+{
+    /* run analysis, which verifies the components, wires, and pins. */
+    analyze();
+
+    auto def = make_shared<composite_definition>(env->get_component_factory());
+    vector<int> children;
+
+    try
+    {
+        /* arrays become a child or net per element. */
+        for (auto& c : module->components)
+        {
+            for (int k = 0; k < max(c.count, 1); ++k)
+            {
+                int child =
+                    def->add_child(
+                        module->element_name(c.name, c.count, k),
+                        module->symbols.str(c.type));
+                children.push_back(child);
+
+                for (int i = 0; i < c.config_count; ++i)
+                {
+                    auto& config = module->configs[c.first_config + i];
+                    def->configure_child(
+                        child, module->symbols.str(config.key),
+                        module->eval(config.expression));
+                }
+            }
+        }
+
+        for (auto& w : module->wires)
+        {
+            int first_net = -1;
+            for (int k = 0; k < max(w.count, 1); ++k)
+            {
+                int net =
+                    def->add_net(
+                        module->element_name(w.name, w.count, k),
+                        w.exported);
+                if (first_net < 0)
+                    first_net = net;
+            }
+
+            for (int i = 0; i < w.connection_count; ++i)
+            {
+                int conn = w.first_connection + i;
+                int width = module->connection_width(conn);
+
+                /* children are added in id order. */
+                for (int j = 0; j < width; ++j)
+                {
+                    int id =
+                        find_element(
+                            component_ids,
+                            module->connections[conn].component,
+                            module->connection_element(conn, j));
+                    def->connect(
+                        first_net + (w.count > 0 ? j : 0), children[id],
+                        module->connection_pin(conn, j));
+                }
+            }
+        }
+
+        /* build the pin table now, so that a repeated pin name is reported
+         * here rather than by the first instance. */
+        def->pin_table();
+    }
+    catch (invalid_pin_error& e)
+    {
+        throw semantic_error(
+            string("In module ") + module->symbols.str(module->name) + ": "
+          + e.what());
+    }
+
+    return def;
+}
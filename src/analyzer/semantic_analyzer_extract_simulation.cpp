@@ -5,6 +5,8 @@
  *
  * \copyright Copyright 2020 Justin Handville. All rights reserved.
  */
+#include <algorithm>
+#include <homesim/component.h>
 #include <homesim/semantic_analyzer.h>
 #include <homesim/simulation.h>
 
@@ -14,16 +16,119 @@ using namespace std;
 /**
  * \brief Extract a simulation from the analyzer.
  *
+ * The module is analyzed and built again into a netlist owned by the
+ * simulation, so the analyzer's own netlist, and any scenario run against it,
+ * is unaffected.  A pin left unconnected floats on a net of its own, which
+ * follows the nets of the module.  The components are built with the
+ * simulation's agenda current, so any events they schedule are its own.  The
+ * fanout of each net is gathered from the module, with each pin resolved to
+ * its index.
+ *
  * \returns a simulation on success.
  *
- * \throws a \ref semantic_analysis_error on failure.
+ * \throws a \ref semantic_error if analysis fails, or a \ref scenario_error
+ * if a component can't be built.
  */
 shared_ptr<simulation> homesim::semantic_analyzer::extract_simulation()
 {
-    auto retval = make_shared<simulation>();
-
     /* run analysis. */
     analyze();
 
+    /* imports are already registered, so this only elaborates the module. */
+    semantic_analyzer netlist(env, module, directory);
+    netlist.analyze();
+
+    /* give each unconnected pin a net, so every component can be built. */
+    vector<simulation_pin> floating;
+    for (size_t i = 0; i < netlist.component_list.size(); ++i)
+    {
+        auto& comp = netlist.component_list[i];
+        for (int pin = 0; pin < comp->pins(); ++pin)
+        {
+            if (comp->is_bound(pin))
+                continue;
+
+            auto w =
+                allocate_shared<wire>(
+                    arena_allocator<wire>(netlist.arena.get()),
+                    netlist.arena.get());
+            comp->set_pin(pin, w.get());
+            netlist.wire_list.push_back(w);
+            floating.push_back(simulation_pin{ (int)i, pin });
+        }
+    }
+
+    auto retval = make_shared<simulation>();
+
+    {
+        simulation::schedule_scope s(*retval);
+        netlist.build_netlist();
+    }
+
+    /* gather the pins bound to each net, in net id order. */
+    auto& mod = *module;
+    retval->fanout_first.clear();
+    retval->fanout_first.reserve(netlist.wire_list.size() + 1);
+    retval->fanout_list.reserve(
+        mod.connections.size() + floating.size());
+    retval->inputs.reserve(netlist.wire_list.size());
+
+    auto add_pin = [&](int conn, int element) {
+        int id =
+            find_element(
+                netlist.component_ids, mod.connections[conn].component,
+                mod.connection_element(conn, element));
+        retval->fanout_list.push_back(
+            simulation_pin{
+                id,
+                netlist.component_list[id]->pin_index(
+                    mod.connection_pin(conn, element)) });
+    };
+
+    for (auto& w : mod.wires)
+    {
+        for (int k = 0; k < max(w.count, 1); ++k)
+        {
+            int net = retval->fanout_first.size();
+            retval->fanout_first.push_back(retval->fanout_list.size());
+            retval->inputs.push_back(w.external_source);
+
+            if (w.exported || w.external_source)
+                retval->ports.emplace(
+                    mod.element_name(w.name, w.count, k),
+                    simulation::port{ net, w.external_source });
+
+            /* element k of an array binds element k of each connection; a
+             * scalar binds every element. */
+            for (int i = 0; i < w.connection_count; ++i)
+            {
+                int conn = w.first_connection + i;
+
+                if (w.count > 0)
+                {
+                    add_pin(conn, k);
+                    continue;
+                }
+
+                for (int j = 0; j < mod.connection_width(conn); ++j)
+                    add_pin(conn, j);
+            }
+        }
+    }
+
+    for (auto& pin : floating)
+    {
+        retval->fanout_first.push_back(retval->fanout_list.size());
+        retval->fanout_list.push_back(pin);
+        retval->inputs.push_back(false);
+    }
+
+    retval->fanout_first.push_back(retval->fanout_list.size());
+
+    /* the simulation takes the netlist, arena and all. */
+    retval->arena = move(netlist.arena);
+    retval->component_list.swap(netlist.component_list);
+    retval->net_list.swap(netlist.wire_list);
+
     return retval;
 }
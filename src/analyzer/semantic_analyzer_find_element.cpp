@@ -0,0 +1,35 @@
+/**
+ * \file analyzer/semantic_analyzer_find_element.cpp
+ *
+ * \brief Find the dense id of a component or wire element.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Find the dense id of a component or wire element.
+ *
+ * \param ids           The ids declared with each name.
+ * \param name          The symbol id of the name.
+ * \param index         The array index, or -1 for a scalar.
+ *
+ * \returns the id, or -1 if no such element is defined.
+ */
+int homesim::semantic_analyzer::find_element(
+    const vector<element_range>& ids, int name, int index)
+{
+    if (name < 0 || (size_t)name >= ids.size())
+        return -1;
+
+    auto& range = ids[name];
+    if (index < 0)
+        return range.scalar;
+    else if (index < range.count)
+        return range.first + index;
+    else
+        return -1;
+}
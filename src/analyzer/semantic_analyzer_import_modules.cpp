@@ -0,0 +1,337 @@
+/**
+ * \file analyzer/semantic_analyzer_import_modules.cpp
+ *
+ * \brief Import module files as component types.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <homesim/component.h>
+#include <homesim/composite.h>
+#include <homesim/environment.h>
+#include <homesim/parallel.h>
+#include <homesim/semantic_analyzer.h>
+#include <map>
+#include <set>
+
+using namespace homesim;
+using namespace std;
+
+namespace {
+
+/**
+ * \brief An import of a module file, with the path as written.
+ */
+struct import_edge
+{
+    int unit;
+    string path;
+};
+
+/**
+ * \brief A module file reached through the imports being analyzed.
+ */
+struct import_unit
+{
+    string canonical;
+    string directory;
+    shared_ptr<flat_module> mod;
+    bool unreadable;
+    string parse_error;
+    vector<import_edge> edges;
+
+    /* set by the walk, which follows the serial import order. */
+    string path;
+    string prefix;
+    int level;
+    bool duplicate;
+
+    /* set by analysis. */
+    bool failed;
+    string failure;
+    shared_ptr<const composite_definition> def;
+};
+
+} /* namespace */
+
+/**
+ * \brief Resolve an import path to a canonical path.
+ *
+ * \param directory     The directory of the importing module, or empty for
+ *                      the current directory.
+ * \param path          The path as written.
+ */
+static string resolve(const string& directory, const string& path)
+{
+    filesystem::path file(path);
+    if (file.is_relative() && !directory.empty())
+        file = filesystem::path(directory) / file;
+
+    error_code ec;
+    auto canonical = filesystem::weakly_canonical(file, ec);
+    if (ec)
+        return file.string();
+
+    return canonical.string();
+}
+
+/**
+ * \brief Read and parse a module file.  Errors are recorded in the unit.
+ */
+static void parse_unit(import_unit& unit)
+{
+    try
+    {
+        mapped_file source(unit.canonical);
+        parser p(source.begin(), source.end());
+        unit.mod = p.parse_flat();
+    }
+    catch (mapped_file_error& e)
+    {
+        unit.unreadable = true;
+    }
+    catch (parser_error& e)
+    {
+        unit.parse_error = e.what();
+    }
+}
+
+/**
+ * \brief Analyze a parsed module file.  Any error is recorded in the unit,
+ * rather than escaping the worker.
+ */
+static void analyze_unit(shared_ptr<environment> env, import_unit& unit)
+{
+    try
+    {
+        semantic_analyzer analyzer(env, unit.mod, unit.directory);
+        unit.def = analyzer.extract_definition();
+    }
+    catch (exception& e)
+    {
+        /* any error is recorded, so that errors merge in serial order. */
+        unit.failed = true;
+        unit.failure = e.what();
+    }
+}
+
+/**
+ * \brief Import module files, registering each module as a component type
+ * named after the module.
+ *
+ * Each file is parsed and analyzed once per environment.  The resulting
+ * definition is immutable and shared by every instance, so importing the same
+ * file again, from this module or any other, costs a lookup.  Imports in an
+ * imported file are resolved against that file's directory.
+ *
+ * The files reached through these imports are read and parsed concurrently,
+ * one wave of newly discovered files at a time.  They are then analyzed
+ * concurrently, one level of the import graph at a time, so that every module
+ * is analyzed after the modules it imports are registered.  Registration is
+ * serial and in a fixed order, and if several files fail, the error reported
+ * is the one that importing them one at a time would have reported first.
+ *
+ * \param paths         The paths of the module files.
+ *
+ * \throws a \ref semantic_error if a file can't be read, parsed, or analyzed,
+ * if an import is circular, or if a module name is already a component type.
+ */
+void homesim::semantic_analyzer::import_modules(const vector<string>& paths)
+{
+    auto& factory = env->get_component_factory();
+    unsigned workers = env->get_worker_count();
+    vector<import_unit> units;
+    map<string, int> unit_index;
+    vector<import_edge> roots;
+
+    /* get the unit for a path, or -1 if the file is already imported. */
+    auto reach = [&](const string& dir, const string& path) -> int {
+        string canonical = resolve(dir, path);
+        if (!!env->find_import(canonical))
+            return -1;
+
+        auto f = unit_index.find(canonical);
+        if (unit_index.end() != f)
+            return f->second;
+
+        import_unit unit;
+        unit.canonical = canonical;
+        unit.directory = filesystem::path(canonical).parent_path().string();
+        unit.unreadable = false;
+        unit.level = 0;
+        unit.duplicate = false;
+        unit.failed = false;
+        units.push_back(unit);
+        unit_index.insert(make_pair(canonical, units.size() - 1));
+
+        return units.size() - 1;
+    };
+
+    for (auto& p : paths)
+    {
+        int u = reach(directory, p);
+        if (u >= 0)
+            roots.push_back(import_edge{ u, p });
+    }
+
+    /* parse each wave of new files, then follow their imports. */
+    for (size_t first = 0; first < units.size(); )
+    {
+        size_t last = units.size();
+
+        parallel_for(
+            last - first,
+            [&](size_t i) { parse_unit(units[first + i]); },
+            workers);
+
+        for (size_t u = first; u < last; ++u)
+        {
+            if (!units[u].mod)
+                continue;
+
+            auto mod = units[u].mod;
+            for (auto i : mod->imports)
+            {
+                string p = mod->symbols.str(i);
+                int v = reach(units[u].directory, p);
+                if (v >= 0)
+                    units[u].edges.push_back(import_edge{ v, p });
+            }
+        }
+
+        first = last;
+    }
+
+    /* walk the graph in serial import order, stopping at the first read,
+     * parse, or circular import error.  Modules finish in post order. */
+    enum { UNVISITED, ACTIVE, DONE };
+    vector<int> state(units.size(), UNVISITED);
+    vector<int> order;
+    string walk_error;
+
+    function<bool (const import_edge&, const string&)> visit =
+        [&](const import_edge& edge, const string& prefix) -> bool {
+            auto& unit = units[edge.unit];
+
+            if (ACTIVE == state[edge.unit])
+            {
+                walk_error = prefix + "Circular import of " + edge.path + ".";
+                return false;
+            }
+            else if (DONE == state[edge.unit])
+            {
+                return true;
+            }
+
+            state[edge.unit] = ACTIVE;
+            unit.path = edge.path;
+            unit.prefix = prefix;
+
+            if (unit.unreadable)
+            {
+                walk_error = prefix + "Can't import " + edge.path + ".";
+                return false;
+            }
+            else if (!unit.mod)
+            {
+                walk_error =
+                    prefix + "In import " + edge.path + ": "
+                  + unit.parse_error;
+                return false;
+            }
+
+            for (auto& e : unit.edges)
+            {
+                if (!visit(e, prefix + "In import " + edge.path + ": "))
+                    return false;
+
+                unit.level = max(unit.level, units[e.unit].level + 1);
+            }
+
+            state[edge.unit] = DONE;
+            order.push_back(edge.unit);
+
+            return true;
+        };
+
+    for (auto& r : roots)
+    {
+        if (!visit(r, ""))
+            break;
+    }
+
+    /* a module name claimed by an earlier module in post order, or by an
+     * existing component type, is a duplicate. */
+    set<string> claimed;
+    int levels = 0;
+    for (auto u : order)
+    {
+        string name = units[u].mod->symbols.str(units[u].mod->name);
+        units[u].duplicate =
+            factory.contains(name) || !claimed.insert(name).second;
+        levels = max(levels, units[u].level + 1);
+    }
+
+    /* analyze each level concurrently, then register it in post order.  A
+     * module that imports a failed module is skipped; its own error could
+     * not be reported first. */
+    for (int level = 0; level < levels; ++level)
+    {
+        vector<int> wave;
+        for (auto u : order)
+        {
+            if (units[u].level != level)
+                continue;
+
+            bool blocked = false;
+            for (auto& e : units[u].edges)
+                blocked = blocked || !units[e.unit].def;
+
+            if (!blocked)
+                wave.push_back(u);
+        }
+
+        parallel_for(
+            wave.size(),
+            [&](size_t i) { analyze_unit(env, units[wave[i]]); },
+            workers);
+
+        for (auto u : wave)
+        {
+            auto& unit = units[u];
+
+            if (!unit.failed && unit.duplicate)
+            {
+                unit.failed = true;
+                unit.failure =
+                    string("Duplicate definition for component type ")
+                  + unit.mod->symbols.str(unit.mod->name) + ".";
+            }
+
+            if (unit.failed)
+            {
+                unit.def.reset();
+                continue;
+            }
+
+            register_composite(
+                factory, unit.mod->symbols.str(unit.mod->name), unit.def);
+            env->add_import(unit.canonical, unit.def);
+        }
+    }
+
+    /* the first failure in post order precedes any walk error. */
+    for (auto u : order)
+    {
+        auto& unit = units[u];
+        if (unit.failed)
+            throw semantic_error(
+                unit.prefix + "In import " + unit.path + ": "
+              + unit.failure);
+    }
+
+    if (!walk_error.empty())
+        throw semantic_error(walk_error);
+}
@@ -0,0 +1,27 @@
+/**
+ * \file analyzer/semantic_analyzer_import_pending.cpp
+ *
+ * \brief Import the streamed imports held so far.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Import the streamed imports held so far, all in one call, so that
+ * they are parsed and analyzed concurrently.
+ *
+ * \throws a \ref semantic_error on failure.
+ */
+void homesim::semantic_analyzer::import_pending()
+{
+    if (pending_imports.empty())
+        return;
+
+    vector<string> paths;
+    paths.swap(pending_imports);
+    import_modules(paths);
+}
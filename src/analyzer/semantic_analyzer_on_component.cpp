@@ -0,0 +1,31 @@
+/**
+ * \file analyzer/semantic_analyzer_on_component.cpp
+ *
+ * \brief Analyze a streamed component.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <algorithm>
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Analyze a streamed component.
+ *
+ * \param mod           The module being parsed.
+ * \param c             The index of the component.
+ *
+ * \throws a \ref semantic_error on failure.
+ */
+void homesim::semantic_analyzer::on_component(const flat_module& mod, int c)
+{
+    /* the component may be of an imported type. */
+    import_pending();
+
+    auto& component = mod.components[c];
+
+    for (int k = 0; k < max(component.count, 1); ++k)
+        create_component(mod, component, k);
+}
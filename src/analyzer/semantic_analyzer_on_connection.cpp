@@ -0,0 +1,27 @@
+/**
+ * \file analyzer/semantic_analyzer_on_connection.cpp
+ *
+ * \brief Analyze a streamed connection.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Analyze a streamed connection of the current wire.
+ *
+ * \param mod           The module being parsed.
+ * \param w             The index of the wire.
+ * \param conn          The index of the connection.
+ *
+ * \throws a \ref semantic_error on failure.
+ */
+void homesim::semantic_analyzer::on_connection(
+    const flat_module& mod, int w, int conn)
+{
+    /* a component may be defined after the wires that use it. */
+    connect(mod, w, conn, false);
+}
@@ -0,0 +1,25 @@
+/**
+ * \file analyzer/semantic_analyzer_on_import.cpp
+ *
+ * \brief Analyze a streamed import.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Analyze a streamed import.  Imports are held until the next
+ * component or the end of the module, so that sibling imports are imported
+ * together; the imported module can be used as a component type by the
+ * components that follow.
+ *
+ * \param mod           The module being parsed.
+ * \param i             The index of the import.
+ */
+void homesim::semantic_analyzer::on_import(const flat_module& mod, int i)
+{
+    pending_imports.push_back(mod.symbols.str(mod.imports[i]));
+}
@@ -0,0 +1,25 @@
+/**
+ * \file analyzer/semantic_analyzer_on_module.cpp
+ *
+ * \brief Begin analysis of a streamed module.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Begin analysis of a streamed module.
+ *
+ * \param mod           The module being parsed.
+ *
+ * \throws a \ref semantic_error if the module name is invalid.
+ */
+void homesim::semantic_analyzer::on_module(const flat_module& mod)
+{
+    /* the name should not be blank. */
+    if (mod.name < 0 || mod.symbols.str(mod.name).empty())
+        throw semantic_error("Invalid module name.");
+}
@@ -0,0 +1,30 @@
+/**
+ * \file analyzer/semantic_analyzer_on_module_end.cpp
+ *
+ * \brief Finish analysis of a streamed module.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Finish analysis of a streamed module, importing any imports that
+ * follow the last component, and binding the connections to components that
+ * were defined after their wires.
+ *
+ * \param mod           The module being parsed.
+ *
+ * \throws a \ref semantic_error on failure.
+ */
+void homesim::semantic_analyzer::on_module_end(const flat_module& mod)
+{
+    import_pending();
+
+    for (auto& i : pending)
+        bind_connection(mod, i.wire, i.connection, i.element, true);
+
+    pending.clear();
+}
@@ -0,0 +1,29 @@
+/**
+ * \file analyzer/semantic_analyzer_on_wire.cpp
+ *
+ * \brief Analyze a streamed wire.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <algorithm>
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Analyze a streamed wire, creating each of its elements.  Its
+ * connections follow.
+ *
+ * \param mod           The module being parsed.
+ * \param w             The index of the wire.
+ *
+ * \throws a \ref semantic_error if the wire is already defined.
+ */
+void homesim::semantic_analyzer::on_wire(const flat_module& mod, int w)
+{
+    auto& i = mod.wires[w];
+
+    for (int k = 0; k < max(i.count, 1); ++k)
+        create_wire(mod, i, k);
+}
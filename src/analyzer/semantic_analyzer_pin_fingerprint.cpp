@@ -0,0 +1,36 @@
+/**
+ * \file analyzer/semantic_analyzer_pin_fingerprint.cpp
+ *
+ * \brief Fingerprint the pin layout of a component.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+#include <homesim/netlist_cache.h>
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Fingerprint the pin layout of a component.
+ *
+ * Pin bindings in a netlist cache are stored by index, so a cache can only be
+ * used if each component type still has the same pins in the same order.
+ *
+ * \param comp          The component to fingerprint.
+ *
+ * \returns a hash of the component's pin names, in pin index order.
+ */
+uint64_t homesim::semantic_analyzer::pin_fingerprint(const component& comp)
+{
+    string names;
+
+    for (int i = 0; i < comp.pins(); ++i)
+    {
+        names += comp.pin_name(i);
+        names += '\0';
+    }
+
+    return netlist_cache_hash(names.data(), names.data() + names.size());
+}
@@ -0,0 +1,318 @@
+/**
+ * \file analyzer/semantic_analyzer_read_cache.cpp
+ *
+ * \brief Create an analyzer from a netlist cache.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <homesim/component.h>
+#include <homesim/netlist_cache.h>
+#include <homesim/semantic_analyzer.h>
+#include <map>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Read a section from the cache.
+ *
+ * \param pos           The read position, advanced past the section.
+ * \param end           The end of the cache.
+ * \param records       The vector to receive the records.
+ *
+ * \returns false if the section runs past the end of the cache.
+ */
+template <typename T>
+static bool read_section(
+    const char*& pos, const char* end, vector<T>& records)
+{
+    uint64_t count;
+
+    if (static_cast<size_t>(end - pos) < sizeof(count))
+        return false;
+    memcpy(&count, pos, sizeof(count));
+    pos += sizeof(count);
+
+    size_t padded = (count * sizeof(T) + 7) & ~size_t(7);
+    if (count > static_cast<size_t>(end - pos) / sizeof(T)
+     || padded > static_cast<size_t>(end - pos))
+        return false;
+
+    records.resize(count);
+    memcpy(records.data(), pos, count * sizeof(T));
+    pos += padded;
+
+    return true;
+}
+
+/**
+ * \brief Check that a range of records lies within a section.
+ *
+ * \param first         The index of the first record.
+ * \param count         The number of records.
+ * \param size          The number of records in the section.
+ */
+static bool in_range(int first, int count, size_t size)
+{
+    return count >= 0 && first >= 0
+        && static_cast<size_t>(first) + count <= size;
+}
+
+/**
+ * \brief Check that every index in a module read from the cache refers to
+ * a symbol or record that exists.
+ *
+ * The checksum only catches damage to the file, so this guards the analyzer
+ * against a cache that was written wrong.  Symbol ids that are optional may
+ * be -1, and array counts and ranges must be ones the parser accepts.
+ *
+ * \param mod           The module to check.
+ *
+ * \returns true if every index is in range.
+ */
+static bool valid_indices(const flat_module& mod)
+{
+    int symbols = mod.symbols.size();
+    auto symbol = [&](int id) { return id >= 0 && id < symbols; };
+    auto optional_symbol = [&](int id) { return id >= -1 && id < symbols; };
+    int expressions = mod.expressions.size();
+    auto expression = [&](int id) { return id >= -1 && id < expressions; };
+
+    /* array counts and ranges are bounded as they are by the parser, so
+     * that they can't drive unbounded allocations or loops. */
+    auto count = [](int n) { return n >= 0 && n <= parser::max_count; };
+    auto bound = [](int n) { return n >= -1 && n < parser::max_count; };
+
+    if (!symbol(mod.name))
+        return false;
+
+    for (auto i : mod.imports)
+        if (!symbol(i))
+            return false;
+
+    for (auto& i : mod.components)
+        if (!symbol(i.name) || !optional_symbol(i.type)
+         || !in_range(i.first_config, i.config_count, mod.configs.size())
+         || !count(i.count))
+            return false;
+
+    /* a pull is anonymous, and never an array. */
+    for (auto& i : mod.pulls)
+        if (-1 != i.name || !optional_symbol(i.type)
+         || !in_range(i.first_config, i.config_count, mod.configs.size())
+         || 0 != i.count)
+            return false;
+
+    for (auto& i : mod.configs)
+        if (!symbol(i.key) || !expression(i.expression))
+            return false;
+
+    for (auto& i : mod.expressions)
+        if (!symbol(i.value) || !optional_symbol(i.functor))
+            return false;
+
+    for (auto& i : mod.wires)
+        if (!symbol(i.name)
+         || !in_range(
+                i.first_connection, i.connection_count,
+                mod.connections.size())
+         || i.pull < -1 || i.pull >= (int)mod.pulls.size()
+         || !count(i.count))
+            return false;
+
+    for (auto& i : mod.connections)
+        if (!symbol(i.component) || !symbol(i.pin)
+         || !bound(i.first) || !bound(i.last)
+         || !bound(i.pin_first) || !bound(i.pin_last))
+            return false;
+
+    for (auto& i : mod.probes)
+        if (!symbol(i.name) || !symbol(i.type) || !optional_symbol(i.sub_type)
+         || !in_range(i.first_wire_ref, i.wire_ref_count, mod.wire_refs.size()))
+            return false;
+
+    for (auto i : mod.wire_refs)
+        if (!symbol(i))
+            return false;
+
+    for (auto& i : mod.scenarios)
+        if (!symbol(i.name)
+         || !in_range(
+                i.first_execution, i.execution_count, mod.executions.size()))
+            return false;
+
+    for (auto& i : mod.executions)
+        if (!symbol(i.name)
+         || !in_range(i.first_step, i.step_count, mod.steps.size()))
+            return false;
+
+    for (size_t i = 0; i < mod.steps.size(); ++i)
+    {
+        auto& st = mod.steps[i];
+        if (!symbol(st.type) || !expression(st.expression)
+         || !in_range(
+                st.first_pin_assignment, st.pin_assignment_count,
+                mod.pin_assignments.size())
+         || !in_range(
+                st.first_assertion, st.assertion_count,
+                mod.assertions.size())
+         || !in_range(i + 1, st.body_count, mod.steps.size()))
+            return false;
+    }
+
+    for (auto& i : mod.pin_assignments)
+        if (!symbol(i.component) || !symbol(i.pin) || i.element < -1
+         || !expression(i.expression))
+            return false;
+
+    for (auto& i : mod.assertions)
+        if (!symbol(i.type) || !optional_symbol(i.wire) || i.element < -1
+         || !expression(i.expression))
+            return false;
+
+    return true;
+}
+
+/**
+ * \brief Create an analyzer from a netlist cache.
+ *
+ * \param en            The environment for this analysis.
+ * \param path          The path of the cache file.
+ * \param source_hash   The \ref netlist_cache_hash of the source text.
+ *
+ * Imports are resolved against the directory of the cache file, which is
+ * the directory of its source.
+ *
+ * \returns an analyzed semantic_analyzer, or nullptr if the cache is
+ * missing, corrupt, or stale, or if an import or a component's
+ * configuration fails.
+ */
+shared_ptr<semantic_analyzer> homesim::semantic_analyzer::read_cache(
+    shared_ptr<environment> en, const string& path, uint64_t source_hash)
+{
+    try
+    {
+        mapped_file file(path);
+        const char* begin = file.begin();
+        const char* end = file.end();
+
+        /* verify the header. */
+        netlist_cache_header header;
+        if (static_cast<size_t>(end - begin) < sizeof(header))
+            return nullptr;
+        memcpy(&header, begin, sizeof(header));
+        if (memcmp(header.magic, netlist_cache_magic, sizeof(header.magic))
+         || header.version != netlist_cache_version
+         || header.layout != netlist_cache_layout
+         || header.source_hash != source_hash
+         || header.size != static_cast<size_t>(end - begin)
+         || header.checksum
+                != netlist_cache_hash(begin + sizeof(header), end))
+            return nullptr;
+
+        const char* pos = begin + sizeof(header);
+        auto mod = make_shared<flat_module>();
+
+        /* re-intern the symbols, which must receive their original ids. */
+        vector<uint64_t> lengths;
+        vector<char> pool;
+        if (!read_section(pos, end, lengths) || !read_section(pos, end, pool))
+            return nullptr;
+        size_t offset = 0;
+        for (size_t i = 0; i < lengths.size(); ++i)
+        {
+            if (lengths[i] > pool.size() - offset)
+                return nullptr;
+
+            const char* symbol = pool.data() + offset;
+            if (mod->symbols.intern(symbol, symbol + lengths[i]) != (int)i)
+                return nullptr;
+
+            offset += lengths[i];
+        }
+        mod->name = header.name;
+
+        vector<netlist_cache_target> targets;
+        vector<netlist_cache_fingerprint> fingerprints;
+        if (!read_section(pos, end, mod->imports)
+         || !read_section(pos, end, mod->components)
+         || !read_section(pos, end, mod->pulls)
+         || !read_section(pos, end, mod->configs)
+         || !read_section(pos, end, mod->expressions)
+         || !read_section(pos, end, mod->wires)
+         || !read_section(pos, end, mod->connections)
+         || !read_section(pos, end, mod->probes)
+         || !read_section(pos, end, mod->wire_refs)
+         || !read_section(pos, end, mod->scenarios)
+         || !read_section(pos, end, mod->executions)
+         || !read_section(pos, end, mod->steps)
+         || !read_section(pos, end, mod->pin_assignments)
+         || !read_section(pos, end, mod->assertions)
+         || !read_section(pos, end, targets)
+         || !read_section(pos, end, fingerprints)
+         || pos != end
+         || !valid_indices(*mod))
+            return nullptr;
+
+        auto retval =
+            make_shared<semantic_analyzer>(
+                en, mod, filesystem::path(path).parent_path().string());
+
+        /* components are live objects, so they are still built and
+         * configured through the environment.  Imported modules define
+         * component types, so they are imported first. */
+        retval->analyze_imports();
+        retval->reserve_netlist();
+        retval->analyze_components();
+
+        /* pin indices are only valid if each type's pins are unchanged.
+         * Instances of a type share a pin table, so each type is checked
+         * once, against its first instance. */
+        map<int, const netlist_cache_fingerprint*> fingerprint_map;
+        for (auto& i : fingerprints)
+            fingerprint_map[i.type] = &i;
+        size_t index = 0;
+        for (auto& c : mod->components)
+        {
+            auto f = fingerprint_map.find(c.type);
+            if (fingerprint_map.end() == f)
+                return nullptr;
+
+            size_t first = index;
+            index += max(c.count, 1);
+            if (nullptr == f->second)
+                continue;
+
+            auto& comp = *retval->component_list[first];
+            if (f->second->pins != comp.pins()
+             || f->second->hash != pin_fingerprint(comp))
+                return nullptr;
+
+            f->second = nullptr;
+        }
+
+        int wires = 0;
+        for (auto& w : mod->wires)
+            wires += max(w.count, 1);
+
+        int components = retval->component_list.size();
+        for (auto& i : targets)
+            if (i.component < 0 || i.component >= components
+             || i.wire < 0 || i.wire >= wires)
+                return nullptr;
+
+        retval->bind_wires(targets.data(), targets.size());
+        retval->analyzed = true;
+
+        return retval;
+    }
+    catch (exception& e)
+    {
+        /* any failure, including running out of memory, is a cache miss. */
+        return nullptr;
+    }
+}
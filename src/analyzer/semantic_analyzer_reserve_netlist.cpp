@@ -0,0 +1,58 @@
+/**
+ * \file analyzer/semantic_analyzer_reserve_netlist.cpp
+ *
+ * \brief Reserve arena space for the netlist described by the AST.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <algorithm>
+#include <homesim/component.h>
+#include <homesim/netlist_arena.h>
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Estimated arena bytes for a component, including its control block
+ * and pin bindings.
+ */
+static const size_t component_reserve = 256;
+
+/**
+ * \brief Estimated arena bytes for a wire, including its control block.
+ */
+static const size_t wire_reserve = sizeof(wire) + 64;
+
+/**
+ * \brief Estimated arena bytes for the fanout records of one connection.
+ */
+static const size_t connection_reserve = 64;
+
+/**
+ * \brief Reserve arena space for every wire, component, and connection in the
+ * module, so that building the netlist allocates a single block.  The id
+ * tables are sized up front as well.
+ */
+void homesim::semantic_analyzer::reserve_netlist()
+{
+    size_t components = 0, wires = 0, connections = 0;
+
+    /* arrays are counted by element. */
+    for (auto& c : module->components)
+        components += max(c.count, 1);
+    for (auto& w : module->wires)
+        wires += max(w.count, 1);
+    for (size_t i = 0; i < module->connections.size(); ++i)
+        connections += module->connection_width(i);
+
+    arena->reserve(
+        components * component_reserve
+      + wires * wire_reserve
+      + connections * connection_reserve);
+
+    component_list.reserve(components);
+    wire_list.reserve(wires);
+    component_ids.resize(module->symbols.size(), element_range{ -1, -1, 0 });
+    wire_ids.resize(module->symbols.size(), element_range{ -1, -1, 0 });
+}
@@ -0,0 +1,60 @@
+/**
+ * \file analyzer/semantic_analyzer_run_scenario.cpp
+ *
+ * \brief Run each execution of a scenario.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/agenda.h>
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Run each execution of a scenario against the netlist.
+ *
+ * \param name          The name of the scenario.
+ * \param log           The stream to which failed expectations are written.
+ *
+ * \returns the number of failed expectations.
+ *
+ * \throws a \ref scenario_error if an assertion fails, or a step can't be
+ * run, or a \ref semantic_error if analysis fails.
+ */
+int homesim::semantic_analyzer::run_scenario(const string& name, ostream& log)
+{
+    analyze();
+    build_netlist();
+
+    int scenario = module->symbols.find(name);
+    int failures = 0;
+    bool found = false;
+
+    for (auto& s : module->scenarios)
+    {
+        if (scenario != s.name)
+            continue;
+
+        found = true;
+        for (int i = 0; i < s.execution_count; ++i)
+        {
+            auto& e = module->executions[s.first_execution + i];
+            string where =
+                string("In scenario ") + name + ", execution "
+              + module->symbols.str(e.name);
+
+            /* each execution starts at time zero. */
+            global_agenda.clear();
+            double time = 0.0;
+
+            failures +=
+                run_steps(where, e.first_step, e.step_count, time, log);
+        }
+    }
+
+    if (!found)
+        throw scenario_error(string("Scenario ") + name + " not found.");
+
+    return failures;
+}
@@ -0,0 +1,31 @@
+/**
+ * \file analyzer/semantic_analyzer_run_scenarios.cpp
+ *
+ * \brief Run every scenario in the module.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Run every scenario in the module, in source order.
+ *
+ * \param log           The stream to which failed expectations are written.
+ *
+ * \returns the number of failed expectations.
+ *
+ * \throws a \ref scenario_error if an assertion fails, or a step can't be
+ * run, or a \ref semantic_error if analysis fails.
+ */
+int homesim::semantic_analyzer::run_scenarios(ostream& log)
+{
+    int failures = 0;
+
+    for (auto& s : module->scenarios)
+        failures += run_scenario(module->symbols.str(s.name), log);
+
+    return failures;
+}
@@ -0,0 +1,130 @@
+/**
+ * \file analyzer/semantic_analyzer_run_steps.cpp
+ *
+ * \brief Run a range of scenario steps.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+#include <homesim/semantic_analyzer.h>
+#include <homesim/wire.h>
+#include <ostream>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Run a range of steps, running the body of each repeat block in place.
+ *
+ * \param where         The scenario and execution, for messages.
+ * \param first         The index of the first step.
+ * \param count         The number of steps, including repeat bodies.
+ * \param time          The time of the previous step, updated as steps run.
+ * \param log           The stream to which failed expectations are written.
+ *
+ * \returns the number of failed expectations.
+ *
+ * \throws a \ref scenario_error if an assertion fails or a step can't be run.
+ */
+int homesim::semantic_analyzer::run_steps(
+    const string& where, int first, int count, double& time, ostream& log)
+{
+    int after = module->symbols.find("after");
+    int assert_type = module->symbols.find("assert");
+    int failures = 0;
+
+    for (int i = first; i < first + count; ++i)
+    {
+        auto& step = module->steps[i];
+
+        /* a repeat block runs the steps that follow it. */
+        if (step.body_count > 0)
+        {
+            int repeat = module->value(step.expression).number;
+            for (int r = 0; r < repeat; ++r)
+                failures +=
+                    run_steps(where, i + 1, step.body_count, time, log);
+
+            i += step.body_count;
+            continue;
+        }
+
+        try
+        {
+            /* an at step is absolute, and an after step is relative. */
+            double step_time = module->value(step.expression).seconds();
+            if (after == step.type)
+                step_time += time;
+
+            if (step_time < time)
+                throw scenario_error(
+                    where + ": step at " + config_format_number(step_time)
+                  + " s is before the previous step.");
+
+            time = step_time;
+        }
+        catch (config_value_error& e)
+        {
+            throw scenario_error(where + ": " + e.what());
+        }
+
+        advance_to(time);
+
+        for (int j = 0; j < step.assertion_count; ++j)
+        {
+            auto& a = module->assertions[step.first_assertion + j];
+            int w = find_element(wire_ids, a.wire, a.element);
+            if (w < 0)
+                throw scenario_error(
+                    where + ": reference to unknown wire "
+                  + module->element_name(a.wire, a.element + 1, a.element)
+                  + ".");
+
+            bool expected = module->value(a.expression).boolean;
+            if (wire_list[w]->get_signal() == expected)
+                continue;
+
+            string message =
+                where + ": " + module->symbols.str(a.type) + " wire."
+              + module->element_name(a.wire, a.element + 1, a.element)
+              + ".signal = "
+              + (expected ? "true" : "false")
+              + " failed at " + config_format_number(time) + " s.";
+
+            if (assert_type == a.type)
+                throw scenario_error(message);
+
+            log << message << endl;
+            ++failures;
+        }
+
+        for (int j = 0; j < step.pin_assignment_count; ++j)
+        {
+            auto& pa = module->pin_assignments[step.first_pin_assignment + j];
+            string pin = module->symbols.str(pa.pin);
+            int c = find_element(component_ids, pa.component, pa.element);
+            if (c < 0)
+                throw scenario_error(
+                    where + ": reference to unknown component "
+                  + module->element_name(
+                        pa.component, pa.element + 1, pa.element)
+                  + ".");
+
+            try
+            {
+                component_list[c]->get_wire(pin)->set_signal(
+                    module->value(pa.expression).boolean);
+            }
+            catch (invalid_pin_error& e)
+            {
+                throw scenario_error(
+                    where + ": reference to unknown pin "
+                  + module->element_name(
+                        pa.component, pa.element + 1, pa.element)
+                  + ".pin[\"" + pin + "\"].");
+            }
+        }
+    }
+
+    return failures;
+}
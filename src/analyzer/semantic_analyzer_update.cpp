@@ -0,0 +1,360 @@
+/**
+ * \file analyzer/semantic_analyzer_update.cpp
+ *
+ * \brief Update the analyzed netlist to match an edited module.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <algorithm>
+#include <homesim/agenda.h>
+#include <homesim/component.h>
+#include <homesim/semantic_analyzer.h>
+
+using namespace homesim;
+using namespace std;
+
+namespace {
+
+/**
+ * \brief A pin binding of a module: an element of a connection of a wire.
+ * The target is the id of the bound component element, or -1 if no such
+ * component exists.
+ */
+struct binding_ref
+{
+    int wire;
+    int connection;
+    int element;
+    int target;
+};
+
+} /* namespace */
+
+/**
+ * \brief Scramble a hash, so that a sum of hashes is still a good hash.
+ */
+static uint64_t mix(uint64_t x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+
+    return x ^ (x >> 31);
+}
+
+/**
+ * \brief Add a string to a hash.
+ */
+static uint64_t hash_text(uint64_t h, const string& text)
+{
+    for (unsigned char ch : text)
+        h = (h ^ ch) * 0x100000001b3ULL;
+
+    /* separate this string from the next. */
+    return (h ^ 0xff) * 0x100000001b3ULL;
+}
+
+/**
+ * \brief Add an index, or -1 for none, to a hash.
+ */
+static uint64_t hash_index(uint64_t h, int index)
+{
+    return mix(h ^ mix(index + 1));
+}
+
+/**
+ * \brief Describe the component and wire elements of a module.
+ *
+ * Elements are keyed by the text of their name symbols and their indices,
+ * with a hash built from symbols and indices so that no name is formatted.
+ * Keys with equal hashes are compared by name, so a collision can't merge two
+ * elements.  The signature of a component element covers
+ * its type, its configuration, and its pin bindings, in any order; two
+ * elements with the same name and signature build the same netlist.  Each
+ * element is listed in id order, with its key; a duplicate name is listed
+ * with the entry of the first element by that name.
+ */
+template <typename signature_map, typename element_order>
+static void describe(
+    const flat_module& mod, signature_map& components, signature_map& wires,
+    element_order& component_order, element_order& wire_order,
+    vector<binding_ref>& bindings)
+{
+    typedef typename signature_map::key_type name_key;
+    typedef typename signature_map::mapped_type entry;
+    const uint64_t basis = 0xcbf29ce484222325ULL;
+
+    vector<string> text(mod.symbols.size());
+    vector<uint64_t> symbol(mod.symbols.size());
+    for (size_t i = 0; i < symbol.size(); ++i)
+    {
+        text[i] = mod.symbols.str(i);
+        symbol[i] = hash_text(basis, text[i]);
+    }
+
+    /* the key of an element of the given name. */
+    auto key = [&](int name, int element) {
+        return
+            name_key{ hash_index(symbol[name], element), text[name], element };
+    };
+
+    int index = 0;
+    components.reserve(mod.components.size());
+    for (size_t i = 0; i < mod.components.size(); ++i)
+    {
+        auto& c = mod.components[i];
+        uint64_t h = c.type < 0 ? basis : symbol[c.type];
+        for (int j = 0; j < c.config_count; ++j)
+        {
+            auto& config = mod.configs[c.first_config + j];
+            h = hash_text(h ^ symbol[config.key], mod.eval(config.expression));
+        }
+
+        for (int k = 0; k < max(c.count, 1); ++k)
+        {
+            auto r =
+                components.emplace(
+                    key(c.name, c.count > 0 ? k : -1),
+                    entry{ mix(h), index++, (int)i, k });
+            component_order.push_back(
+                make_pair(&r.first->first, &r.first->second));
+        }
+    }
+
+    index = 0;
+    wires.reserve(mod.wires.size());
+    for (size_t i = 0; i < mod.wires.size(); ++i)
+    {
+        auto& w = mod.wires[i];
+
+        for (int k = 0; k < max(w.count, 1); ++k)
+        {
+            auto name = key(w.name, w.count > 0 ? k : -1);
+            uint64_t hash = name.hash;
+            auto r =
+                wires.emplace(move(name), entry{ hash, index++, (int)i, k });
+            wire_order.push_back(make_pair(&r.first->first, &r.first->second));
+        }
+
+        for (int j = 0; j < w.connection_count; ++j)
+        {
+            int conn = w.first_connection + j;
+            auto& c = mod.connections[conn];
+            int width = mod.connection_width(conn);
+
+            for (int k = 0; k < width; ++k)
+            {
+                int element = w.count > 0 ? k : -1;
+                int pin =
+                    c.pin_first >= 0
+                        ? flat_module::range_element(
+                            c.pin_first, c.pin_last, k)
+                        : -1;
+
+                auto f =
+                    components.find(
+                        key(c.component, mod.connection_element(conn, k)));
+                if (components.end() != f)
+                    f->second.signature +=
+                        mix(hash_index(symbol[c.pin], pin)
+                          ^ hash_index(symbol[w.name], element));
+
+                bindings.push_back(
+                    binding_ref{
+                        (int)i, conn, k,
+                        components.end() != f ? f->second.index : -1});
+            }
+        }
+    }
+}
+
+/**
+ * \brief Update the analyzed netlist to match an edited module.
+ *
+ * The id tables are rebuilt for the new module.  A component element whose
+ * signature is unchanged keeps its object, bindings, wire actions, and
+ * owner, and a wire whose name is unchanged keeps its object and signal.
+ * Only the other elements are created, bound, and built, and names are only
+ * formatted for diagnostics.  The old tables are set aside until the update
+ * succeeds, so a failure restores them.
+ *
+ * \param mod           The edited module.
+ *
+ * \returns the changes made to the netlist.
+ *
+ * \throws a \ref semantic_error if the new module fails analysis or updates
+ * were not enabled, or a \ref scenario_error if a rebuilt component can't be
+ * built.
+ */
+netlist_update homesim::semantic_analyzer::update(
+    shared_ptr<const flat_module> mod)
+{
+    if (!updates)
+        throw semantic_error("Netlist updates are not enabled.");
+
+    analyze();
+
+    /* the name should not be blank. */
+    if (mod->name < 0 || mod->symbols.str(mod->name).empty())
+        throw semantic_error("Invalid module name.");
+
+    /* a new import may define new component types. */
+    vector<string> paths;
+    for (auto i : mod->imports)
+        paths.push_back(mod->symbols.str(i));
+    import_modules(paths);
+
+    vector<pair<const element_key*, const element_signature*>>
+        component_order, wire_order;
+    vector<binding_ref> bindings;
+
+    /* the signatures of the current module are kept between updates. */
+    if (component_signatures.empty() && wire_signatures.empty())
+    {
+        describe(
+            *module, component_signatures, wire_signatures, component_order,
+            wire_order, bindings);
+        component_order.clear();
+        wire_order.clear();
+        bindings.clear();
+    }
+
+    signature_map components, wires;
+    describe(*mod, components, wires, component_order, wire_order, bindings);
+
+    /* find the current id of each kept element. */
+    netlist_update result = { };
+    size_t matched = 0;
+    vector<int> previous(component_order.size(), -1);
+    for (size_t i = 0; i < component_order.size(); ++i)
+    {
+        auto o = component_signatures.find(*component_order[i].first);
+        if (component_signatures.end() == o)
+            continue;
+
+        ++matched;
+        if (o->second.signature == component_order[i].second->signature)
+            previous[i] = o->second.index;
+    }
+
+    vector<int> previous_wire(wire_order.size(), -1);
+    for (size_t i = 0; i < wire_order.size(); ++i)
+    {
+        auto o = wire_signatures.find(*wire_order[i].first);
+        if (wire_signatures.end() != o)
+            previous_wire[i] = o->second.index;
+    }
+
+    /* set the current tables aside, to be restored on failure. */
+    vector<shared_ptr<component>> old_components;
+    vector<shared_ptr<wire>> old_wires;
+    vector<element_range> old_component_ids, old_wire_ids;
+    vector<unique_ptr<wire_owner>> old_owners;
+    old_components.swap(component_list);
+    old_wires.swap(wire_list);
+    old_component_ids.swap(component_ids);
+    old_wire_ids.swap(wire_ids);
+    old_owners.swap(owners);
+    old_owners.resize(old_components.size());
+
+    component_ids.resize(mod->symbols.size(), element_range{ -1, -1, 0 });
+    wire_ids.resize(mod->symbols.size(), element_range{ -1, -1, 0 });
+    component_list.reserve(component_order.size());
+    wire_list.reserve(wire_order.size());
+    owners.resize(component_order.size());
+
+    try
+    {
+        size_t id = 0;
+        for (auto& c : mod->components)
+        {
+            for (int k = 0; k < max(c.count, 1); ++k, ++id)
+            {
+                if (previous[id] < 0)
+                {
+                    create_component(*mod, c, k);
+                    ++result.components_built;
+                    continue;
+                }
+
+                add_component(*mod, c, k, old_components[previous[id]]);
+                owners[id] = move(old_owners[previous[id]]);
+                ++result.components_kept;
+            }
+        }
+
+        id = 0;
+        for (auto& w : mod->wires)
+        {
+            for (int k = 0; k < max(w.count, 1); ++k, ++id)
+            {
+                if (previous_wire[id] < 0)
+                {
+                    create_wire(*mod, w, k);
+                    ++result.wires_created;
+                    continue;
+                }
+
+                add_wire(*mod, w, k, old_wires[previous_wire[id]]);
+                ++result.wires_kept;
+            }
+        }
+
+        /* a kept component is still bound to the same wires. */
+        for (auto& b : bindings)
+        {
+            if (b.target >= 0 && previous[b.target] >= 0)
+                continue;
+
+            bind_connection(*mod, b.wire, b.connection, b.element, true);
+        }
+
+        /* build each new component, recording what it adds to its wires. */
+        for (size_t i = 0; i < component_list.size(); ++i)
+        {
+            if (previous[i] >= 0)
+                continue;
+
+            owners[i] = make_unique<wire_owner>();
+            build_component(*mod, i, owners[i].get());
+        }
+    }
+    catch (...)
+    {
+        for (size_t i = 0; i < owners.size(); ++i)
+        {
+            if (!owners[i])
+                continue;
+            else if (previous[i] >= 0)
+                old_owners[previous[i]] = move(owners[i]);
+            else
+                owners[i]->detach();
+        }
+
+        component_list.swap(old_components);
+        wire_list.swap(old_wires);
+        component_ids.swap(old_component_ids);
+        wire_ids.swap(old_wire_ids);
+        owners.swap(old_owners);
+        global_agenda.clear();
+
+        throw;
+    }
+
+    /* detach every component that was replaced or removed. */
+    for (auto& o : old_owners)
+        if (o)
+            o->detach();
+
+    result.components_removed = old_components.size() - matched;
+    result.wires_removed = old_wires.size() - result.wires_kept;
+
+    module = mod;
+    component_signatures.swap(components);
+    wire_signatures.swap(wires);
+
+    /* events scheduled by detached components must not run. */
+    global_agenda.clear();
+
+    return result;
+}
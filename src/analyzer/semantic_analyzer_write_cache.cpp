@@ -0,0 +1,183 @@
+/**
+ * \file analyzer/semantic_analyzer_write_cache.cpp
+ *
+ * \brief Write an analyzed module to a netlist cache.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <homesim/component.h>
+#include <homesim/netlist_cache.h>
+#include <homesim/semantic_analyzer.h>
+#include <map>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Append a section to the cache buffer.
+ *
+ * \param out           The cache buffer.
+ * \param data          The records of the section.
+ * \param count         The number of records.
+ */
+template <typename T>
+static void write_section(vector<char>& out, const T* data, uint64_t count)
+{
+    const char* count_bytes = reinterpret_cast<const char*>(&count);
+    out.insert(out.end(), count_bytes, count_bytes + sizeof(count));
+
+    const char* bytes = reinterpret_cast<const char*>(data);
+    out.insert(out.end(), bytes, bytes + count * sizeof(T));
+
+    /* pad to eight bytes, so that every section is aligned. */
+    out.resize((out.size() + 7) & ~size_t(7), 0);
+}
+
+/**
+ * \brief Append a vector as a section to the cache buffer.
+ *
+ * \param out           The cache buffer.
+ * \param records       The records of the section.
+ */
+template <typename T>
+static void write_section(vector<char>& out, const vector<T>& records)
+{
+    write_section(out, records.data(), records.size());
+}
+
+/**
+ * \brief Analyze the module and write the result to a netlist cache.
+ *
+ * \param path          The path of the cache file.
+ * \param source_hash   The \ref netlist_cache_hash of the source text.
+ *
+ * \throws a \ref semantic_error if analysis fails, or a
+ * \ref netlist_cache_error if the cache can't be written.
+ */
+void homesim::semantic_analyzer::write_cache(
+    const string& path, uint64_t source_hash)
+{
+    /* only a valid netlist is cached. */
+    analyze();
+
+    vector<char> out(sizeof(netlist_cache_header), 0);
+
+    /* symbols are stored in id order, so reading them back assigns the same
+     * ids. */
+    vector<uint64_t> lengths;
+    string pool;
+    for (int i = 0; i < module->symbols.size(); ++i)
+    {
+        string symbol = module->symbols.str(i);
+        lengths.push_back(symbol.size());
+        pool += symbol;
+    }
+    write_section(out, lengths);
+    write_section(out, pool.data(), pool.size());
+
+    write_section(out, module->imports);
+    write_section(out, module->components);
+    write_section(out, module->pulls);
+    write_section(out, module->configs);
+    write_section(out, module->expressions);
+    write_section(out, module->wires);
+    write_section(out, module->connections);
+    write_section(out, module->probes);
+    write_section(out, module->wire_refs);
+    write_section(out, module->scenarios);
+    write_section(out, module->executions);
+    write_section(out, module->steps);
+    write_section(out, module->pin_assignments);
+    write_section(out, module->assertions);
+
+    /* the type of each component element, by id. */
+    vector<int> component_type;
+    for (auto& c : module->components)
+        component_type.insert(component_type.end(), max(c.count, 1), c.type);
+
+    /* resolve each binding to a wire element, component, and pin index. */
+    vector<netlist_cache_target> targets;
+    targets.reserve(module->connections.size());
+    int wire_index = 0;
+    for (auto& w : module->wires)
+    {
+        for (int j = 0; j < w.connection_count; ++j)
+        {
+            int conn = w.first_connection + j;
+            int width = module->connection_width(conn);
+
+            for (int e = 0; e < width; ++e)
+            {
+                int index =
+                    find_element(
+                        component_ids, module->connections[conn].component,
+                        module->connection_element(conn, e));
+
+                targets.push_back(
+                    netlist_cache_target{
+                        wire_index + (w.count > 0 ? e : 0), index,
+                        component_list[index]->pin_index(
+                            module->connection_pin(conn, e))});
+            }
+        }
+
+        wire_index += max(w.count, 1);
+    }
+    write_section(out, targets);
+
+    /* record the pin layout of each component type. */
+    map<int, netlist_cache_fingerprint> fingerprints;
+    for (size_t i = 0; i < component_type.size(); ++i)
+    {
+        int type = component_type[i];
+        if (fingerprints.end() == fingerprints.find(type))
+        {
+            auto& comp = *component_list[i];
+            fingerprints[type] =
+                netlist_cache_fingerprint{
+                    type, comp.pins(), pin_fingerprint(comp)};
+        }
+    }
+    vector<netlist_cache_fingerprint> fingerprint_list;
+    for (auto& i : fingerprints)
+        fingerprint_list.push_back(i.second);
+    write_section(out, fingerprint_list);
+
+    /* fill in the header. */
+    netlist_cache_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, netlist_cache_magic, sizeof(header.magic));
+    header.version = netlist_cache_version;
+    header.layout = netlist_cache_layout;
+    header.source_hash = source_hash;
+    header.size = out.size();
+    header.checksum =
+        netlist_cache_hash(
+            out.data() + sizeof(header), out.data() + out.size());
+    header.name = module->name;
+    memcpy(out.data(), &header, sizeof(header));
+
+    /* write to a temporary file and rename it, so that a reader never sees a
+     * partial cache. */
+    string tmp = path + ".tmp";
+    {
+        ofstream file(tmp, ios::binary | ios::trunc);
+        file.write(out.data(), out.size());
+        file.close();
+        if (!file)
+        {
+            remove(tmp.c_str());
+            throw netlist_cache_error("Could not write " + tmp);
+        }
+    }
+
+    if (0 != rename(tmp.c_str(), path.c_str()))
+    {
+        remove(tmp.c_str());
+        throw netlist_cache_error("Could not rename " + tmp + " to " + path);
+    }
+}
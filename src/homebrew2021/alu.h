@@ -69,6 +69,11 @@ struct alu_rom_bytes
     std::shared_ptr<std::vector<uint8_t>> a_rom;
     std::shared_ptr<std::vector<uint8_t>> b_rom;
     std::shared_ptr<std::vector<uint8_t>> flags_rom;
+
+    /* immutable images of the ROMs above, shared by every ALU instance. */
+    std::shared_ptr<const homesim::rom_image> a_image;
+    std::shared_ptr<const homesim::rom_image> b_image;
+    std::shared_ptr<const homesim::rom_image> flags_image;
 };
 
 /* the maximum unsigned size of the A register. */
@@ -49,6 +49,12 @@ shared_ptr<alu_rom_bytes> homebrew2021::get_or_create_alu_rom()
 
         populate_alu_rom(global_rom);
 
+        /* share the populated bytes with every ROM instance. */
+        global_rom->a_image = make_shared<const rom_image>(global_rom->a_rom);
+        global_rom->b_image = make_shared<const rom_image>(global_rom->b_rom);
+        global_rom->flags_image =
+            make_shared<const rom_image>(global_rom->flags_rom);
+
         return global_rom;
     }
 }
@@ -35,6 +35,6 @@ homebrew2021::alu_rom_flags::alu_rom_flags(
 
     rom =
         make_shared<icrom>(
-            addrs, *alu_rom->flags_rom, oe, oe,
+            addrs, alu_rom->flags_image, oe, oe,
             out1, out2, out3, out4, out5, out6, out7, out8);
 }
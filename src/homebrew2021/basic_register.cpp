@@ -21,19 +21,71 @@ homebrew2021::basic_register::basic_register(
     wire* in5, wire* in6, wire* in7, wire* in8,
     wire* out1, wire* out2, wire* out3, wire* out4,
     wire* out5, wire* out6, wire* out7, wire* out8)
+{
+    vector<wire*> in{ in1, in2, in3, in4, in5, in6, in7, in8 };
+    vector<wire*> out{ out1, out2, out3, out4, out5, out6, out7, out8 };
+
+    /* this register has a behavioral model. */
+    global_macro_models.register_model(basic_register_model_name);
+
+    switch (global_macro_models.mode(basic_register_model_name))
+    {
+        case MACRO_MODEL_MODE_STRUCTURAL:
+            build_structural(clock, clear, read, write, in, out);
+            break;
+
+        case MACRO_MODEL_MODE_BEHAVIORAL:
+            model = make_shared<basic_register_model>(
+                clock, clear, read, write, in, out);
+            break;
+
+        case MACRO_MODEL_MODE_COSIMULATE:
+        {
+            build_structural(clock, clear, read, write, in, out);
+
+            /* the behavioral model drives shadow outputs. */
+            monitor = make_shared<cosim_monitor>(basic_register_model_name);
+            vector<wire*> shadow;
+            for (size_t i = 0; i < out.size(); ++i)
+            {
+                shadow_wires.push_back(make_shared<wire>());
+                shadow.push_back(shadow_wires.back().get());
+                monitor->watch(
+                    string("out") + to_string(i + 1), out[i], shadow.back());
+            }
+
+            model = make_shared<basic_register_model>(
+                clock, clear, read, write, in, shadow);
+            break;
+        }
+    }
+}
+
+/**
+ * \brief Build the register from 74173s and inverters.
+ */
+void homebrew2021::basic_register::build_structural(
+    wire* clock, wire* clear, wire* read, wire* write,
+    const vector<wire*>& in, const vector<wire*>& out)
 {
     read_wire = make_shared<wire>();
     write_wire = make_shared<wire>();
     read_inv = make_shared<inverter>(read, read_wire.get());
     write_inv = make_shared<inverter>(write, write_wire.get());
 
+    /* the inverter inputs load read and write. */
+    read->add_connection(WIRE_CONNECTION_TYPE_INPUT);
+    write->add_connection(WIRE_CONNECTION_TYPE_INPUT);
+
     /* create the low register. */
     reg[0] = make_shared<ic74173>(
-        read_wire.get(), read_wire.get(), out1, out2, out3, out4,
-        clock, clear, in1, in2, in3, in4, write_wire.get(), write_wire.get());
+        read_wire.get(), read_wire.get(), out[0], out[1], out[2], out[3],
+        clock, clear, in[0], in[1], in[2], in[3], write_wire.get(),
+        write_wire.get());
 
     /* create the high register. */
     reg[1] = make_shared<ic74173>(
-        read_wire.get(), read_wire.get(), out5, out6, out7, out8,
-        clock, clear, in5, in6, in7, in8, write_wire.get(), write_wire.get());
+        read_wire.get(), read_wire.get(), out[4], out[5], out[6], out[7],
+        clock, clear, in[4], in[5], in[6], in[7], write_wire.get(),
+        write_wire.get());
 }
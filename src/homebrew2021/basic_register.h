@@ -8,10 +8,12 @@
 #pragma once
 
 #include <homesim/inverter.h>
+#include <homesim/macro_model.h>
 #include <homesim/wire.h>
 #include <homesim/ic/74173.h>
 #include <homesim/ic/74245.h>
 
+#include "basic_register_model.h"
 #include "data_bus.h"
 
 namespace homebrew2021
@@ -20,6 +22,10 @@ namespace homebrew2021
 /**
  * \brief A general purpose 8-bit register, wired however the caller wants it
  * wired.
+ *
+ * Depending on the mode in the global macro-model registry, this register is
+ * built from two 74173s and two inverters, from its behavioral model, or from
+ * both, with the behavioral model co-simulated against shadow outputs.
  */
 class basic_register
 {
@@ -44,6 +50,18 @@ private:
     std::shared_ptr<homesim::inverter> write_inv;
     std::shared_ptr<homesim::wire> read_wire;
     std::shared_ptr<homesim::wire> write_wire;
+    std::shared_ptr<basic_register_model> model;
+    std::shared_ptr<homesim::cosim_monitor> monitor;
+    std::vector<std::shared_ptr<homesim::wire>> shadow_wires;
+
+    /**
+     * \brief Build the register from 74173s and inverters.
+     */
+    void build_structural(
+        homesim::wire* clock, homesim::wire* clear,
+        homesim::wire* read, homesim::wire* write,
+        const std::vector<homesim::wire*>& in,
+        const std::vector<homesim::wire*>& out);
 };
 
 } /* namespace homebrew2021 */
@@ -0,0 +1,106 @@
+/**
+ * \file basic_register_model.cpp
+ *
+ * \brief basic_register_model constructor.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+
+#include "basic_register_model.h"
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Constructor for the basic register model.
+ *
+ * The pins match the basic register constructor.
+ */
+homebrew2021::basic_register_model::basic_register_model(
+    wire* clock, wire* clear, wire* read, wire* write,
+    const vector<wire*>& in, const vector<wire*>& out)
+        : inputs(in)
+        , outputs(out)
+        , value(0)
+        , conn_type(WIRE_CONNECTION_TYPE_HIGH_Z)
+{
+    /* the structural register passes read and write through inverters. */
+    const double enable_delay = inverter_delay + ic74173_delay;
+
+    /* load each wire as the structural register does: clock and clear
+     * drive both 74173s, and read and write drive the inverters. */
+    for (auto o : outputs)
+        o->add_connection(conn_type);
+    for (auto i : inputs)
+        i->add_connection(WIRE_CONNECTION_TYPE_INPUT);
+    for (int i = 0; i < 2; ++i)
+    {
+        clock->add_connection(WIRE_CONNECTION_TYPE_INPUT);
+        clear->add_connection(WIRE_CONNECTION_TYPE_INPUT);
+    }
+    read->add_connection(WIRE_CONNECTION_TYPE_INPUT);
+    write->add_connection(WIRE_CONNECTION_TYPE_INPUT);
+
+    /* Lambda expression for outputting the register. */
+    auto output_register = [=]() {
+        if (read->get_signal() == false)
+        {
+            for (auto o : outputs)
+                o->change_connection_type(
+                    conn_type, WIRE_CONNECTION_TYPE_HIGH_Z, false);
+            conn_type = WIRE_CONNECTION_TYPE_HIGH_Z;
+        }
+        else
+        {
+            for (size_t i = 0; i < outputs.size(); ++i)
+                outputs[i]->change_connection_type(
+                    conn_type, WIRE_CONNECTION_TYPE_OUTPUT,
+                    (value >> i) & 1);
+            conn_type = WIRE_CONNECTION_TYPE_OUTPUT;
+        }
+    };
+
+    /* Lambda expression for clearing the register. */
+    auto clear_signal_proc = [=]() {
+        if (clear->get_signal() == true)
+        {
+            global_agenda.add(ic74173_delay, [=]() {
+                value = 0;
+                output_register();
+            });
+        }
+    };
+
+    /* Lambda expression for handling clock states. */
+    auto clock_signal_proc = [=]() {
+        /* clear must be low for the following actions to propagate. */
+        if (clear->get_signal() == true)
+            return;
+
+        /* latch the inputs on a clock high while writing. */
+        if (clock->get_signal() == true && write->get_signal() == true)
+        {
+            global_agenda.add(ic74173_delay, [=]() {
+                value = 0;
+                for (size_t i = 0; i < inputs.size(); ++i)
+                    if (inputs[i]->get_signal())
+                        value |= 1 << i;
+
+                output_register();
+            });
+        }
+        else
+        {
+            global_agenda.add(ic74173_delay, output_register);
+        }
+    };
+
+    /* Lambda expression for read enable changes. */
+    auto read_signal_proc = [=]() {
+        global_agenda.add(enable_delay, output_register);
+    };
+
+    clear->add_action(clear_signal_proc);
+    clock->add_action(clock_signal_proc);
+    read->add_action(read_signal_proc);
+}
@@ -0,0 +1,55 @@
+/**
+ * \file basic_register_model.h
+ *
+ * \brief A behavioral model of the basic 8-bit register.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#pragma once
+
+#include <homesim/agenda.h>
+#include <homesim/ic/74173.h>
+#include <homesim/inverter.h>
+#include <homesim/wire.h>
+#include <vector>
+
+namespace homebrew2021
+{
+
+/**
+ * \brief The name under which the basic register's behavioral model is
+ * registered.
+ */
+constexpr const char* basic_register_model_name =
+    "homebrew2021::basic_register";
+
+/**
+ * \brief A behavioral model of the basic register.
+ *
+ * This model is equivalent at its pins to the basic register built from two
+ * 74173s and two inverters, including its timing, but it keeps the register as
+ * a single byte and drives all eight outputs from a single event.
+ */
+class basic_register_model
+{
+public:
+
+    /**
+     * \brief Constructor for the basic register model.
+     *
+     * The pins match the basic register constructor.
+     */
+    basic_register_model(
+        homesim::wire* clock, homesim::wire* clear,
+        homesim::wire* read, homesim::wire* write,
+        const std::vector<homesim::wire*>& in,
+        const std::vector<homesim::wire*>& out);
+
+private:
+    std::vector<homesim::wire*> inputs;
+    std::vector<homesim::wire*> outputs;
+    std::uint8_t value;
+    homesim::wire_connection_type conn_type;
+};
+
+} /* namespace homebrew2021 */
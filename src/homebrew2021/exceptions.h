@@ -7,6 +7,9 @@
  */
 #pragma once
 
+#include <stdexcept>
+#include <string>
+
 namespace homebrew2021
 {
 
@@ -7,6 +7,8 @@
  */
 
 #include <cassert>
+#include <cstring>
+#include <homesim/macro_model.h>
 #include <homesim/wire.h>
 #include <iostream>
 
@@ -32,6 +34,29 @@ verify_basic_register();
 
 int main(int argc, char* argv[])
 {
+    /* select how composites with behavioral models are built. */
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "--structural"))
+        {
+            global_macro_models.set_default_mode(MACRO_MODEL_MODE_STRUCTURAL);
+        }
+        else if (!strcmp(argv[i], "--behavioral"))
+        {
+            global_macro_models.set_default_mode(MACRO_MODEL_MODE_BEHAVIORAL);
+        }
+        else if (!strcmp(argv[i], "--cosimulate"))
+        {
+            global_macro_models.set_default_mode(MACRO_MODEL_MODE_COSIMULATE);
+        }
+        else
+        {
+            cerr << "Usage: " << argv[0]
+                 << " [--structural | --behavioral | --cosimulate]" << endl;
+            return 1;
+        }
+    }
+
     /* verify that the basic register works. */
     verify_basic_register();
 
@@ -137,7 +162,15 @@ int main(int argc, char* argv[])
         flagsreg.get(), dbus.get(), clock.get(), ctrl_clr_flags.get(),
         ctrl_read_flags.get(), ctrl_write_flags.get());
 
-    return 0;
+    /* report any divergence between structural and behavioral models. */
+    for (const auto& d : global_macro_models.divergences())
+    {
+        cerr << "Divergence in " << d.composite << " pin " << d.pin
+             << " at " << d.time << "s: structural " << d.structural_signal
+             << ", behavioral " << d.behavioral_signal << endl;
+    }
+
+    return global_macro_models.divergences().empty() ? 0 : 1;
 }
 
 static void
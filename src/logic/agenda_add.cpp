@@ -6,6 +6,7 @@
  * \copyright Copyright 2020 Justin Handville. All rights reserved.
  */
 #include <homesim/agenda.h>
+#include <homesim/wire.h>
 
 using namespace homesim;
 using namespace std;
@@ -18,5 +19,19 @@ using namespace std;
  */
 void homesim::agenda::add(double delay, function<void ()> action)
 {
+    /* an event scheduled by an owned action runs with the same owner. */
+    auto owner = wire_owner::current();
+    if (nullptr != owner)
+    {
+        queue.emplace(
+            time + delay,
+            [=]() {
+                wire_owner::scope s(owner);
+                action();
+            });
+
+        return;
+    }
+
     queue.emplace(time + delay, action);
 }
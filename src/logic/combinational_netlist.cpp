@@ -0,0 +1,19 @@
+/**
+ * \file logic/combinational_netlist.cpp
+ *
+ * \brief Combinational netlist constructor.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/combinational_netlist.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Combinational netlist constructor.
+ */
+homesim::combinational_netlist::combinational_netlist()
+    : elaborated(false)
+{
+}
@@ -0,0 +1,59 @@
+/**
+ * \file logic/combinational_netlist_add_gate.cpp
+ *
+ * \brief Add a gate to a combinational netlist.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/combinational_netlist.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Add a single input gate to the netlist.
+ *
+ * \param op        The gate operation; a buffer or an inverter.
+ * \param a         The input node.
+ * \param delay     The gate delay in seconds.
+ *
+ * \returns the node for the gate output.
+ */
+int homesim::combinational_netlist::add_gate(
+    lut_gate_op op, int a, double delay)
+{
+    if (LUT_GATE_OP_BUFFER != op && LUT_GATE_OP_INVERTER != op)
+        throw lut_error("Gate requires two inputs.");
+
+    if (a < 0 || a >= (int)nodes.size())
+        throw lut_error("Gate input refers to an unknown node.");
+
+    nodes.push_back(node{ op, a, -1, delay, nullptr });
+
+    return nodes.size() - 1;
+}
+
+/**
+ * \brief Add a two input gate to the netlist.
+ *
+ * \param op        The gate operation.
+ * \param a         The first input node.
+ * \param b         The second input node.
+ * \param delay     The gate delay in seconds.
+ *
+ * \returns the node for the gate output.
+ */
+int homesim::combinational_netlist::add_gate(
+    lut_gate_op op, int a, int b, double delay)
+{
+    if (LUT_GATE_OP_BUFFER == op || LUT_GATE_OP_INVERTER == op)
+        throw lut_error("Gate requires a single input.");
+
+    /* only earlier nodes can be referenced, so there are no cycles. */
+    if (a < 0 || a >= (int)nodes.size() || b < 0 || b >= (int)nodes.size())
+        throw lut_error("Gate input refers to an unknown node.");
+
+    nodes.push_back(node{ op, a, b, delay, nullptr });
+
+    return nodes.size() - 1;
+}
@@ -0,0 +1,28 @@
+/**
+ * \file logic/combinational_netlist_add_input.cpp
+ *
+ * \brief Add an input to a combinational netlist.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/combinational_netlist.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Add an input to the netlist.
+ *
+ * \param w         The wire driving this input.
+ *
+ * \returns the node for this input.
+ */
+int homesim::combinational_netlist::add_input(wire* w)
+{
+    if (nullptr == w)
+        throw lut_error("Netlist inputs require a wire.");
+
+    nodes.push_back(node{ LUT_GATE_OP_BUFFER, -1, -1, 0.0, w });
+
+    return nodes.size() - 1;
+}
@@ -0,0 +1,28 @@
+/**
+ * \file logic/combinational_netlist_add_output.cpp
+ *
+ * \brief Add an output to a combinational netlist.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/combinational_netlist.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Drive an output wire from a node.
+ *
+ * \param node      The node driving this output.
+ * \param w         The output wire.
+ */
+void homesim::combinational_netlist::add_output(int node, wire* w)
+{
+    if (node < 0 || node >= (int)nodes.size())
+        throw lut_error("Output refers to an unknown node.");
+
+    if (nullptr == w)
+        throw lut_error("Netlist outputs require a wire.");
+
+    outputs.push_back(make_pair(node, w));
+}
@@ -0,0 +1,221 @@
+/**
+ * \file logic/combinational_netlist_elaborate.cpp
+ *
+ * \brief Elaborate a combinational netlist into components.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/combinational_netlist.h>
+#include <algorithm>
+#include <homesim/buffer.h>
+
+using namespace homesim;
+using namespace std;
+
+namespace {
+
+/**
+ * \brief A group of outputs that share a single lookup table.
+ */
+struct lut_group
+{
+    vector<int> support;
+    vector<size_t> outputs;
+    double delay;
+};
+
+/**
+ * \brief Evaluate a single gate operation.
+ */
+bool eval_op(lut_gate_op op, bool a, bool b)
+{
+    switch (op)
+    {
+        case LUT_GATE_OP_BUFFER:    return a;
+        case LUT_GATE_OP_INVERTER:  return !a;
+        case LUT_GATE_OP_AND:       return a && b;
+        case LUT_GATE_OP_OR:        return a || b;
+        case LUT_GATE_OP_NAND:      return !(a && b);
+        case LUT_GATE_OP_NOR:       return !(a || b);
+        case LUT_GATE_OP_XOR:       return a != b;
+        case LUT_GATE_OP_XNOR:      return a == b;
+    }
+
+    return false;
+}
+
+} /* anonymous namespace */
+
+/**
+ * \brief Elaborate the netlist into components.
+ *
+ * The delay of each lookup table is the longest path delay of the cones it
+ * replaces.  A netlist can only be elaborated once.
+ *
+ * \param max_inputs    The maximum number of inputs for a lookup table.
+ */
+void homesim::combinational_netlist::elaborate(unsigned int max_inputs)
+{
+    if (elaborated)
+        throw lut_error("Netlist already elaborated.");
+
+    if (max_inputs > lut_max_inputs)
+        throw lut_error("Too many lookup table inputs.");
+
+    elaborated = true;
+
+    /* nodes are in topological order, so arrival times are a single pass. */
+    vector<double> arrival(nodes.size(), 0.0);
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        const node& g = nodes[i];
+        if (nullptr != g.input)
+            continue;
+
+        double in_time = arrival[g.a];
+        if (g.b >= 0)
+            in_time = max(in_time, arrival[g.b]);
+
+        arrival[i] = in_time + g.delay;
+    }
+
+    /* trace the cone of each output, and group the small ones. */
+    vector<lut_group> groups;
+    vector<size_t> fallback;
+    for (size_t o = 0; o < outputs.size(); ++o)
+    {
+        vector<bool> in_cone(nodes.size(), false);
+        mark_cone(outputs[o].first, in_cone);
+
+        vector<int> support;
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            if (in_cone[i] && nullptr != nodes[i].input)
+                support.push_back(i);
+        }
+
+        if (support.size() > max_inputs)
+        {
+            fallback.push_back(o);
+            continue;
+        }
+
+        /* share a table with the first group that still has room. */
+        lut_group* target = nullptr;
+        vector<int> merged;
+        for (auto& g : groups)
+        {
+            if (g.outputs.size() >= lut_max_outputs)
+                continue;
+
+            merged.clear();
+            set_union(
+                g.support.begin(), g.support.end(),
+                support.begin(), support.end(), back_inserter(merged));
+
+            if (merged.size() <= max_inputs)
+            {
+                target = &g;
+                break;
+            }
+        }
+
+        if (nullptr == target)
+        {
+            groups.push_back(
+                lut_group{ support, { o }, arrival[outputs[o].first] });
+            continue;
+        }
+
+        target->support.swap(merged);
+        target->outputs.push_back(o);
+        target->delay = max(target->delay, arrival[outputs[o].first]);
+    }
+
+    /* exhaustively evaluate each group into a truth table. */
+    vector<bool> value(nodes.size(), false);
+    for (auto& g : groups)
+    {
+        vector<bool> in_cone(nodes.size(), false);
+        for (auto o : g.outputs)
+            mark_cone(outputs[o].first, in_cone);
+
+        vector<int> cone;
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            if (in_cone[i] && nullptr == nodes[i].input)
+                cone.push_back(i);
+        }
+
+        auto table =
+            make_shared<vector<uint32_t>>(size_t(1) << g.support.size(), 0);
+
+        for (size_t addr = 0; addr < table->size(); ++addr)
+        {
+            for (size_t i = 0; i < g.support.size(); ++i)
+                value[g.support[i]] = (addr >> i) & 1U;
+
+            for (auto n : cone)
+            {
+                const node& gate = nodes[n];
+                value[n] =
+                    eval_op(
+                        gate.op, value[gate.a],
+                        gate.b >= 0 ? value[gate.b] : false);
+            }
+
+            uint32_t entry = 0;
+            for (size_t i = 0; i < g.outputs.size(); ++i)
+            {
+                if (value[outputs[g.outputs[i]].first])
+                    entry |= 1U << i;
+            }
+
+            (*table)[addr] = entry;
+        }
+
+        vector<wire*> in;
+        for (auto n : g.support)
+            in.push_back(nodes[n].input);
+
+        vector<wire*> out;
+        for (auto o : g.outputs)
+            out.push_back(outputs[o].second);
+
+        lut_list.push_back(make_shared<iclut>(in, out, table, g.delay));
+    }
+
+    if (fallback.empty())
+        return;
+
+    /* large cones are instantiated gate by gate. */
+    vector<bool> in_cone(nodes.size(), false);
+    vector<wire*> direct(nodes.size(), nullptr);
+    for (auto o : fallback)
+    {
+        int n = outputs[o].first;
+        mark_cone(n, in_cone);
+
+        /* the first output on a gate node is driven by that gate. */
+        if (nullptr == nodes[n].input && nullptr == direct[n])
+            direct[n] = outputs[o].second;
+    }
+
+    vector<wire*> node_wire(nodes.size(), nullptr);
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        if (in_cone[i])
+            instantiate(i, node_wire, direct[i]);
+    }
+
+    /* any other outputs are buffered from their node. */
+    for (auto o : fallback)
+    {
+        int n = outputs[o].first;
+        if (node_wire[n] != outputs[o].second)
+        {
+            gate_list.push_back(
+                make_shared<buffer>(node_wire[n], outputs[o].second, 0.0));
+        }
+    }
+}
@@ -0,0 +1,19 @@
+/**
+ * \file logic/combinational_netlist_fallback_gates.cpp
+ *
+ * \brief Get the number of fallback gates in a combinational netlist.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/combinational_netlist.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Return the number of fallback gates created by elaboration.
+ */
+size_t homesim::combinational_netlist::fallback_gates() const
+{
+    return gate_list.size();
+}
@@ -0,0 +1,88 @@
+/**
+ * \file logic/combinational_netlist_instantiate.cpp
+ *
+ * \brief Instantiate a fallback gate for a combinational netlist node.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/combinational_netlist.h>
+#include <homesim/and_gate.h>
+#include <homesim/buffer.h>
+#include <homesim/inverter.h>
+#include <homesim/nand_gate.h>
+#include <homesim/nor_gate.h>
+#include <homesim/or_gate.h>
+#include <homesim/xnor_gate.h>
+#include <homesim/xor_gate.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Instantiate the gates for a node that can't be collapsed.
+ *
+ * The inputs of this node must already be instantiated.
+ *
+ * \param n         The node to instantiate.
+ * \param node_wire The wire for each node instantiated so far.
+ * \param outp      The wire to drive, or nullptr for an internal wire.
+ */
+void homesim::combinational_netlist::instantiate(
+    int n, vector<wire*>& node_wire, wire* outp)
+{
+    const node& g = nodes[n];
+
+    /* netlist inputs are driven by their own wire. */
+    if (nullptr != g.input)
+    {
+        node_wire[n] = g.input;
+        return;
+    }
+
+    if (nullptr == outp)
+    {
+        auto w = make_shared<wire>();
+        internal_wires.push_back(w);
+        outp = w.get();
+    }
+
+    wire* a = node_wire[g.a];
+    wire* b = (g.b >= 0) ? node_wire[g.b] : nullptr;
+
+    switch (g.op)
+    {
+        case LUT_GATE_OP_BUFFER:
+            gate_list.push_back(make_shared<buffer>(a, outp, g.delay));
+            break;
+
+        case LUT_GATE_OP_INVERTER:
+            gate_list.push_back(make_shared<inverter>(a, outp, g.delay));
+            break;
+
+        case LUT_GATE_OP_AND:
+            gate_list.push_back(make_shared<and_gate>(a, b, outp, g.delay));
+            break;
+
+        case LUT_GATE_OP_OR:
+            gate_list.push_back(make_shared<or_gate>(a, b, outp, g.delay));
+            break;
+
+        case LUT_GATE_OP_NAND:
+            gate_list.push_back(make_shared<nand_gate>(a, b, outp, g.delay));
+            break;
+
+        case LUT_GATE_OP_NOR:
+            gate_list.push_back(make_shared<nor_gate>(a, b, outp, g.delay));
+            break;
+
+        case LUT_GATE_OP_XOR:
+            gate_list.push_back(make_shared<xor_gate>(a, b, outp, g.delay));
+            break;
+
+        case LUT_GATE_OP_XNOR:
+            gate_list.push_back(make_shared<xnor_gate>(a, b, outp, g.delay));
+            break;
+    }
+
+    node_wire[n] = outp;
+}
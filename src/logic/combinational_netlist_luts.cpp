@@ -0,0 +1,19 @@
+/**
+ * \file logic/combinational_netlist_luts.cpp
+ *
+ * \brief Get the number of lookup tables in a combinational netlist.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/combinational_netlist.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Return the number of lookup tables created by elaboration.
+ */
+size_t homesim::combinational_netlist::luts() const
+{
+    return lut_list.size();
+}
@@ -0,0 +1,39 @@
+/**
+ * \file logic/combinational_netlist_mark_cone.cpp
+ *
+ * \brief Mark the cone of a combinational netlist node.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/combinational_netlist.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Mark every node in the cone of the given node.
+ *
+ * \param n         The root of the cone.
+ * \param in_cone   Set to true for each node in the cone.
+ */
+void homesim::combinational_netlist::mark_cone(
+    int n, vector<bool>& in_cone) const
+{
+    vector<int> pending{ n };
+
+    while (!pending.empty())
+    {
+        int i = pending.back();
+        pending.pop_back();
+
+        if (in_cone[i])
+            continue;
+
+        in_cone[i] = true;
+
+        if (nodes[i].a >= 0)
+            pending.push_back(nodes[i].a);
+        if (nodes[i].b >= 0)
+            pending.push_back(nodes[i].b);
+    }
+}
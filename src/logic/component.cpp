@@ -16,10 +16,19 @@ using namespace std;
  * \param pins      Initializer list of pins.
  */
 homesim::component::component(initializer_list<string> pins)
-    : pin_name_array(pins)
+    : table(&component_pin_table::intern(pins))
+    , pin_wires(table->size(), nullptr)
+{
+}
+
+/**
+ * \brief Constructor for component with a shared pin table.
+ *
+ * \param table     The pin table for this component type, which must
+ *                  outlive this instance.
+ */
+homesim::component::component(const component_pin_table& table)
+    : table(&table)
+    , pin_wires(table.size(), nullptr)
 {
-    for (auto pn : pin_name_array)
-    {
-        pin_map.insert(make_pair(pn, nullptr));
-    }
 }
@@ -0,0 +1,26 @@
+/**
+ * \file logic/component_configure.cpp
+ *
+ * \brief Configure a component.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Configure this component.
+ *
+ * By default, components have no configuration.
+ *
+ * \param key       The configuration key.
+ *
+ * \throws \ref invalid_config_error if the key or value is invalid.
+ */
+void homesim::component::configure(
+    const string& key, const string& /*value*/)
+{
+    throw invalid_config_error(string("Config ") + key + " is invalid.");
+}
@@ -0,0 +1,28 @@
+/**
+ * \file logic/component_configure_value.cpp
+ *
+ * \brief Configure a component with a typed value.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Configure this component with a typed value.
+ *
+ * By default, the value is formatted as a string and passed to the string
+ * overload.
+ *
+ * \param key       The configuration key.
+ * \param value     The folded configuration value.
+ *
+ * \throws \ref invalid_config_error if the key or value is invalid.
+ */
+void homesim::component::configure(
+    const string& key, const config_value& value)
+{
+    configure(key, value.str());
+}
@@ -0,0 +1,23 @@
+/**
+ * \file logic/component_factory_contains.cpp
+ *
+ * \brief Check whether a component type is registered.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Check whether a component type is registered.
+ *
+ * \param type      The name of the component type.
+ */
+bool homesim::component_factory::contains(const string& type) const
+{
+    return
+        component_map.end() != component_map.find(type)
+     || arena_component_map.end() != arena_component_map.find(type);
+}
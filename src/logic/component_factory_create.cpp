@@ -25,3 +25,22 @@ shared_ptr<component> homesim::component_factory::create(const string& type)
 
     return f->second();
 }
+
+/**
+ * \brief Create a component by type, allocating it from an arena if the type
+ * supports it.
+ *
+ * \param type      The name of the component to create.
+ * \param arena     The arena for this component, which must outlive it.
+ *
+ * \throws \ref unknown_component_error if the component type is unknown.
+ */
+shared_ptr<component> homesim::component_factory::create(
+    const string& type, netlist_arena& arena)
+{
+    auto f = arena_component_map.find(type);
+    if (arena_component_map.end() == f)
+        return create(type);
+
+    return f->second(arena);
+}
@@ -0,0 +1,24 @@
+/**
+ * \file logic/component_factory_register_arena_component.cpp
+ *
+ * \brief Register an arena component constructor with the component factory.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Register a component constructor that allocates from an arena.
+ *
+ * \param type      The type of the component to register.
+ * \param ctor      The arena component constructor function to register.
+ */
+void homesim::component_factory::register_arena_component(
+    const string& type,
+    function<shared_ptr<component> (netlist_arena&)> ctor)
+{
+    arena_component_map.insert(make_pair(type, ctor));
+}
@@ -1,7 +1,7 @@
 /**
  * \file logic/component_get_wire.cpp
  *
- * \brief Get the wire for a pin by name.
+ * \brief Get the wire for a pin.
  *
  * \copyright Copyright 2020 Justin Handville. All rights reserved.
  */
@@ -19,12 +19,24 @@ using namespace std;
  */
 wire* homesim::component::get_wire(const std::string& pin_name)
 {
-    auto f = pin_map.find(pin_name);
-    if (pin_map.end() == f)
+    int index = table->find(pin_name);
+    if (index < 0)
         throw invalid_pin_error(pin_name);
 
-    if (nullptr == f->second)
-        throw missing_wire_error(pin_name);
+    return get_wire(index);
+}
+
+/**
+ * \brief Get the wire for a pin by index.
+ *
+ * \param index     The index of the pin to get.
+ *
+ * \throws \ref missing_wire_error if the wire is missing.
+ */
+wire* homesim::component::get_wire(int index)
+{
+    if (nullptr == pin_wires[index])
+        throw missing_wire_error(table->name(index));
 
-    return f->second;
+    return pin_wires[index];
 }
@@ -0,0 +1,21 @@
+/**
+ * \file logic/component_is_bound.cpp
+ *
+ * \brief Check whether a pin of a component is bound to a wire.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Is a wire bound to the given pin?
+ *
+ * \param index     The index of the pin.
+ */
+bool homesim::component::is_bound(int index) const
+{
+    return nullptr != pin_wires[index];
+}
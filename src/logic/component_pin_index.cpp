@@ -0,0 +1,23 @@
+/**
+ * \file logic/component_pin_index.cpp
+ *
+ * \brief Get the index of a pin by name.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the index of a pin by name.
+ *
+ * \param name      The name of the pin.
+ *
+ * \returns the pin index, or -1 if there is no such pin.
+ */
+int homesim::component::pin_index(const string& name) const
+{
+    return table->find(name);
+}
@@ -17,5 +17,5 @@ using namespace std;
  */
 const string& homesim::component::pin_name(int index) const
 {
-    return pin_name_array[index];
+    return table->name(index);
 }
@@ -0,0 +1,55 @@
+/**
+ * \file logic/component_pin_table.cpp
+ *
+ * \brief Component pin table constructor.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+#include <unordered_set>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Constructor for a component pin table.
+ *
+ * \param pins      Initializer list of pins, in pin index order.
+ *
+ * \throws \ref invalid_pin_error if a pin name is repeated.
+ */
+homesim::component_pin_table::component_pin_table(
+    initializer_list<string> pins)
+        : component_pin_table(vector<string>(pins))
+{
+}
+
+/**
+ * \brief Constructor for a component pin table.
+ *
+ * \param pins      Vector of pins, in pin index order.
+ *
+ * \throws \ref invalid_pin_error if a pin name is repeated.
+ */
+homesim::component_pin_table::component_pin_table(
+    const vector<string>& pins)
+        : names(pins)
+        , slot_mask(0)
+{
+    /* a perfect hash requires unique names. */
+    unordered_set<string> seen;
+    for (auto& n : names)
+    {
+        if (!seen.insert(n).second)
+            throw invalid_pin_error(string("Pin ") + n + " is repeated.");
+    }
+
+    /* start with the smallest power of two that fits every pin, and grow
+     * until every pin finds a slot. */
+    size_t slot_count = 1;
+    while (slot_count < names.size())
+        slot_count *= 2;
+
+    while (!build_hash(slot_count))
+        slot_count *= 2;
+}
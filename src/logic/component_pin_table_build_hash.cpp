@@ -0,0 +1,90 @@
+/**
+ * \file logic/component_pin_table_build_hash.cpp
+ *
+ * \brief Build the perfect hash for a component pin table.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+#include <algorithm>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief The number of seeds to try for a bucket before growing the table.
+ */
+static const uint32_t max_seed_attempts = 4096;
+
+/**
+ * \brief Attempt to build the perfect hash with the given slot count.
+ *
+ * This is a hash and displace scheme.  The first hash places each name in a
+ * bucket, and each bucket then searches for a seed that moves all of its names
+ * into empty slots.  The largest buckets are placed first, while the most
+ * slots are free.
+ *
+ * \param slot_count    The number of slots, a power of two.
+ *
+ * \returns true if every pin found a slot.
+ */
+bool homesim::component_pin_table::build_hash(size_t slot_count)
+{
+    size_t bucket_count = max<size_t>(1, names.size() / 2);
+
+    slot_mask = slot_count - 1;
+    slots.assign(slot_count, -1);
+    seeds.assign(bucket_count, 0);
+
+    /* group the names by bucket. */
+    vector<vector<int>> buckets(bucket_count);
+    for (size_t i = 0; i < names.size(); ++i)
+        buckets[hash(names[i], 0) % bucket_count].push_back(i);
+
+    vector<size_t> order(bucket_count);
+    for (size_t i = 0; i < bucket_count; ++i)
+        order[i] = i;
+
+    stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    vector<size_t> placed;
+    for (auto b : order)
+    {
+        if (buckets[b].empty())
+            break;
+
+        bool found = false;
+        for (uint32_t seed = 1; !found && seed <= max_seed_attempts; ++seed)
+        {
+            /* every name in this bucket must land in a distinct free slot. */
+            placed.clear();
+            found = true;
+            for (auto i : buckets[b])
+            {
+                size_t slot = hash(names[i], seed) & slot_mask;
+                auto taken = std::find(placed.begin(), placed.end(), slot);
+                if (slots[slot] >= 0 || taken != placed.end())
+                {
+                    found = false;
+                    break;
+                }
+
+                placed.push_back(slot);
+            }
+
+            if (found)
+            {
+                seeds[b] = seed;
+                for (size_t j = 0; j < placed.size(); ++j)
+                    slots[placed[j]] = buckets[b][j];
+            }
+        }
+
+        if (!found)
+            return false;
+    }
+
+    return true;
+}
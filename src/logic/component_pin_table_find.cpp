@@ -0,0 +1,33 @@
+/**
+ * \file logic/component_pin_table_find.cpp
+ *
+ * \brief Find a pin index in a component pin table.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Find the index of a pin by name.
+ *
+ * \param name      The name of the pin to find.
+ *
+ * \returns the pin index, or -1 if there is no such pin.
+ */
+int homesim::component_pin_table::find(const string& name) const
+{
+    if (names.empty())
+        return -1;
+
+    /* the perfect hash gives the only slot this name could be in. */
+    uint32_t seed = seeds[hash(name, 0) % seeds.size()];
+    int index = slots[hash(name, seed) & slot_mask];
+
+    if (index < 0 || names[index] != name)
+        return -1;
+
+    return index;
+}
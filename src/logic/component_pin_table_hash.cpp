@@ -0,0 +1,37 @@
+/**
+ * \file logic/component_pin_table_hash.cpp
+ *
+ * \brief Hash a pin name for a component pin table.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Hash a pin name with the given seed.
+ *
+ * This is FNV-1a with a seeded offset basis and a final avalanche step, so
+ * that different seeds scatter the same names independently.
+ *
+ * \param name      The pin name to hash.
+ * \param seed      The seed for this hash.
+ */
+uint32_t homesim::component_pin_table::hash(const string& name, uint32_t seed)
+{
+    uint32_t h = 2166136261U ^ (seed * 0x9E3779B9U);
+
+    for (unsigned char c : name)
+    {
+        h ^= c;
+        h *= 16777619U;
+    }
+
+    h ^= h >> 16;
+    h *= 0x85EBCA6BU;
+    h ^= h >> 13;
+
+    return h;
+}
@@ -0,0 +1,37 @@
+/**
+ * \file logic/component_pin_table_intern.cpp
+ *
+ * \brief Get a shared component pin table.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+#include <mutex>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the shared pin table for a list of pins.
+ *
+ * Components that list their pins at construction share a single table per
+ * distinct pin list.  Interned tables live for the whole process.
+ *
+ * \param pins      Initializer list of pins, in pin index order.
+ */
+const component_pin_table& homesim::component_pin_table::intern(
+    initializer_list<string> pins)
+{
+    static mutex table_lock;
+    static map<vector<string>, unique_ptr<component_pin_table>> tables;
+
+    vector<string> key(pins);
+
+    lock_guard<mutex> guard(table_lock);
+
+    auto& table = tables[key];
+    if (!table)
+        table = make_unique<component_pin_table>(key);
+
+    return *table;
+}
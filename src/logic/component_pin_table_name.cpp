@@ -0,0 +1,21 @@
+/**
+ * \file logic/component_pin_table_name.cpp
+ *
+ * \brief Get a pin name from a component pin table.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the pin name for the given index.
+ *
+ * \param index     The index of the pin name to get.
+ */
+const string& homesim::component_pin_table::name(int index) const
+{
+    return names[index];
+}
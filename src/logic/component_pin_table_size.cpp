@@ -0,0 +1,19 @@
+/**
+ * \file logic/component_pin_table_size.cpp
+ *
+ * \brief Get the number of pins in a component pin table.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/component.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the number of pins in this table.
+ */
+int homesim::component_pin_table::size() const
+{
+    return names.size();
+}
@@ -15,5 +15,5 @@ using namespace std;
  */
 int homesim::component::pins() const
 {
-    return pin_name_array.size();
+    return table->size();
 }
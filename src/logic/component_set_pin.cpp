@@ -22,14 +22,34 @@ using namespace std;
  */
 void homesim::component::set_pin(const string& name, wire* w)
 {
-    /* attempt to find the pin by name. */
-    auto f = pin_map.find(name);
-    if (f == pin_map.end())
+    /* resolve the pin name to its index. */
+    int index = table->find(name);
+    if (index < 0)
         throw invalid_pin_error(string("Pin ") + name + " is invalid.");
 
+    set_pin(index, w);
+}
+
+/**
+ * \brief Set a pin, by index, to the given wire.
+ *
+ * \param index     The index of the pin to set.
+ * \param w         The wire to set.
+ *
+ * \throws
+ *      - \ref invalid_pin_error if the pin index is invalid.
+ *      - \ref pin_binding_error if the pin is already bound.
+ */
+void homesim::component::set_pin(int index, wire* w)
+{
+    if (index < 0 || index >= (int)pin_wires.size())
+        throw invalid_pin_error(
+            string("Pin index ") + to_string(index) + " is invalid.");
+
     /* verify it is not already bound. */
-    if (nullptr != f->second)
-        throw pin_binding_error(string("Pin ") + name + " is already bound.");
+    if (nullptr != pin_wires[index])
+        throw pin_binding_error(
+            string("Pin ") + table->name(index) + " is already bound.");
 
-    f->second = w;
+    pin_wires[index] = w;
 }
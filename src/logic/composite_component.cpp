@@ -0,0 +1,27 @@
+/**
+ * \file logic/composite_component.cpp
+ *
+ * \brief Composite component constructor.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Composite component constructor.
+ *
+ * \param def       The shared definition.
+ * \param arena     The arena for the children, or nullptr for the heap.
+ */
+homesim::composite_component::composite_component(
+    shared_ptr<const composite_definition> def, netlist_arena* arena)
+        : component(def->pin_table())
+        , def(def)
+        , arena(arena)
+        , names(nullptr)
+        , built(false)
+{
+}
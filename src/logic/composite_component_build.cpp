@@ -0,0 +1,84 @@
+/**
+ * \file logic/composite_component_build.cpp
+ *
+ * \brief Flatten and build a composite component.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Flatten this composite into its children and build them.
+ */
+void homesim::composite_component::build()
+{
+    if (built)
+        return;
+
+    /* exported nets use the bound pin wires; the rest are internal. */
+    net_wires.reserve(def->nets.size());
+    for (auto& n : def->nets)
+    {
+        wire* w;
+
+        if (n.port >= 0)
+        {
+            w = get_wire(n.port);
+        }
+        else if (nullptr != arena)
+        {
+            w = arena->create<wire>(arena);
+        }
+        else
+        {
+            heap_wires.push_back(make_unique<wire>());
+            w = heap_wires.back().get();
+        }
+
+        net_wires.push_back(w);
+
+        if (nullptr != names && n.port < 0)
+            names->add(w, path + "." + n.name);
+    }
+
+    /* create and configure each child. */
+    children.reserve(def->children.size());
+    for (auto& c : def->children)
+    {
+        auto child =
+            (nullptr != arena)
+                ? def->factory->create(c.type, *arena)
+                : def->factory->create(c.type);
+
+        for (auto& cfg : c.config)
+            child->configure(cfg.first, cfg.second);
+
+        if (nullptr != names)
+        {
+            string child_path = path + "." + c.name;
+            names->add(child.get(), child_path);
+
+            auto sub = dynamic_cast<composite_component*>(child.get());
+            if (nullptr != sub)
+                sub->set_hierarchy(names, child_path);
+        }
+
+        children.push_back(child);
+    }
+
+    /* wire each child pin by its resolved index. */
+    for (size_t i = 0; i < def->nets.size(); ++i)
+    {
+        for (auto& p : def->nets[i].pins)
+            children[p.first]->set_pin(p.second, net_wires[i]);
+    }
+
+    /* build the children, flattening any nested composites. */
+    for (auto& child : children)
+        child->build();
+
+    built = true;
+}
@@ -0,0 +1,24 @@
+/**
+ * \file logic/composite_component_set_hierarchy.cpp
+ *
+ * \brief Record hierarchical names for a composite.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Record hierarchical names for this instance when it is built.
+ *
+ * \param names     The side table for the names.
+ * \param path      The hierarchical name of this instance.
+ */
+void homesim::composite_component::set_hierarchy(
+    hierarchy_names* names, const string& path)
+{
+    this->names = names;
+    this->path = path;
+}
@@ -0,0 +1,22 @@
+/**
+ * \file logic/composite_definition.cpp
+ *
+ * \brief Composite definition constructor.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Composite definition constructor.
+ *
+ * \param factory   The factory used to create the children.  This must
+ *                  outlive the definition and its instances.
+ */
+homesim::composite_definition::composite_definition(component_factory& factory)
+    : factory(&factory)
+{
+}
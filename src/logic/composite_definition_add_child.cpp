@@ -0,0 +1,31 @@
+/**
+ * \file logic/composite_definition_add_child.cpp
+ *
+ * \brief Add a child to a composite definition.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Add a child component.
+ *
+ * \param name      The name of the child within this composite.
+ * \param type      The component type of the child.
+ *
+ * \returns the index of the child.
+ *
+ * \throws \ref unknown_component_error if the type is unknown.
+ */
+int homesim::composite_definition::add_child(
+    const string& name, const string& type)
+{
+    /* this also verifies that the type exists. */
+    prototypes.push_back(factory->create(type));
+    children.push_back(child{ name, type, {} });
+
+    return children.size() - 1;
+}
@@ -0,0 +1,35 @@
+/**
+ * \file logic/composite_definition_add_net.cpp
+ *
+ * \brief Add a net to a composite definition.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Add a net.
+ *
+ * \param name      The name of the net within this composite.
+ * \param exported  If true, this net is also a pin of the composite.
+ *
+ * \returns the index of the net.
+ */
+int homesim::composite_definition::add_net(const string& name, bool exported)
+{
+    int port = -1;
+
+    /* the pin table is built from the ports when it is first used. */
+    if (exported)
+    {
+        ports.push_back(name);
+        port = ports.size() - 1;
+    }
+
+    nets.push_back(net{ name, port, {} });
+
+    return nets.size() - 1;
+}
@@ -0,0 +1,27 @@
+/**
+ * \file logic/composite_definition_configure_child.cpp
+ *
+ * \brief Configure a child of a composite definition.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Configure a child component.
+ *
+ * \param child     The index of the child.
+ * \param key       The configuration key.
+ * \param value     The configuration value.
+ */
+void homesim::composite_definition::configure_child(
+    int child, const string& key, const string& value)
+{
+    /* check the configuration once, against the prototype. */
+    prototypes[child]->configure(key, value);
+
+    children[child].config.push_back(make_pair(key, value));
+}
@@ -0,0 +1,33 @@
+/**
+ * \file logic/composite_definition_connect.cpp
+ *
+ * \brief Connect a child pin in a composite definition.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Connect a child pin to a net.
+ *
+ * \param net       The index of the net.
+ * \param child     The index of the child.
+ * \param pin       The name of the child pin.
+ *
+ * \throws \ref invalid_pin_error if the child has no such pin.
+ */
+void homesim::composite_definition::connect(
+    int net, int child, const string& pin)
+{
+    /* resolve the pin name once, here, rather than for every instance. */
+    int index = prototypes[child]->pin_index(pin);
+    if (index < 0)
+        throw invalid_pin_error(
+            string("Pin ") + children[child].name + "." + pin
+          + " is invalid.");
+
+    nets[net].pins.push_back(make_pair(child, index));
+}
@@ -0,0 +1,29 @@
+/**
+ * \file logic/composite_definition_instantiate.cpp
+ *
+ * \brief Create an instance of a composite definition.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Create an unbound instance of this composite.
+ *
+ * \param def       The shared definition.
+ * \param arena     The arena for the instance and its children, or nullptr
+ *                  to use the heap.
+ */
+shared_ptr<component> homesim::composite_definition::instantiate(
+    shared_ptr<const composite_definition> def, netlist_arena* arena)
+{
+    if (nullptr == arena)
+        return make_shared<composite_component>(def, arena);
+
+    return
+        allocate_shared<composite_component>(
+            arena_allocator<composite_component>(arena), def, arena);
+}
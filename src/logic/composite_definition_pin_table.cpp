@@ -0,0 +1,28 @@
+/**
+ * \file logic/composite_definition_pin_table.cpp
+ *
+ * \brief Get the pin table of a composite definition.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the pin table of the composite, which lists its exported nets.
+ * The table is built once, on first use.
+ *
+ * \throws \ref invalid_pin_error if two exported nets share a name.
+ */
+const component_pin_table& homesim::composite_definition::pin_table() const
+{
+    lock_guard<mutex> guard(pins_lock);
+
+    /* the table rejects repeated pin names. */
+    if (!pins)
+        pins = make_unique<component_pin_table>(ports);
+
+    return *pins;
+}
@@ -0,0 +1,28 @@
+/**
+ * \file logic/config_format_number.cpp
+ *
+ * \brief Format a configuration number.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <charconv>
+#include <homesim/config_value.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Format a number in its shortest form that reads back exactly.
+ *
+ * \param x             The number to format.
+ *
+ * \returns the formatted number.
+ */
+string homesim::config_format_number(double x)
+{
+    char buffer[32];
+
+    auto result = to_chars(buffer, buffer + sizeof(buffer), x);
+
+    return string(buffer, result.ptr);
+}
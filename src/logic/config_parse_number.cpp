@@ -0,0 +1,39 @@
+/**
+ * \file logic/config_parse_number.cpp
+ *
+ * \brief Parse a configuration number.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <cctype>
+#include <charconv>
+#include <homesim/config_value.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Parse a number, without allocating or consulting the locale.
+ *
+ * \param begin         The start of the text.
+ * \param end           One past the end of the text.
+ * \param out           Set to the number on success.
+ *
+ * \returns true if the whole text, ignoring surrounding blanks, is a number.
+ */
+bool homesim::config_parse_number(
+    const char* begin, const char* end, double& out)
+{
+    while (begin != end && isspace(static_cast<unsigned char>(*begin)))
+        ++begin;
+    while (begin != end && isspace(static_cast<unsigned char>(end[-1])))
+        --end;
+
+    /* from_chars does not accept a leading plus sign. */
+    if (begin != end && '+' == *begin)
+        ++begin;
+
+    auto result = from_chars(begin, end, out);
+
+    return errc() == result.ec && end == result.ptr;
+}
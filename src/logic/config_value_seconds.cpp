@@ -0,0 +1,34 @@
+/**
+ * \file logic/config_value_seconds.cpp
+ *
+ * \brief Get a configuration value in seconds.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/config_value.h>
+#include <homesim/constants.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get this value in seconds.
+ *
+ * \returns the value of a time, or of a plain number taken as seconds.
+ *
+ * \throws a \ref config_value_error if this value is not numeric.
+ */
+double homesim::config_value::seconds() const
+{
+    switch (type)
+    {
+        case CONFIG_VALUE_TIME:
+            return static_cast<double>(ticks) / ticks_per_second;
+
+        case CONFIG_VALUE_NUMBER:
+            return number;
+
+        default:
+            throw config_value_error("Expecting a time.");
+    }
+}
@@ -0,0 +1,34 @@
+/**
+ * \file logic/config_value_str.cpp
+ *
+ * \brief Format a configuration value as a string.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/config_value.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Format this value as a string.
+ *
+ * Times are formatted in seconds.
+ */
+string homesim::config_value::str() const
+{
+    switch (type)
+    {
+        case CONFIG_VALUE_NUMBER:
+            return config_format_number(number);
+
+        case CONFIG_VALUE_TIME:
+            return config_format_number(seconds());
+
+        case CONFIG_VALUE_BOOLEAN:
+            return boolean ? "true" : "false";
+
+        default:
+            return text;
+    }
+}
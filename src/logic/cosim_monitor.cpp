@@ -0,0 +1,23 @@
+/**
+ * \file logic/cosim_monitor.cpp
+ *
+ * \brief Co-simulation monitor constructor.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/macro_model.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Create a co-simulation monitor.
+ *
+ * \param composite     The name of the composite being monitored.
+ * \param tolerance     The time pins may disagree, in seconds.
+ */
+homesim::cosim_monitor::cosim_monitor(const string& composite, double tolerance)
+    : name(composite)
+    , tolerance(tolerance)
+{
+}
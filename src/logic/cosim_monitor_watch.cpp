@@ -0,0 +1,52 @@
+/**
+ * \file logic/cosim_monitor_watch.cpp
+ *
+ * \brief Watch a pair of wires for co-simulation divergence.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/agenda.h>
+#include <homesim/macro_model.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Watch a pair of wires for divergence.
+ *
+ * Any pull-ups or pull-downs on the structural wire are mirrored onto the
+ * behavioral wire, so that both wires settle the same way when released.
+ *
+ * \param pin           The name of the pin being watched.
+ * \param structural    The wire driven by the structural composite.
+ * \param behavioral    The shadow wire driven by the behavioral model.
+ */
+void homesim::cosim_monitor::watch(
+    const string& pin, wire* structural, wire* behavioral)
+{
+    /* mirror the weak pulls onto the shadow wire. */
+    for (int i = 0; i < structural->get_pull_ups(); ++i)
+        behavioral->add_connection(WIRE_CONNECTION_TYPE_PULL_UP);
+    for (int i = 0; i < structural->get_pull_downs(); ++i)
+        behavioral->add_connection(WIRE_CONNECTION_TYPE_PULL_DOWN);
+    behavioral->set_signal(structural->get_signal());
+
+    string composite = name;
+    double settle = tolerance;
+
+    /* compare the wires once they have had time to settle. */
+    auto compare = [=]() {
+        global_agenda.add(settle, [=]() {
+            if (structural->get_signal() != behavioral->get_signal())
+            {
+                global_macro_models.report_divergence(
+                    macro_model_divergence{
+                        global_agenda.current_time(), composite, pin,
+                        structural->get_signal(), behavioral->get_signal() });
+            }
+        });
+    };
+
+    structural->add_action(compare);
+    behavioral->add_action(compare);
+}
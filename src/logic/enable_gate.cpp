@@ -0,0 +1,30 @@
+/**
+ * \file logic/enable_gate.cpp
+ *
+ * \brief Enable gate constructor.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/enable_gate.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Enable gate constructor.
+ *
+ * \param enables   The active low enable pins for the component.
+ * \param wake      The catch-up action to run when the component wakes,
+ *                  if any inputs changed while it was asleep.
+ */
+homesim::enable_gate::enable_gate(
+    initializer_list<wire*> enables, function<void ()> wake)
+        : enables(enables)
+        , wake(wake)
+        , is_awake(true)
+        , missed(false)
+{
+    /* any enable pin change may put the component to sleep or wake it. */
+    for (auto e : this->enables)
+        e->add_action([=]() { update(); });
+}
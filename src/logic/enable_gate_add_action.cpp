@@ -0,0 +1,31 @@
+/**
+ * \file logic/enable_gate_add_action.cpp
+ *
+ * \brief Subscribe to a data input through an enable gate.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/enable_gate.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Subscribe to a data input, suspending the action while asleep.
+ *
+ * \param w         The data input wire.
+ * \param action    The action to run on input change while awake.
+ */
+void homesim::enable_gate::add_action(wire* w, function<void ()> action)
+{
+    w->add_action([=]() {
+        /* a sleeping component only remembers that it missed something. */
+        if (!is_awake)
+        {
+            missed = true;
+            return;
+        }
+
+        action();
+    });
+}
@@ -0,0 +1,19 @@
+/**
+ * \file logic/enable_gate_awake.cpp
+ *
+ * \brief Check whether an enable gate is awake.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/enable_gate.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Return true if every enable pin is low.
+ */
+bool homesim::enable_gate::awake() const
+{
+    return is_awake;
+}
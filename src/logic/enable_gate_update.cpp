@@ -0,0 +1,39 @@
+/**
+ * \file logic/enable_gate_update.cpp
+ *
+ * \brief Re-evaluate the enable pins of an enable gate.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/enable_gate.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Re-evaluate the enable pins, waking the component if needed.
+ */
+void homesim::enable_gate::update()
+{
+    bool now_awake = true;
+    for (auto e : enables)
+    {
+        if (e->get_signal())
+        {
+            now_awake = false;
+            break;
+        }
+    }
+
+    bool woke = now_awake && !is_awake;
+    is_awake = now_awake;
+
+    /* catch up once on anything that changed while asleep. */
+    if (woke && missed)
+    {
+        missed = false;
+
+        if (wake)
+            wake();
+    }
+}
@@ -0,0 +1,22 @@
+/**
+ * \file logic/hierarchy_names_add.cpp
+ *
+ * \brief Record a hierarchical name.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Record the hierarchical name of an object.
+ *
+ * \param object    The wire or component.
+ * \param path      The hierarchical name, such as "cpu.a.reg".
+ */
+void homesim::hierarchy_names::add(const void* object, const string& path)
+{
+    names[object] = path;
+}
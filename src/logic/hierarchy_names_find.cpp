@@ -0,0 +1,27 @@
+/**
+ * \file logic/hierarchy_names_find.cpp
+ *
+ * \brief Find a hierarchical name.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Find the hierarchical name of an object.
+ *
+ * \param object    The wire or component.
+ *
+ * \returns the name of this object, or an empty string if it has none.
+ */
+string homesim::hierarchy_names::find(const void* object) const
+{
+    auto f = names.find(object);
+    if (names.end() == f)
+        return string();
+
+    return f->second;
+}
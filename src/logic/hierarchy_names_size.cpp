@@ -0,0 +1,19 @@
+/**
+ * \file logic/hierarchy_names_size.cpp
+ *
+ * \brief Get the number of hierarchical names.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Return the number of names recorded.
+ */
+size_t homesim::hierarchy_names::size() const
+{
+    return names.size();
+}
@@ -31,11 +31,10 @@ homesim::ic7404::ic7404(
     wire* in1, wire* out1, wire* in2, wire* out2, wire* in3, wire* out3,
     wire* out4, wire* in4, wire* out5, wire* in5, wire* out6, wire* in6,
     double delay)
-    : g1(in1, out1, delay)
-    , g2(in2, out2, delay)
-    , g3(in3, out3, delay)
-    , g4(in4, out4, delay)
-    , g5(in5, out5, delay)
-    , g6(in6, out6, delay)
+    : gates(
+        {in1, in2, in3, in4, in5, in6}, {},
+        {out1, out2, out3, out4, out5, out6},
+        [](uint32_t a, uint32_t) -> uint32_t { return ~a; },
+        delay)
 {
 }
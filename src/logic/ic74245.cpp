@@ -38,6 +38,7 @@ homesim::ic74245::ic74245(
     wire* dir, wire* a1, wire* a2, wire* a3, wire* a4, wire* a5, wire* a6,
     wire* a7, wire* a8, wire* oe, wire* b8, wire* b7, wire* b6, wire* b5,
     wire* b4, wire* b3, wire* b2, wire* b1, double delay)
+        : enable({ oe })
 {
     a1->add_connection(WIRE_CONNECTION_TYPE_HIGH_Z);
     a2->add_connection(WIRE_CONNECTION_TYPE_HIGH_Z);
@@ -266,20 +267,23 @@ homesim::ic74245::ic74245(
 
     dir->add_action(update_wires);
     oe->add_action(update_wires);
-    a1->add_action(prop_a2b(a1, b1));
-    a2->add_action(prop_a2b(a2, b2));
-    a3->add_action(prop_a2b(a3, b3));
-    a4->add_action(prop_a2b(a4, b4));
-    a5->add_action(prop_a2b(a5, b5));
-    a6->add_action(prop_a2b(a6, b6));
-    a7->add_action(prop_a2b(a7, b7));
-    a8->add_action(prop_a2b(a8, b8));
-    b1->add_action(prop_b2a(a1, b1));
-    b2->add_action(prop_b2a(a2, b2));
-    b3->add_action(prop_b2a(a3, b3));
-    b4->add_action(prop_b2a(a4, b4));
-    b5->add_action(prop_b2a(a5, b5));
-    b6->add_action(prop_b2a(a6, b6));
-    b7->add_action(prop_b2a(a7, b7));
-    b8->add_action(prop_b2a(a8, b8));
+
+    /* data changes are dropped while OE is high; enabling the transceiver
+     * re-drives every channel, so no other catch-up is needed. */
+    enable.add_action(a1, prop_a2b(a1, b1));
+    enable.add_action(a2, prop_a2b(a2, b2));
+    enable.add_action(a3, prop_a2b(a3, b3));
+    enable.add_action(a4, prop_a2b(a4, b4));
+    enable.add_action(a5, prop_a2b(a5, b5));
+    enable.add_action(a6, prop_a2b(a6, b6));
+    enable.add_action(a7, prop_a2b(a7, b7));
+    enable.add_action(a8, prop_a2b(a8, b8));
+    enable.add_action(b1, prop_b2a(a1, b1));
+    enable.add_action(b2, prop_b2a(a2, b2));
+    enable.add_action(b3, prop_b2a(a3, b3));
+    enable.add_action(b4, prop_b2a(a4, b4));
+    enable.add_action(b5, prop_b2a(a5, b5));
+    enable.add_action(b6, prop_b2a(a6, b6));
+    enable.add_action(b7, prop_b2a(a7, b7));
+    enable.add_action(b8, prop_b2a(a8, b8));
 }
@@ -0,0 +1,96 @@
+/**
+ * \file logic/iclut.cpp
+ *
+ * \brief Lookup-table component.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/ic/lut.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief iclut constructor.
+ *
+ * The table must have exactly one entry for each combination of the inputs.
+ * Bit n of an entry holds the value of output n for that address.
+ *
+ * \param inputs    The input wires, in address bit order.
+ * \param outputs   The output wires, in table bit order.
+ * \param table     The shared truth table, with one entry per address.
+ * \param delay     The delay in seconds.
+ */
+homesim::iclut::iclut(
+    const vector<wire*>& inputs, const vector<wire*>& outputs,
+    shared_ptr<const vector<uint32_t>> table, double delay)
+        : in(inputs)
+        , out(outputs)
+        , table(table)
+        , delay(delay)
+        , address(0)
+        , y_bits(0)
+        , y_valid(false)
+        , scheduled_time(-1.0)
+{
+    if (in.size() > lut_max_inputs)
+        throw lut_error("Too many lookup table inputs.");
+
+    if (out.size() == 0 || out.size() > lut_max_outputs)
+        throw lut_error("Invalid number of lookup table outputs.");
+
+    /* verify that there is one entry per address. */
+    if (!this->table || this->table->size() != (size_t(1) << in.size()))
+        throw lut_error("Incorrect number of lookup table entries.");
+
+    uint32_t out_mask =
+        (out.size() == 32) ? 0xFFFFFFFFU : ((1U << out.size()) - 1U);
+
+    auto lut_update_fn = [=]() {
+        uint32_t y = (*this->table)[address] & out_mask;
+
+        /* only drive the outputs that changed, or all of them the first
+         * time. */
+        uint32_t changed = y_valid ? (y ^ y_bits) : out_mask;
+        y_bits = y;
+        y_valid = true;
+
+        for (size_t i = 0; changed; ++i, changed >>= 1)
+        {
+            if (changed & 1U)
+                out[i]->set_signal((y >> i) & 1U);
+        }
+    };
+
+    auto propagate_lut_update_fn = [=]() {
+        double when = global_agenda.current_time() + delay;
+
+        /* an update at this instant will already see the new address. */
+        if (when == scheduled_time)
+            return;
+
+        scheduled_time = when;
+        global_agenda.add(delay, lut_update_fn);
+    };
+
+    /* update the cached address and the outputs on input change. */
+    for (size_t i = 0; i < in.size(); ++i)
+    {
+        wire* a = in[i];
+        size_t mask = static_cast<size_t>(1) << i;
+
+        a->add_action([=]() {
+            /* only this wire's bit of the address can have changed. */
+            if (a->get_signal())
+                address |= mask;
+            else
+                address &= ~mask;
+
+            propagate_lut_update_fn();
+        });
+    }
+
+    /* a table without inputs is a constant; drive it once. */
+    if (in.empty())
+        propagate_lut_update_fn();
+}
@@ -0,0 +1,164 @@
+/**
+ * \file logic/icram.cpp
+ *
+ * \brief RAM IC.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+
+#include <homesim/agenda.h>
+#include <homesim/ic/ram.h>
+
+using namespace std;
+
+/**
+ * \brief icram constructor.
+ *
+ * \param addresses         Vector of address wire pointers, least
+ *                          significant first.  This must match the number
+ *                          of address bits for the memory.
+ * \param data              Vector of data wire pointers, least significant
+ *                          first.  This must match the word width of the
+ *                          memory.
+ * \param memory            The backing memory for this IC.
+ * \param ce                Chip Enable wire (low = chip enabled).
+ * \param oe                Output Enable wire (low = output words).
+ * \param we                Write Enable wire (low = write words).
+ * \param delay             The optional delay in seconds.
+ *
+ * \throws \ref memory_error if the wires don't match the memory.
+ */
+homesim::icram::icram(
+    const vector<wire*>& addresses, const vector<wire*>& data,
+    shared_ptr<paged_memory> memory, wire* ce, wire* oe, wire* we,
+    double delay)
+        : mem(memory)
+        , addr(addresses)
+        , data_bus(data)
+        , address(0)
+        , last_word(0)
+        , conn_type_bus(WIRE_CONNECTION_TYPE_HIGH_Z)
+        , enable({ ce }, [=]() {
+            /* catch up on address changes missed while deselected. */
+            address = 0;
+            for (size_t i = 0; i < addr.size(); ++i)
+            {
+                if (addr[i]->get_signal())
+                    address |= static_cast<size_t>(1) << i;
+            }
+        })
+{
+    /* the address lines must cover the memory. */
+    if (!mem || addr.size() != mem->address_bits())
+        throw memory_error("Address lines don't match memory size.");
+
+    /* the data lines must match the memory word. */
+    if (data_bus.size() != mem->word_bits())
+        throw memory_error("Data lines don't match memory word width.");
+
+    /* data lines start as high-Z. */
+    for (auto d : data_bus)
+        d->add_connection(WIRE_CONNECTION_TYPE_HIGH_Z);
+
+    /* address and control lines are input. */
+    for (auto a : addr)
+        a->add_connection(WIRE_CONNECTION_TYPE_INPUT);
+    ce->add_connection(WIRE_CONNECTION_TYPE_INPUT);
+    oe->add_connection(WIRE_CONNECTION_TYPE_INPUT);
+    we->add_connection(WIRE_CONNECTION_TYPE_INPUT);
+
+    auto release_bus = [=]() {
+        /* only release the bus if we are driving it. */
+        if (WIRE_CONNECTION_TYPE_OUTPUT != conn_type_bus)
+            return;
+
+        for (auto d : data_bus)
+            d->change_connection_type(
+                conn_type_bus, WIRE_CONNECTION_TYPE_HIGH_Z, false);
+        conn_type_bus = WIRE_CONNECTION_TYPE_HIGH_Z;
+    };
+
+    auto ram_update_fn = [=]() {
+        /* an unselected chip does nothing. */
+        if (ce->get_signal())
+        {
+            release_bus();
+        }
+        /* write the word on the data bus. */
+        else if (!we->get_signal())
+        {
+            release_bus();
+
+            uint32_t word = 0;
+            for (size_t i = 0; i < data_bus.size(); ++i)
+            {
+                if (data_bus[i]->get_signal())
+                    word |= static_cast<uint32_t>(1) << i;
+            }
+
+            mem->write(address, word);
+        }
+        /* output the word at the current address. */
+        else if (!oe->get_signal())
+        {
+            uint32_t word = mem->read(address);
+
+            /* if the bus is already driven, only drive the bits that
+             * changed. */
+            uint32_t changed = 0xFFFFFFFF;
+            if (WIRE_CONNECTION_TYPE_OUTPUT == conn_type_bus)
+                changed = word ^ last_word;
+
+            for (size_t i = 0; i < data_bus.size(); ++i)
+            {
+                if (changed & (static_cast<uint32_t>(1) << i))
+                {
+                    data_bus[i]->change_connection_type(
+                        conn_type_bus, WIRE_CONNECTION_TYPE_OUTPUT,
+                        (word >> i) & 1);
+                }
+            }
+            last_word = word;
+            conn_type_bus = WIRE_CONNECTION_TYPE_OUTPUT;
+        }
+        else
+        {
+            release_bus();
+        }
+    };
+
+    auto propagate_ram_update_fn = [=]() {
+        global_agenda.add(delay, ram_update_fn);
+    };
+
+    /* update the cached address and the RAM state on address line change.
+     * These are suspended while the chip is deselected. */
+    for (size_t i = 0; i < addr.size(); ++i)
+    {
+        wire* a = addr[i];
+        size_t mask = static_cast<size_t>(1) << i;
+
+        enable.add_action(a, [=]() {
+            if (a->get_signal())
+                address |= mask;
+            else
+                address &= ~mask;
+
+            propagate_ram_update_fn();
+        });
+    }
+
+    /* data changes matter during a write cycle. */
+    for (auto d : data_bus)
+    {
+        enable.add_action(d, [=]() {
+            if (!we->get_signal())
+                propagate_ram_update_fn();
+        });
+    }
+
+    /* update the RAM state on control line change. */
+    ce->add_action(propagate_ram_update_fn);
+    oe->add_action(propagate_ram_update_fn);
+    we->add_action(propagate_ram_update_fn);
+}
@@ -42,8 +42,55 @@ homesim::icrom::icrom(
     const std::vector<std::uint8_t>& bytes,
     wire* oe, wire* ce, wire* b0, wire* b1, wire* b2, wire* b3, wire* b4,
     wire* b5, wire* b6, wire* b7, double delay)
-        : rom(bytes)
+        : icrom(
+            addresses, make_shared<const rom_image>(vector<uint8_t>(bytes)),
+            oe, ce, b0, b1, b2, b3, b4, b5, b6, b7, delay)
+{
+}
+
+/**
+ * \brief icrom constructor for a shared ROM image.
+ *
+ * This constructor works like the byte vector constructor, except that the ROM
+ * bytes are provided as a shared, immutable image.  The image is not copied, so
+ * any number of ROM instances can share a single image, such as one mapped from
+ * a binary file.
+ *
+ * \param addresses         Vector of address wire pointers.
+ * \param image             The shared ROM image.
+ * \param oe                Output Enable wire (low = output bytes; high =
+ *                          bus line is high Z).
+ * \param ce                Chip Enable wire (low = chip enabled; high =
+ *                          bus line is high Z).
+ * \param b0                Bus line 0.
+ * \param b1                Bus line 1.
+ * \param b2                Bus line 2.
+ * \param b3                Bus line 3.
+ * \param b4                Bus line 4.
+ * \param b5                Bus line 5.
+ * \param b6                Bus line 6.
+ * \param b7                Bus line 7.
+ * \param delay             The optional delay in seconds.
+ */
+homesim::icrom::icrom(
+    const std::vector<wire*>& addresses,
+    std::shared_ptr<const rom_image> image,
+    wire* oe, wire* ce, wire* b0, wire* b1, wire* b2, wire* b3, wire* b4,
+    wire* b5, wire* b6, wire* b7, double delay)
+        : rom(image)
         , addr(addresses)
+        , data_bus{ b0, b1, b2, b3, b4, b5, b6, b7 }
+        , address(0)
+        , last_byte(0)
+        , enable({ oe, ce }, [=]() {
+            /* catch up on address changes missed while deselected. */
+            address = 0;
+            for (size_t i = 0; i < addr.size(); ++i)
+            {
+                if (addr[i]->get_signal())
+                    address |= static_cast<size_t>(1) << i;
+            }
+        })
 {
     /* a zero sized rom is pointless. */
     if (addr.size() == 0)
@@ -55,7 +102,7 @@ homesim::icrom::icrom(
         expected_bytes *= 2;
 
     /* verify that we have the correct number of ROM bytes. */
-    if (rom.size() != expected_bytes)
+    if (!rom || rom->size() != expected_bytes)
         throw rom_mismatch_error("Incorrect number of ROM bytes.");
 
     /* Set bus wires to high-Z. */
@@ -81,43 +128,26 @@ homesim::icrom::icrom(
         /* should we output a byte to the bus? */
         if (oe->get_signal() == false && ce->get_signal() == false)
         {
-            /* compute address. */
-            size_t address = 0;
-            for (auto i = addr.rbegin(); i != addr.rend(); ++i)
-            {
-                address <<= 1;
-                if ((*i)->get_signal())
-                    address += 1;
-            }
+            /* decode byte from the cached address. */
+            uint8_t byte = (*rom)[address];
 
-            /* decode byte. */
-            uint8_t byte = rom[address];
+            /* if the bus is already driven, only drive the bits that
+             * changed. */
+            uint8_t changed = 0xFF;
+            if (WIRE_CONNECTION_TYPE_OUTPUT == conn_type_bus)
+                changed = byte ^ last_byte;
 
             /* output byte to bus. */
-            b0->change_connection_type(
-                conn_type_bus, WIRE_CONNECTION_TYPE_OUTPUT,
-                (byte & 0x01) ? true : false);
-            b1->change_connection_type(
-                conn_type_bus, WIRE_CONNECTION_TYPE_OUTPUT,
-                (byte & 0x02) ? true : false);
-            b2->change_connection_type(
-                conn_type_bus, WIRE_CONNECTION_TYPE_OUTPUT,
-                (byte & 0x04) ? true : false);
-            b3->change_connection_type(
-                conn_type_bus, WIRE_CONNECTION_TYPE_OUTPUT,
-                (byte & 0x08) ? true : false);
-            b4->change_connection_type(
-                conn_type_bus, WIRE_CONNECTION_TYPE_OUTPUT,
-                (byte & 0x10) ? true : false);
-            b5->change_connection_type(
-                conn_type_bus, WIRE_CONNECTION_TYPE_OUTPUT,
-                (byte & 0x20) ? true : false);
-            b6->change_connection_type(
-                conn_type_bus, WIRE_CONNECTION_TYPE_OUTPUT,
-                (byte & 0x40) ? true : false);
-            b7->change_connection_type(
-                conn_type_bus, WIRE_CONNECTION_TYPE_OUTPUT,
-                (byte & 0x80) ? true : false);
+            for (int i = 0; changed; ++i, changed >>= 1)
+            {
+                if (changed & 0x01)
+                {
+                    data_bus[i]->change_connection_type(
+                        conn_type_bus, WIRE_CONNECTION_TYPE_OUTPUT,
+                        (byte & (1 << i)) ? true : false);
+                }
+            }
+            last_byte = byte;
             conn_type_bus = WIRE_CONNECTION_TYPE_OUTPUT;
         }
         else
@@ -147,9 +177,23 @@ homesim::icrom::icrom(
         global_agenda.add(delay, rom_update_fn);
     };
 
-    /* update the ROM state on address line change. */
-    for (auto a : addr)
-        a->add_action(propagate_rom_update_fn);
+    /* update the cached address and the ROM state on address line change.
+     * These are suspended while the chip is deselected. */
+    for (size_t i = 0; i < addr.size(); ++i)
+    {
+        wire* a = addr[i];
+        size_t mask = static_cast<size_t>(1) << i;
+
+        enable.add_action(a, [=]() {
+            /* only this wire's bit of the address can have changed. */
+            if (a->get_signal())
+                address |= mask;
+            else
+                address &= ~mask;
+
+            propagate_rom_update_fn();
+        });
+    }
 
     /* update the ROM state on output enable change. */
     oe->add_action(propagate_rom_update_fn);
@@ -0,0 +1,24 @@
+/**
+ * \file logic/macro_model_registry.cpp
+ *
+ * \brief Macro-model registry and global instance.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/macro_model.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief The global macro-model registry instance.
+ */
+macro_model_registry homesim::global_macro_models;
+
+/**
+ * \brief Create a macro-model registry.
+ */
+homesim::macro_model_registry::macro_model_registry()
+    : default_mode(MACRO_MODEL_MODE_BEHAVIORAL)
+{
+}
@@ -0,0 +1,19 @@
+/**
+ * \file logic/macro_model_registry_clear_divergences.cpp
+ *
+ * \brief Clear the co-simulation divergences reported so far.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/macro_model.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Clear the divergences reported so far.
+ */
+void homesim::macro_model_registry::clear_divergences()
+{
+    divergence_list.clear();
+}
@@ -0,0 +1,20 @@
+/**
+ * \file logic/macro_model_registry_divergences.cpp
+ *
+ * \brief Get the co-simulation divergences reported so far.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/macro_model.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the divergences reported so far.
+ */
+const list<macro_model_divergence>&
+homesim::macro_model_registry::divergences() const
+{
+    return divergence_list;
+}
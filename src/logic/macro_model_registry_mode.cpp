@@ -0,0 +1,34 @@
+/**
+ * \file logic/macro_model_registry_mode.cpp
+ *
+ * \brief Get the macro-model mode for a composite.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/macro_model.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the mode for the given composite.
+ *
+ * \param composite     The name of the composite.
+ *
+ * \returns the mode to use when building this composite.
+ */
+macro_model_mode homesim::macro_model_registry::mode(
+    const string& composite) const
+{
+    lock_guard<mutex> guard(model_lock);
+
+    /* without a behavioral model, only the structural model exists. */
+    if (models.end() == models.find(composite))
+        return MACRO_MODEL_MODE_STRUCTURAL;
+
+    auto f = modes.find(composite);
+    if (modes.end() == f)
+        return default_mode;
+
+    return f->second;
+}
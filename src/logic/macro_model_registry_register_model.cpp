@@ -0,0 +1,23 @@
+/**
+ * \file logic/macro_model_registry_register_model.cpp
+ *
+ * \brief Register a behavioral model for a composite.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/macro_model.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Register a behavioral model for the given composite.
+ *
+ * \param composite     The name of the composite.
+ */
+void homesim::macro_model_registry::register_model(const string& composite)
+{
+    lock_guard<mutex> guard(model_lock);
+
+    models.insert(composite);
+}
@@ -0,0 +1,22 @@
+/**
+ * \file logic/macro_model_registry_report_divergence.cpp
+ *
+ * \brief Report a co-simulation divergence.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/macro_model.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Report a divergence found during co-simulation.
+ *
+ * \param divergence    The divergence to report.
+ */
+void homesim::macro_model_registry::report_divergence(
+    const macro_model_divergence& divergence)
+{
+    divergence_list.push_back(divergence);
+}
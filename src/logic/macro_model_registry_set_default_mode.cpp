@@ -0,0 +1,23 @@
+/**
+ * \file logic/macro_model_registry_set_default_mode.cpp
+ *
+ * \brief Set the default macro-model mode.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/macro_model.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Set the mode used by composites without an explicit mode.
+ *
+ * \param mode          The default mode.
+ */
+void homesim::macro_model_registry::set_default_mode(macro_model_mode mode)
+{
+    lock_guard<mutex> guard(model_lock);
+
+    default_mode = mode;
+}
@@ -0,0 +1,25 @@
+/**
+ * \file logic/macro_model_registry_set_mode.cpp
+ *
+ * \brief Set the macro-model mode for a composite.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/macro_model.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Set the mode used by the given composite.
+ *
+ * \param composite     The name of the composite.
+ * \param mode          The mode for this composite.
+ */
+void homesim::macro_model_registry::set_mode(
+    const string& composite, macro_model_mode mode)
+{
+    lock_guard<mutex> guard(model_lock);
+
+    modes[composite] = mode;
+}
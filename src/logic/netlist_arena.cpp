@@ -0,0 +1,37 @@
+/**
+ * \file logic/netlist_arena.cpp
+ *
+ * \brief Netlist arena constructor and destructor.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/netlist_arena.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Netlist arena constructor.
+ *
+ * \param block_size    The size of each block allocated by the arena.
+ */
+homesim::netlist_arena::netlist_arena(size_t block_size)
+    : block_size(block_size)
+    , cursor(nullptr)
+    , limit(nullptr)
+    , allocated(0)
+    , destructors(nullptr)
+{
+}
+
+/**
+ * \brief Netlist arena destructor.
+ *
+ * Destroys every object created by this arena, then frees its blocks.
+ */
+homesim::netlist_arena::~netlist_arena()
+{
+    /* records are prepended, so this destroys objects in reverse order. */
+    for (auto d = destructors; nullptr != d; d = d->next)
+        d->destroy(d->obj);
+}
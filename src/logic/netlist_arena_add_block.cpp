@@ -0,0 +1,26 @@
+/**
+ * \file logic/netlist_arena_add_block.cpp
+ *
+ * \brief Add a block to a netlist arena.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/netlist_arena.h>
+#include <algorithm>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Start a new block with at least the given free space.
+ *
+ * \param bytes         The minimum free space for the new block.
+ */
+void homesim::netlist_arena::add_block(size_t bytes)
+{
+    size_t size = max(bytes, block_size);
+
+    blocks.emplace_back(new unsigned char[size]);
+    cursor = blocks.back().get();
+    limit = cursor + size;
+}
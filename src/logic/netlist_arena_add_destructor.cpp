@@ -0,0 +1,26 @@
+/**
+ * \file logic/netlist_arena_add_destructor.cpp
+ *
+ * \brief Record a destructor in a netlist arena.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/netlist_arena.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Record the destructor for an object created in this arena.
+ *
+ * The record itself lives in the arena.
+ *
+ * \param obj           The object to destroy with the arena.
+ * \param destroy       The function which destroys this object.
+ */
+void homesim::netlist_arena::add_destructor(void* obj, void (*destroy)(void*))
+{
+    void* mem = allocate(sizeof(destructor_record), alignof(destructor_record));
+
+    destructors = new (mem) destructor_record{ destructors, obj, destroy };
+}
@@ -0,0 +1,41 @@
+/**
+ * \file logic/netlist_arena_allocate.cpp
+ *
+ * \brief Allocate memory from a netlist arena.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/netlist_arena.h>
+#include <cstdint>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Allocate raw memory from the arena.
+ *
+ * \param bytes         The number of bytes to allocate.
+ * \param alignment     The alignment of the allocation.
+ *
+ * \returns the allocated memory, which is freed with the arena.
+ */
+void* homesim::netlist_arena::allocate(size_t bytes, size_t alignment)
+{
+    uintptr_t p = reinterpret_cast<uintptr_t>(cursor);
+    uintptr_t aligned = (p + alignment - 1) & ~(uintptr_t)(alignment - 1);
+
+    /* start a new block if this allocation doesn't fit. */
+    if (nullptr == cursor
+     || aligned + bytes > reinterpret_cast<uintptr_t>(limit))
+    {
+        add_block(bytes + alignment);
+
+        p = reinterpret_cast<uintptr_t>(cursor);
+        aligned = (p + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    }
+
+    cursor = reinterpret_cast<unsigned char*>(aligned + bytes);
+    allocated += bytes;
+
+    return reinterpret_cast<void*>(aligned);
+}
@@ -0,0 +1,27 @@
+/**
+ * \file logic/netlist_arena_reserve.cpp
+ *
+ * \brief Reserve space in a netlist arena.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/netlist_arena.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Reserve space ahead of a bulk build.
+ *
+ * After this call, at least the given number of bytes can be allocated
+ * without allocating another block.
+ *
+ * \param bytes         The number of bytes to reserve.
+ */
+void homesim::netlist_arena::reserve(size_t bytes)
+{
+    if (nullptr != cursor && (size_t)(limit - cursor) >= bytes)
+        return;
+
+    add_block(bytes);
+}
@@ -0,0 +1,19 @@
+/**
+ * \file logic/netlist_arena_size.cpp
+ *
+ * \brief Get the number of bytes allocated from a netlist arena.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/netlist_arena.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Return the number of bytes allocated from this arena.
+ */
+size_t homesim::netlist_arena::size() const
+{
+    return allocated;
+}
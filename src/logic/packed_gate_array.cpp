@@ -0,0 +1,42 @@
+/**
+ * \file logic/packed_gate_array.cpp
+ *
+ * \brief Packed gate array constructor.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/ic/packed_gate_array.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Packed gate array constructor.
+ *
+ * \param a         The A input for each gate, in gate order.
+ * \param b         The B input for each gate, in gate order.  This is empty
+ *                  for single input gates, such as inverters.
+ * \param y         The output for each gate, in gate order.
+ * \param fn        The packed gate function used to evaluate all gates.
+ * \param delay     The delay in seconds.
+ */
+homesim::packed_gate_array::packed_gate_array(
+    initializer_list<wire*> a, initializer_list<wire*> b,
+    initializer_list<wire*> y, packed_gate_fn fn, double delay)
+        : in_a(a)
+        , in_b(b)
+        , out(y)
+        , eval(fn)
+        , delay(delay)
+        , a_bits(0)
+        , b_bits(0)
+        , y_bits(0)
+        , y_valid(false)
+        , scheduled_time(-1.0)
+{
+    /* mirror each input wire into its bit of the packed inputs. */
+    for (size_t i = 0; i < in_a.size(); ++i)
+        watch_input(in_a[i], &a_bits, 1U << i);
+    for (size_t i = 0; i < in_b.size(); ++i)
+        watch_input(in_b[i], &b_bits, 1U << i);
+}
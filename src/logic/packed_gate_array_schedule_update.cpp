@@ -0,0 +1,27 @@
+/**
+ * \file logic/packed_gate_array_schedule_update.cpp
+ *
+ * \brief Schedule an output update for a packed gate array.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/ic/packed_gate_array.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Schedule an output update, unless one is already scheduled for
+ * the same simulation instant.
+ */
+void homesim::packed_gate_array::schedule_update()
+{
+    double when = global_agenda.current_time() + delay;
+
+    /* an update at this instant will already see the new input bits. */
+    if (when == scheduled_time)
+        return;
+
+    scheduled_time = when;
+    global_agenda.add(delay, [=]() { update(); });
+}
@@ -0,0 +1,33 @@
+/**
+ * \file logic/packed_gate_array_update.cpp
+ *
+ * \brief Evaluate a packed gate array and drive its outputs.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/ic/packed_gate_array.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Evaluate all gates and drive any outputs that changed.
+ */
+void homesim::packed_gate_array::update()
+{
+    uint32_t mask = (1U << out.size()) - 1U;
+
+    /* evaluate every gate at once. */
+    uint32_t y = eval(a_bits, b_bits) & mask;
+
+    /* only drive the outputs that changed, or all of them the first time. */
+    uint32_t changed = y_valid ? (y ^ y_bits) : mask;
+    y_bits = y;
+    y_valid = true;
+
+    for (size_t i = 0; changed; ++i, changed >>= 1)
+    {
+        if (changed & 1U)
+            out[i]->set_signal((y >> i) & 1U);
+    }
+}
@@ -0,0 +1,33 @@
+/**
+ * \file logic/packed_gate_array_watch_input.cpp
+ *
+ * \brief Watch an input wire of a packed gate array.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/ic/packed_gate_array.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Watch an input wire, mirroring its signal in the given bit.
+ *
+ * \param w         The input wire to watch.
+ * \param bits      The packed bit-field to update.
+ * \param mask      The bit in this field owned by the wire.
+ */
+void homesim::packed_gate_array::watch_input(
+    wire* w, uint32_t* bits, uint32_t mask)
+{
+    w->add_action([=]() {
+        /* update the packed input bit for this wire. */
+        if (w->get_signal())
+            *bits |= mask;
+        else
+            *bits &= ~mask;
+
+        /* schedule a single update for all gates. */
+        schedule_update();
+    });
+}
@@ -0,0 +1,50 @@
+/**
+ * \file logic/paged_memory.cpp
+ *
+ * \brief Paged memory constructor.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/ic/paged_memory.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Paged memory constructor.
+ *
+ * \param address_bits      The number of address bits (1 - 32).
+ * \param word_bits         The word width in bits (8, 16, or 32).
+ * \param page_size         The page size in bytes, which must be a power
+ *                          of two that is at least one word.
+ *
+ * \throws \ref memory_error if the configuration is invalid.
+ */
+homesim::paged_memory::paged_memory(
+    unsigned int address_bits, unsigned int word_bits, size_t page_size)
+        : addr_bits(address_bits)
+        , word_bytes(word_bits / 8)
+        , page_bytes(page_size)
+        , page_shift(0)
+        , cached_index(0)
+        , cached_page(nullptr)
+{
+    /* the address space must be addressable. */
+    if (addr_bits < 1 || addr_bits > 32)
+        throw memory_error("Memory must have 1 to 32 address bits.");
+
+    /* only byte, half word, and word widths are supported. */
+    if (word_bits != 8 && word_bits != 16 && word_bits != 32)
+        throw memory_error("Memory word width must be 8, 16, or 32 bits.");
+
+    /* a page never needs to be larger than the whole memory. */
+    if (page_bytes > size())
+        page_bytes = size();
+
+    /* the page size must be a power of two holding at least one word. */
+    if (page_bytes < word_bytes || (page_bytes & (page_bytes - 1)) != 0)
+        throw memory_error("Memory page size must be a power of two.");
+
+    while ((static_cast<size_t>(1) << page_shift) < page_bytes)
+        ++page_shift;
+}
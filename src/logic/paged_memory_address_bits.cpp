@@ -0,0 +1,19 @@
+/**
+ * \file logic/paged_memory_address_bits.cpp
+ *
+ * \brief Get the number of address bits for paged memory.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/ic/paged_memory.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the number of address bits for this memory.
+ */
+unsigned int homesim::paged_memory::address_bits() const
+{
+    return addr_bits;
+}
@@ -0,0 +1,57 @@
+/**
+ * \file logic/paged_memory_dump.cpp
+ *
+ * \brief Dump paged memory into a binary file.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <cstring>
+#include <fcntl.h>
+#include <homesim/ic/paged_memory.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Dump the contents of this memory into a binary file.
+ *
+ * The file is sized to the full capacity of this memory and mapped for
+ * writing.  Only allocated pages are written, so unallocated pages become
+ * holes on file systems that support sparse files.
+ *
+ * \param path          The path of the binary file to write.
+ *
+ * \throws \ref memory_error if the file can't be created or mapped.
+ */
+void homesim::paged_memory::dump(const string& path) const
+{
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        throw memory_error(string("Can't create memory image ") + path + ".");
+
+    /* size the file without writing, so missing pages stay holes. */
+    if (ftruncate(fd, size()) < 0)
+    {
+        close(fd);
+        throw memory_error(string("Can't size memory image ") + path + ".");
+    }
+
+    void* m = mmap(nullptr, size(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == m)
+        throw memory_error(string("Can't map memory image ") + path + ".");
+
+    /* copy each allocated page into place.  Addresses are masked to the
+     * address space, and a page is no larger than it, so no page lies past
+     * the end. */
+    uint8_t* dest = static_cast<uint8_t*>(m);
+    for (const auto& p : page_map)
+    {
+        memcpy(dest + (p.first << page_shift), p.second.get(), page_bytes);
+    }
+
+    munmap(m, size());
+}
@@ -0,0 +1,34 @@
+/**
+ * \file logic/paged_memory_find_page.cpp
+ *
+ * \brief Find a page of paged memory.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/ic/paged_memory.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Find the page with the given index.
+ *
+ * \param index         The page index.
+ *
+ * \returns the page, or nullptr if it has not been allocated.
+ */
+uint8_t* homesim::paged_memory::find_page(size_t index) const
+{
+    /* sequential accesses usually land on the same page. */
+    if (nullptr != cached_page && index == cached_index)
+        return cached_page;
+
+    auto f = page_map.find(index);
+    if (page_map.end() == f)
+        return nullptr;
+
+    cached_index = index;
+    cached_page = f->second.get();
+
+    return cached_page;
+}
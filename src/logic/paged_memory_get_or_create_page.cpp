@@ -0,0 +1,38 @@
+/**
+ * \file logic/paged_memory_get_or_create_page.cpp
+ *
+ * \brief Get or allocate a page of paged memory.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <cstring>
+#include <homesim/ic/paged_memory.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the page with the given index, allocating a zeroed page if it is
+ * missing.
+ *
+ * \param index         The page index.
+ *
+ * \returns the page.
+ */
+uint8_t* homesim::paged_memory::get_or_create_page(size_t index)
+{
+    uint8_t* page = find_page(index);
+    if (nullptr != page)
+        return page;
+
+    /* allocate a zeroed page. */
+    unique_ptr<uint8_t[]> newpage(new uint8_t[page_bytes]);
+    memset(newpage.get(), 0, page_bytes);
+    page = newpage.get();
+    page_map.insert(make_pair(index, move(newpage)));
+
+    cached_index = index;
+    cached_page = page;
+
+    return page;
+}
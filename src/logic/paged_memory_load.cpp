@@ -0,0 +1,84 @@
+/**
+ * \file logic/paged_memory_load.cpp
+ *
+ * \brief Load a binary file into paged memory.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <homesim/ic/paged_memory.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Load the contents of a binary file into memory.
+ *
+ * The file is mapped read-only and copied into memory starting at the
+ * given byte offset.  Pages of the file that are entirely zero are not
+ * allocated.
+ *
+ * \param path          The path of the binary file to load.
+ * \param offset        The byte offset at which the file is loaded.
+ *
+ * \throws \ref memory_error if the file can't be mapped or does not fit.
+ */
+void homesim::paged_memory::load(const string& path, size_t offset)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw memory_error(string("Can't open memory image ") + path + ".");
+
+    struct stat st;
+    if (fstat(fd, &st) < 0)
+    {
+        close(fd);
+        throw memory_error(string("Can't stat memory image ") + path + ".");
+    }
+
+    size_t length = st.st_size;
+    if (offset > size() || length > size() - offset)
+    {
+        close(fd);
+        throw memory_error(string("Memory image ") + path + " is too large.");
+    }
+
+    /* an empty image has nothing to load. */
+    if (0 == length)
+    {
+        close(fd);
+        return;
+    }
+
+    void* m = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (MAP_FAILED == m)
+        throw memory_error(string("Can't map memory image ") + path + ".");
+
+    /* copy the image a page fragment at a time. */
+    const uint8_t* src = static_cast<const uint8_t*>(m);
+    size_t pos = 0;
+    while (pos < length)
+    {
+        size_t dest = offset + pos;
+        size_t page_offset = dest & (page_bytes - 1);
+        size_t count = min(page_bytes - page_offset, length - pos);
+
+        /* skip zero fragments that would land on a missing page. */
+        bool zero = all_of(src + pos, src + pos + count,
+            [](uint8_t b) { return 0 == b; });
+        size_t index = dest >> page_shift;
+        uint8_t* page = zero ? find_page(index) : get_or_create_page(index);
+        if (nullptr != page)
+            memcpy(page + page_offset, src + pos, count);
+
+        pos += count;
+    }
+
+    munmap(m, length);
+}
@@ -0,0 +1,19 @@
+/**
+ * \file logic/paged_memory_pages.cpp
+ *
+ * \brief Get the number of allocated pages in paged memory.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/ic/paged_memory.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the number of pages that have been allocated.
+ */
+size_t homesim::paged_memory::pages() const
+{
+    return page_map.size();
+}
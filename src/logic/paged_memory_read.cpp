@@ -0,0 +1,38 @@
+/**
+ * \file logic/paged_memory_read.cpp
+ *
+ * \brief Read a word from paged memory.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/ic/paged_memory.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Read a word from memory.  Address bits above the width of this
+ * memory are ignored, as they would be by the hardware.
+ *
+ * \param address       The word address to read.
+ *
+ * \returns the word at this address, or zero if it was never written.
+ */
+uint32_t homesim::paged_memory::read(size_t address) const
+{
+    address &= (static_cast<size_t>(1) << addr_bits) - 1;
+    size_t byte_address = address * word_bytes;
+
+    /* pages that were never written read as zero. */
+    const uint8_t* page = find_page(byte_address >> page_shift);
+    if (nullptr == page)
+        return 0;
+
+    /* words never span pages, so assemble the word from this page. */
+    const uint8_t* p = page + (byte_address & (page_bytes - 1));
+    uint32_t word = 0;
+    for (unsigned int i = 0; i < word_bytes; ++i)
+        word |= static_cast<uint32_t>(p[i]) << (8 * i);
+
+    return word;
+}
@@ -0,0 +1,19 @@
+/**
+ * \file logic/paged_memory_size.cpp
+ *
+ * \brief Get the capacity of paged memory.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/ic/paged_memory.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the capacity of this memory in bytes.
+ */
+size_t homesim::paged_memory::size() const
+{
+    return (static_cast<size_t>(1) << addr_bits) * word_bytes;
+}
@@ -0,0 +1,19 @@
+/**
+ * \file logic/paged_memory_word_bits.cpp
+ *
+ * \brief Get the word width for paged memory.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/ic/paged_memory.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the word width in bits for this memory.
+ */
+unsigned int homesim::paged_memory::word_bits() const
+{
+    return word_bytes * 8;
+}
@@ -0,0 +1,35 @@
+/**
+ * \file logic/paged_memory_write.cpp
+ *
+ * \brief Write a word to paged memory.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/ic/paged_memory.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Write a word to memory.  Address bits above the width of this
+ * memory are ignored, as they would be by the hardware.
+ *
+ * \param address       The word address to write.
+ * \param word          The word to write.
+ */
+void homesim::paged_memory::write(size_t address, uint32_t word)
+{
+    address &= (static_cast<size_t>(1) << addr_bits) - 1;
+    size_t byte_address = address * word_bytes;
+
+    /* writing zero to a missing page doesn't need to allocate it. */
+    size_t index = byte_address >> page_shift;
+    uint8_t* page =
+        (0 != word) ? get_or_create_page(index) : find_page(index);
+    if (nullptr == page)
+        return;
+
+    uint8_t* p = page + (byte_address & (page_bytes - 1));
+    for (unsigned int i = 0; i < word_bytes; ++i)
+        p[i] = static_cast<uint8_t>(word >> (8 * i));
+}
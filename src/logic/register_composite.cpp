@@ -0,0 +1,32 @@
+/**
+ * \file logic/register_composite.cpp
+ *
+ * \brief Register a composite definition as a component type.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/composite.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Register a composite definition as a component type.
+ *
+ * \param factory   The factory in which the composite is registered.
+ * \param type      The component type name for the composite.
+ * \param def       The shared definition.
+ */
+void homesim::register_composite(
+    component_factory& factory, const string& type,
+    shared_ptr<const composite_definition> def)
+{
+    factory.register_component(type, [=]() -> shared_ptr<component> {
+        return composite_definition::instantiate(def);
+    });
+
+    factory.register_arena_component(
+        type, [=](netlist_arena& arena) -> shared_ptr<component> {
+            return composite_definition::instantiate(def, &arena);
+        });
+}
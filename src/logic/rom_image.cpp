@@ -0,0 +1,91 @@
+/**
+ * \file logic/rom_image.cpp
+ *
+ * \brief ROM image constructors and destructor.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <fcntl.h>
+#include <homesim/ic/rom_image.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Create a ROM image that takes ownership of the given bytes.
+ *
+ * \param bytes         The ROM bytes, starting at a zero index.
+ */
+homesim::rom_image::rom_image(vector<uint8_t>&& bytes)
+    : rom_image(make_shared<const vector<uint8_t>>(move(bytes)))
+{
+}
+
+/**
+ * \brief Create a ROM image that shares the given bytes.
+ *
+ * The bytes must not be modified for the lifetime of this image.
+ *
+ * \param shared_bytes  The ROM bytes, starting at a zero index.
+ */
+homesim::rom_image::rom_image(
+    shared_ptr<const vector<uint8_t>> shared_bytes)
+    : bytes(shared_bytes->data())
+    , length(shared_bytes->size())
+    , owner(shared_bytes)
+    , mapping(nullptr)
+{
+}
+
+/**
+ * \brief Create a ROM image by mapping a binary file read-only.
+ *
+ * \param path          The path of the binary file to map.
+ *
+ * \throws \ref rom_image_error if the file can't be opened or mapped.
+ */
+homesim::rom_image::rom_image(const string& path)
+    : bytes(nullptr)
+    , length(0)
+    , mapping(nullptr)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw rom_image_error(string("Can't open ROM image ") + path + ".");
+
+    struct stat st;
+    if (fstat(fd, &st) < 0)
+    {
+        close(fd);
+        throw rom_image_error(string("Can't stat ROM image ") + path + ".");
+    }
+
+    /* an empty image has nothing to map. */
+    length = st.st_size;
+    if (0 == length)
+    {
+        close(fd);
+        return;
+    }
+
+    /* a shared read-only mapping lets every process share the page cache. */
+    void* m = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == m)
+        throw rom_image_error(string("Can't map ROM image ") + path + ".");
+
+    mapping = m;
+    bytes = static_cast<const uint8_t*>(m);
+}
+
+/**
+ * \brief Release the ROM image, unmapping it if it was mapped.
+ */
+homesim::rom_image::~rom_image()
+{
+    if (nullptr != mapping)
+        munmap(mapping, length);
+}
@@ -5,14 +5,17 @@
  *
  * \copyright Copyright 2020 Justin Handville. All rights reserved.
  */
+#include <homesim/component.h>
 #include <homesim/simulation.h>
 
 using namespace homesim;
 using namespace std;
 
 /**
- * \brief Default constructor for simulation.
+ * \brief Default constructor for simulation, which creates an empty
+ * simulation.
  */
 homesim::simulation::simulation()
+    : fanout_first(1, 0)
 {
 }
@@ -0,0 +1,19 @@
+/**
+ * \file logic/simulation_component_count.cpp
+ *
+ * \brief Get the number of component instances in a simulation.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/simulation.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the number of component instances.
+ */
+size_t homesim::simulation::component_count() const
+{
+    return component_list.size();
+}
@@ -0,0 +1,19 @@
+/**
+ * \file logic/simulation_current_time.cpp
+ *
+ * \brief Get the current time of a simulation.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/simulation.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the current simulation time, in seconds.
+ */
+double homesim::simulation::current_time() const
+{
+    return schedule.current_time();
+}
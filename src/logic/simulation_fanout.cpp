@@ -0,0 +1,26 @@
+/**
+ * \file logic/simulation_fanout.cpp
+ *
+ * \brief Get the component pins bound to a net of a simulation.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/simulation.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the component pins bound to a net.
+ *
+ * \param net       The net id.
+ *
+ * \returns the range of pins, as a pair of begin and end pointers.
+ */
+pair<const simulation_pin*, const simulation_pin*>
+homesim::simulation::fanout(int net) const
+{
+    const simulation_pin* pins = fanout_list.data();
+
+    return make_pair(pins + fanout_first[net], pins + fanout_first[net + 1]);
+}
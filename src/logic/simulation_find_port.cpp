@@ -0,0 +1,27 @@
+/**
+ * \file logic/simulation_find_port.cpp
+ *
+ * \brief Find a port of a simulation by name.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/simulation.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Find a port by name.
+ *
+ * \param name      The name of the wire, such as "in" or "bus[3]".
+ *
+ * \returns the net id of the port, or -1 if there is no such port.
+ */
+int homesim::simulation::find_port(const string& name) const
+{
+    auto f = ports.find(name);
+    if (ports.end() == f)
+        return -1;
+
+    return f->second.net;
+}
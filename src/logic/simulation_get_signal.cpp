@@ -0,0 +1,37 @@
+/**
+ * \file logic/simulation_get_signal.cpp
+ *
+ * \brief Get the signal of a net of a simulation.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/simulation.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the current signal of a net.
+ *
+ * \param net       The net id.
+ */
+bool homesim::simulation::get_signal(int net) const
+{
+    return net_list[net]->get_signal();
+}
+
+/**
+ * \brief Get the current signal of a port.
+ *
+ * \param name      The name of the port.
+ *
+ * \throws a \ref simulation_error if there is no such port.
+ */
+bool homesim::simulation::get_signal(const string& name) const
+{
+    auto f = ports.find(name);
+    if (ports.end() == f)
+        throw simulation_error(string("Wire ") + name + " is not a port.");
+
+    return net_list[f->second.net]->get_signal();
+}
@@ -0,0 +1,19 @@
+/**
+ * \file logic/simulation_net_count.cpp
+ *
+ * \brief Get the number of nets in a simulation.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/simulation.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the number of nets.
+ */
+size_t homesim::simulation::net_count() const
+{
+    return net_list.size();
+}
@@ -0,0 +1,45 @@
+/**
+ * \file logic/simulation_run_until.cpp
+ *
+ * \brief Run a simulation up to a given time.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/config_value.h>
+#include <homesim/simulation.h>
+#include <memory>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Run every event scheduled up to the given time, leaving later
+ * events pending.
+ *
+ * \param time      The time to run to, in seconds.
+ *
+ * \throws a \ref simulation_error if the time is before the current time.
+ */
+void homesim::simulation::run_until(double time)
+{
+    if (time < schedule.current_time())
+        throw simulation_error(
+            string("Can't run to ") + config_format_number(time)
+          + " s, which is before the current time.");
+
+    schedule_scope s(*this);
+
+    /* a marker event stops the run once the agenda reaches the time.  It owns
+     * its flag, so if an event throws and leaves it queued, it is harmless
+     * when it runs later. */
+    auto reached = make_shared<bool>(false);
+    global_agenda.add(
+        time - global_agenda.current_time(), [reached]() { *reached = true; });
+
+    while (!*reached)
+    {
+        auto a = global_agenda.next();
+        global_agenda.pop();
+        a.second();
+    }
+}
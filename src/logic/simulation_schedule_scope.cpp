@@ -0,0 +1,32 @@
+/**
+ * \file logic/simulation_schedule_scope.cpp
+ *
+ * \brief Make the agenda of a simulation global for a scope.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/simulation.h>
+#include <utility>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Swap the agenda of the given simulation into the global agenda.
+ *
+ * \param sim       The simulation.
+ */
+homesim::simulation::schedule_scope::schedule_scope(simulation& sim)
+    : schedule(sim.schedule)
+{
+    swap(schedule, global_agenda);
+}
+
+/**
+ * \brief Swap the agenda back into its simulation, restoring the global
+ * agenda.
+ */
+homesim::simulation::schedule_scope::~schedule_scope()
+{
+    swap(schedule, global_agenda);
+}
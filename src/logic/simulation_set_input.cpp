@@ -0,0 +1,47 @@
+/**
+ * \file logic/simulation_set_input.cpp
+ *
+ * \brief Drive an input of a simulation.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/simulation.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Drive an input to the given signal at the current time.
+ *
+ * \param net       The net id of the input.
+ * \param signal    The new signal.
+ *
+ * \throws a \ref simulation_error if the net is not an input.
+ */
+void homesim::simulation::set_input(int net, bool signal)
+{
+    if (net < 0 || (size_t)net >= inputs.size() || !inputs[net])
+        throw simulation_error(
+            string("Net ") + to_string(net) + " is not an input.");
+
+    /* the events caused by this change go on our agenda. */
+    schedule_scope s(*this);
+    net_list[net]->set_signal(signal);
+}
+
+/**
+ * \brief Drive an input to the given signal at the current time.
+ *
+ * \param name      The name of the input.
+ * \param signal    The new signal.
+ *
+ * \throws a \ref simulation_error if there is no such input.
+ */
+void homesim::simulation::set_input(const string& name, bool signal)
+{
+    auto f = ports.find(name);
+    if (ports.end() == f || !f->second.input)
+        throw simulation_error(string("Wire ") + name + " is not an input.");
+
+    set_input(f->second.net, signal);
+}
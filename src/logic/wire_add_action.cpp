@@ -17,7 +17,7 @@ using namespace std;
  */
 void homesim::wire::add_action(function<void ()> action)
 {
-    actions.push_back(action);
+    add_owned_action(actions, action);
 
     action();
 }
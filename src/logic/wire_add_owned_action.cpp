@@ -0,0 +1,40 @@
+/**
+ * \file logic/wire_add_owned_action.cpp
+ *
+ * \brief Add an action on behalf of the current wire owner.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/wire.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Add an action to the given list on behalf of the current wire owner.
+ *
+ * Without a current owner, the action is added as is.  Otherwise, it is
+ * wrapped so that it runs with that owner current, and recorded so that the
+ * owner can remove it.
+ *
+ * \param list          The action list of this wire.
+ * \param action        The action to add.
+ */
+void homesim::wire::add_owned_action(
+    action_list& list, function<void ()> action)
+{
+    auto owner = wire_owner::current();
+    if (nullptr == owner)
+    {
+        list.push_back(action);
+        return;
+    }
+
+    list.push_back([=]() {
+        wire_owner::scope s(owner);
+        action();
+    });
+
+    owner->actions.push_back(
+        wire_owner::action_record{ &list, prev(list.end()) });
+}
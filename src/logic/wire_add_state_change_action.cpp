@@ -17,7 +17,7 @@ using namespace std;
  */
 void homesim::wire::add_state_change_action(function<void ()> action)
 {
-    state_change_actions.push_back(action);
+    add_owned_action(state_change_actions, action);
 
     action();
 }
@@ -19,6 +19,12 @@ using namespace std;
 void homesim::wire::adjust_connection_type(
     wire_connection_type type, int adjustment)
 {
+    /* record the change so that the current owner can undo it. */
+    auto owner = wire_owner::current();
+    if (nullptr != owner)
+        owner->connections.push_back(
+            wire_owner::connection_record{ this, type, adjustment });
+
     switch (type)
     {
         case WIRE_CONNECTION_TYPE_INPUT:
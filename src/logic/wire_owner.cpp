@@ -0,0 +1,20 @@
+/**
+ * \file logic/wire_owner.cpp
+ *
+ * \brief Construct a wire owner.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/wire.h>
+
+using namespace homesim;
+using namespace std;
+
+thread_local wire_owner* homesim::wire_owner::current_owner = nullptr;
+
+/**
+ * \brief Create a wire owner with nothing recorded.
+ */
+homesim::wire_owner::wire_owner()
+{
+}
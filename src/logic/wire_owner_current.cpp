@@ -0,0 +1,21 @@
+/**
+ * \file logic/wire_owner_current.cpp
+ *
+ * \brief Get the current wire owner.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/wire.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the wire owner that is current on this thread.
+ *
+ * \returns the current owner, or nullptr if there is none.
+ */
+wire_owner* homesim::wire_owner::current()
+{
+    return current_owner;
+}
@@ -0,0 +1,33 @@
+/**
+ * \file logic/wire_owner_detach.cpp
+ *
+ * \brief Remove everything recorded for a wire owner.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/wire.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Remove every action recorded for this owner, and undo every
+ * connection change.  The wires must still be alive.
+ */
+void homesim::wire_owner::detach()
+{
+    /* the undo itself must not be recorded. */
+    scope none(nullptr);
+
+    for (auto& a : actions)
+        a.list->erase(a.action);
+    actions.clear();
+
+    /* undo the connection changes, latest first. */
+    for (auto i = connections.rbegin(); i != connections.rend(); ++i)
+        i->w->adjust_connection_type(i->type, -i->adjustment);
+
+    for (auto& c : connections)
+        c.w->fault_check();
+    connections.clear();
+}
@@ -0,0 +1,30 @@
+/**
+ * \file logic/wire_owner_scope.cpp
+ *
+ * \brief Make a wire owner current for a scope.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/wire.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Make the given owner current on this thread.
+ *
+ * \param owner     The owner, or nullptr to record nothing.
+ */
+homesim::wire_owner::scope::scope(wire_owner* owner)
+    : previous(current_owner)
+{
+    current_owner = owner;
+}
+
+/**
+ * \brief Restore the previously current owner.
+ */
+homesim::wire_owner::scope::~scope()
+{
+    current_owner = previous;
+}
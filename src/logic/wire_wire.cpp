@@ -17,6 +17,17 @@ using namespace std;
  * false, no connections, and DRC checks (faults and floating) disabled.
  */
 homesim::wire::wire()
+    : wire(nullptr)
+{
+}
+
+/**
+ * \brief Constructor for a wire whose fanout records live in an arena.
+ *
+ * \param arena     The arena for this wire's action lists, or nullptr to use
+ *                  the heap.  The arena must outlive this wire.
+ */
+homesim::wire::wire(netlist_arena* arena)
     : signal(0)
     , floating(false)
     , fault(false)
@@ -25,6 +36,8 @@ homesim::wire::wire()
     , high_zs(0)
     , pull_downs(0)
     , pull_ups(0)
+    , actions(arena_allocator<function<void ()>>(arena))
+    , state_change_actions(arena_allocator<function<void ()>>(arena))
 {
     fault_check();
 }
@@ -0,0 +1,31 @@
+/**
+ * \file logic/write_rom_image.cpp
+ *
+ * \brief Write a ROM image to a binary file.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <fstream>
+#include <homesim/ic/rom_image.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Write a ROM image to a binary file, so it can later be mapped.
+ *
+ * \param path          The path of the binary file to write.
+ * \param bytes         The ROM bytes to write.
+ *
+ * \throws \ref rom_image_error if the file can't be written.
+ */
+void homesim::write_rom_image(const string& path, const vector<uint8_t>& bytes)
+{
+    ofstream out(path, ios::out | ios::binary | ios::trunc);
+    if (!out)
+        throw rom_image_error(string("Can't create ROM image ") + path + ".");
+
+    out.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    if (!out)
+        throw rom_image_error(string("Can't write ROM image ") + path + ".");
+}
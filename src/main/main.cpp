@@ -5,13 +5,134 @@
  *
  * \copyright Copyright 2020 Justin Handville. All rights reserved.
  */
+#include <chrono>
+#include <filesystem>
+#include <homesim/environment.h>
+#include <homesim/netlist_cache.h>
 #include <homesim/parser.h>
+#include <homesim/semantic_analyzer.h>
 #include <iostream>
+#include <thread>
 
 using namespace homesim;
 using namespace std;
 
+/**
+ * \brief Watch the source file, updating the netlist in place and rerunning
+ * every scenario each time the file changes.  This never returns.
+ *
+ * \param path          The path of the source file.
+ * \param analyzer      The analyzer holding the current netlist.
+ */
+static void watch(const string& path, shared_ptr<semantic_analyzer> analyzer)
+{
+    error_code ec;
+    auto last = filesystem::last_write_time(path, ec);
+
+    for (;;)
+    {
+        this_thread::sleep_for(chrono::milliseconds(100));
+
+        auto now = filesystem::last_write_time(path, ec);
+        if (ec || now == last)
+            continue;
+        last = now;
+
+        try
+        {
+            /* a parse or analysis error leaves the netlist unchanged. */
+            auto start = chrono::steady_clock::now();
+
+            mapped_file source(path);
+            parser p(source.begin(), source.end());
+            auto result = analyzer->update(p.parse_flat());
+
+            auto elapsed =
+                chrono::duration<double, milli>(
+                    chrono::steady_clock::now() - start);
+
+            cerr << path << ": updated in " << elapsed.count() << " ms; "
+                 << result.components_built << " components built, "
+                 << result.components_kept << " kept, "
+                 << result.components_removed << " removed." << endl;
+
+            if (0 == analyzer->run_scenarios(cerr))
+                cerr << path << ": all scenarios passed." << endl;
+        }
+        catch (exception& e)
+        {
+            cerr << path << ": " << e.what() << endl;
+        }
+    }
+}
+
 int main(int argc, char* argv[])
 {
+    bool watching = (argc == 3 && string("--watch") == argv[1]);
+
+    if (argc != 2 && !watching)
+    {
+        cerr << "Usage: " << argv[0] << " [--watch] file.homesim" << endl;
+        return 1;
+    }
+
+    string path(argv[argc - 1]);
+    string cache_path = path + ".cache";
+
+    try
+    {
+        auto en = make_shared<environment>();
+        mapped_file source(path);
+        uint64_t hash = netlist_cache_hash(source.begin(), source.end());
+
+        /* use the netlist cache if it matches the source. */
+        auto analyzer =
+            semantic_analyzer::read_cache(en, cache_path, hash);
+
+        if (!analyzer)
+        {
+            parser p(source.begin(), source.end());
+            analyzer =
+                semantic_analyzer::analyze_stream(
+                    en, p, filesystem::path(path).parent_path().string());
+
+            try
+            {
+                analyzer->write_cache(cache_path, hash);
+            }
+            catch (netlist_cache_error& e)
+            {
+                cerr << "Warning: " << e.what() << endl;
+            }
+        }
+
+        /* keep the netlist in memory, rebuilding only what each edit
+         * changes. */
+        if (watching)
+        {
+            analyzer->enable_updates();
+
+            try
+            {
+                analyzer->run_scenarios(cerr);
+            }
+            catch (exception& e)
+            {
+                cerr << path << ": " << e.what() << endl;
+            }
+
+            watch(path, analyzer);
+        }
+
+        /* run each scenario, reporting failed expectations. */
+        if (analyzer->run_scenarios(cerr) > 0)
+            return 1;
+    }
+    catch (exception& e)
+    {
+        cerr << path << ": " << e.what() << endl;
+        return 1;
+    }
+
     return 0;
 }
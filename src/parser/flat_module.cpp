@@ -0,0 +1,19 @@
+/**
+ * \file parser/flat_module.cpp
+ *
+ * \brief Flat module constructor.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Create an empty flat module.
+ */
+homesim::flat_module::flat_module()
+    : name(-1)
+{
+}
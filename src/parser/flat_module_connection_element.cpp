@@ -0,0 +1,31 @@
+/**
+ * \file parser/flat_module_connection_element.cpp
+ *
+ * \brief Get the component array index named by an element of a connection.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the component array index for an element of a connection.
+ *
+ * \param connection    The index of the connection.
+ * \param element       The element, from zero to the connection width.
+ *
+ * \returns the index into the component array, or -1 if the connection names
+ * a scalar component.
+ */
+int homesim::flat_module::connection_element(
+    int connection, int element) const
+{
+    const flat_ast_connection& conn = connections[connection];
+
+    if (conn.first < 0)
+        return -1;
+
+    return range_element(conn.first, conn.last, element);
+}
@@ -0,0 +1,31 @@
+/**
+ * \file parser/flat_module_connection_pin.cpp
+ *
+ * \brief Get the pin named by an element of a connection.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the pin name for an element of a connection.
+ *
+ * \param connection    The index of the connection.
+ * \param element       The element, from zero to the connection width.
+ *
+ * \returns the pin name.
+ */
+string homesim::flat_module::connection_pin(int connection, int element) const
+{
+    const flat_ast_connection& conn = connections[connection];
+
+    if (conn.pin_first < 0)
+        return symbols.str(conn.pin);
+
+    return
+        symbols.str(conn.pin)
+      + to_string(range_element(conn.pin_first, conn.pin_last, element));
+}
@@ -0,0 +1,35 @@
+/**
+ * \file parser/flat_module_connection_target.cpp
+ *
+ * \brief Get the component and pin named by an element of a connection.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the component and pin names for an element of a connection.
+ *
+ * \param connection    The index of the connection.
+ * \param element       The element, from zero to the connection width.
+ * \param component     Set to the component name.
+ * \param pin           Set to the pin name.
+ */
+void homesim::flat_module::connection_target(
+    int connection, int element, string& component, string& pin) const
+{
+    const flat_ast_connection& conn = connections[connection];
+
+    component = symbols.str(conn.component);
+    if (conn.first >= 0)
+    {
+        component += "[";
+        component += to_string(connection_element(connection, element));
+        component += "]";
+    }
+
+    pin = connection_pin(connection, element);
+}
@@ -0,0 +1,30 @@
+/**
+ * \file parser/flat_module_connection_width.cpp
+ *
+ * \brief Get the width of a connection.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <cstdlib>
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the number of component pins that a connection names.
+ *
+ * \param connection    The index of the connection.
+ */
+int homesim::flat_module::connection_width(int connection) const
+{
+    const flat_ast_connection& conn = connections[connection];
+
+    /* the parser ensures that two ranges have the same width. */
+    if (conn.first >= 0 && conn.first != conn.last)
+        return abs(conn.last - conn.first) + 1;
+    else if (conn.pin_first >= 0)
+        return abs(conn.pin_last - conn.pin_first) + 1;
+    else
+        return 1;
+}
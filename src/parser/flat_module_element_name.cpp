@@ -0,0 +1,29 @@
+/**
+ * \file parser/flat_module_element_name.cpp
+ *
+ * \brief Get the name of an element of a component or wire.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the name of an element of a component or wire.
+ *
+ * \param name          The symbol id of the component or wire name.
+ * \param count         The array count, or zero for a scalar.
+ * \param element       The element index, ignored for a scalar.
+ *
+ * \returns the name, with its index if this is an array.
+ */
+string homesim::flat_module::element_name(
+    int name, int count, int element) const
+{
+    if (0 == count)
+        return symbols.str(name);
+
+    return symbols.str(name) + "[" + to_string(element) + "]";
+}
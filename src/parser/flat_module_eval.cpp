@@ -0,0 +1,28 @@
+/**
+ * \file parser/flat_module_eval.cpp
+ *
+ * \brief Evaluate a flat expression.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Evaluate an expression.
+ *
+ * \param expression    The index of the expression.
+ *
+ * \returns the string value of the expression.
+ */
+string homesim::flat_module::eval(int expression) const
+{
+    const flat_ast_expression& expr = expressions[expression];
+
+    if (expr.functor < 0)
+        return symbols.str(expr.value);
+
+    return value(expression).str();
+}
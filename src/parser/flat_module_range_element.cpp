@@ -0,0 +1,30 @@
+/**
+ * \file parser/flat_module_range_element.cpp
+ *
+ * \brief Get an element of an index range.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get an element of an index range.  A single index names the same
+ * element for every element of a connection.  A range may run down as well
+ * as up.
+ *
+ * \param first         The first index of the range.
+ * \param last          The last index of the range.
+ * \param element       The element, from zero to the range width.
+ *
+ * \returns the index.
+ */
+int homesim::flat_module::range_element(int first, int last, int element)
+{
+    if (first == last)
+        return first;
+
+    return first < last ? first + element : first - element;
+}
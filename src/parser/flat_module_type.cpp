@@ -0,0 +1,29 @@
+/**
+ * \file parser/flat_module_type.cpp
+ *
+ * \brief Get the type of a flat expression.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the type of an expression.
+ *
+ * \param expression    The index of the expression.
+ *
+ * \returns the token type of the expression's value.
+ */
+token homesim::flat_module::type(int expression) const
+{
+    const flat_ast_expression& expr = expressions[expression];
+
+    /* TODO - for now, all complex expressions return a number. */
+    if (expr.functor >= 0)
+        return HOMESIM_TOKEN_NUMBER;
+
+    return expr.ty;
+}
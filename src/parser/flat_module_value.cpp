@@ -0,0 +1,36 @@
+/**
+ * \file parser/flat_module_value.cpp
+ *
+ * \brief Get the folded value of a flat expression.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the folded value of an expression.
+ *
+ * \param expression    The index of the expression.
+ *
+ * \returns the typed value of the expression.
+ */
+config_value homesim::flat_module::value(int expression) const
+{
+    const flat_ast_expression& expr = expressions[expression];
+    config_value retval{};
+
+    retval.type = expr.folded;
+    retval.number = expr.number;
+    retval.ticks = expr.ticks;
+    retval.boolean = HOMESIM_TOKEN_KEYWORD_TRUE == expr.ty;
+
+    /* only text values need their text. */
+    if (CONFIG_VALUE_STRING == expr.folded
+     || CONFIG_VALUE_IDENTIFIER == expr.folded)
+        retval.text = symbols.str(expr.value);
+
+    return retval;
+}
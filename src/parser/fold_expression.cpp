@@ -0,0 +1,67 @@
+/**
+ * \file parser/fold_expression.cpp
+ *
+ * \brief Fold an expression to its typed value.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Fold an expression to its typed value.
+ *
+ * \param symbols       The symbol table for the expression.
+ * \param expr          The expression to fold.  Its type, value, and functor
+ *                      must be set.
+ *
+ * \throws a \ref config_value_error if the expression can't be folded.
+ */
+void homesim::fold_expression(
+    const symbol_table& symbols, flat_ast_expression& expr)
+{
+    string text = symbols.str(expr.value);
+
+    expr.number = 0.0;
+    expr.ticks = 0;
+
+    if (expr.functor >= 0)
+    {
+        config_value v =
+            fold_functor(
+                symbols.str(expr.functor), text.data(),
+                text.data() + text.size());
+
+        expr.folded = v.type;
+        expr.number = v.number;
+        expr.ticks = v.ticks;
+
+        return;
+    }
+
+    switch (expr.ty)
+    {
+        case HOMESIM_TOKEN_NUMBER:
+            if (!config_parse_number(
+                    text.data(), text.data() + text.size(), expr.number))
+                throw config_value_error(
+                    string("Invalid number ") + text + ".");
+            expr.folded = CONFIG_VALUE_NUMBER;
+            break;
+
+        case HOMESIM_TOKEN_KEYWORD_TRUE:
+        case HOMESIM_TOKEN_KEYWORD_FALSE:
+            expr.folded = CONFIG_VALUE_BOOLEAN;
+            break;
+
+        case HOMESIM_TOKEN_STRING:
+            expr.folded = CONFIG_VALUE_STRING;
+            break;
+
+        default:
+            expr.folded = CONFIG_VALUE_IDENTIFIER;
+            break;
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * \file parser/fold_functor.cpp
+ *
+ * \brief Apply a configuration functor to its argument.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <cmath>
+#include <homesim/constants.h>
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief The largest magnitude, in ticks, that a folded time may have.
+ */
+static const double max_ticks = 9.0e18;
+
+/**
+ * \brief Fold a time, given in units of the given number of ticks.
+ */
+static config_value fold_time(double x, int64_t scale)
+{
+    config_value retval{};
+    double ticks = x * scale;
+
+    if (!(fabs(ticks) <= max_ticks))
+        throw config_value_error("Time is out of range.");
+
+    retval.type = CONFIG_VALUE_TIME;
+    retval.ticks = llround(ticks);
+
+    return retval;
+}
+
+/**
+ * \brief Apply a configuration functor, such as ns or kohms, to its argument.
+ *
+ * \param functor       The name of the functor.
+ * \param begin         The start of the argument text.
+ * \param end           One past the end of the argument text.
+ *
+ * \returns the folded value.
+ *
+ * \throws a \ref config_value_error if the functor is unknown or the argument
+ * is not a number.
+ */
+config_value homesim::fold_functor(
+    const string& functor, const char* begin, const char* end)
+{
+    double x;
+
+    if (!config_parse_number(begin, end, x))
+        throw config_value_error(
+            string("Invalid number ") + string(begin, end) + ".");
+
+    if (functor == "ns")
+    {
+        return fold_time(x, nanoseconds_to_ticks_scale);
+    }
+    else if (functor == "us")
+    {
+        return fold_time(x, microseconds_to_ticks_scale);
+    }
+    else if (functor == "ms")
+    {
+        return fold_time(x, milliseconds_to_ticks_scale);
+    }
+    else if (functor == "kohms")
+    {
+        config_value retval{};
+        retval.type = CONFIG_VALUE_NUMBER;
+        retval.number = x * kohms_to_ohms_scale;
+
+        return retval;
+    }
+    else
+    {
+        throw config_value_error(string("Unknown functor ") + functor + ".");
+    }
+}
@@ -6,6 +6,8 @@
  * \copyright Copyright 2020 Justin Handville. All rights reserved.
  */
 #include <homesim/parser.h>
+#include <istream>
+#include <iterator>
 
 using namespace homesim;
 using namespace std;
@@ -16,12 +18,34 @@ using namespace std;
  * \param input         The input stream for this instance.
  */
 homesim::lexer::lexer(std::istream& input)
-    : in(input)
-    , curline(1)
-    , curcol(0)
-    , start_line(0)
-    , start_col(0)
-    , end_line(0)
-    , end_col(0)
+    : storage(istreambuf_iterator<char>(input), istreambuf_iterator<char>())
+    , begin(storage.data())
+    , end(storage.data() + storage.size())
+    , pos(begin)
+    , last(begin)
+    , token_begin(begin)
+    , token_end(begin)
+    , line_pos(begin)
+    , line_begin(begin)
+    , line(1)
+{
+}
+
+/**
+ * \brief Create a lexer instance over the given buffer, without copying it.
+ *
+ * \param b             The start of the buffer.
+ * \param e             One past the end of the buffer.
+ */
+homesim::lexer::lexer(const char* b, const char* e)
+    : begin(b)
+    , end(e)
+    , pos(b)
+    , last(b)
+    , token_begin(b)
+    , token_end(b)
+    , line_pos(b)
+    , line_begin(b)
+    , line(1)
 {
 }
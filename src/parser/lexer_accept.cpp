@@ -13,8 +13,9 @@ using namespace std;
 
 void homesim::lexer::accept(int ch)
 {
-    end_line = curline;
-    end_col = curcol;
+    /* EOF has no place in the buffer. */
+    if (EOF == ch)
+        return;
 
-    tokenbuf.push_back(ch);
+    token_end = last + 1;
 }
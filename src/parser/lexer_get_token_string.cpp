@@ -18,5 +18,5 @@ using namespace std;
  */
 string homesim::lexer::get_token_string()
 {
-    return string(tokenbuf.begin(), tokenbuf.end());
+    return string(token_begin, token_end);
 }
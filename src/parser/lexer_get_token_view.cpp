@@ -0,0 +1,19 @@
+/**
+ * \file parser/lexer_get_token_view.cpp
+ *
+ * \brief Get the text of the current token.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/parser.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the text of the current token, as a view of the source buffer.
+ */
+string_view homesim::lexer::get_token_view() const
+{
+    return string_view(token_begin, token_end - token_begin);
+}
@@ -0,0 +1,133 @@
+/**
+ * \file parser/lexer_keyword.cpp
+ *
+ * \brief Look up a keyword by its spelling.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <cstring>
+#include <homesim/parser.h>
+
+using namespace homesim;
+using namespace std;
+
+namespace {
+
+struct keyword_entry
+{
+    const char* name;
+    size_t length;
+    token value;
+};
+
+}
+
+/**
+ * \brief Keyword table, indexed by keyword_hash.
+ *
+ * The hash coefficients were chosen by search so that every keyword lands in
+ * its own slot.  When adding a keyword, re-run the search if the new keyword
+ * collides, and update this table.
+ */
+static const keyword_entry keyword_table[64] = {
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "execution", 9, HOMESIM_TOKEN_KEYWORD_EXECUTION },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "probe", 5, HOMESIM_TOKEN_KEYWORD_PROBE },
+    { "signal", 6, HOMESIM_TOKEN_KEYWORD_SIGNAL },
+    { "module", 6, HOMESIM_TOKEN_KEYWORD_MODULE },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "source", 6, HOMESIM_TOKEN_KEYWORD_SOURCE },
+    { "true", 4, HOMESIM_TOKEN_KEYWORD_TRUE },
+    { "wire", 4, HOMESIM_TOKEN_KEYWORD_WIRE },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "start", 5, HOMESIM_TOKEN_KEYWORD_START },
+    { "examine", 7, HOMESIM_TOKEN_KEYWORD_EXAMINE },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "external", 8, HOMESIM_TOKEN_KEYWORD_EXTERNAL },
+    { "pulldown", 8, HOMESIM_TOKEN_KEYWORD_PULLDOWN },
+    { "state", 5, HOMESIM_TOKEN_KEYWORD_STATE },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "assert", 6, HOMESIM_TOKEN_KEYWORD_ASSERT },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "expect", 6, HOMESIM_TOKEN_KEYWORD_EXPECT },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "at", 2, HOMESIM_TOKEN_KEYWORD_AT },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "type", 4, HOMESIM_TOKEN_KEYWORD_TYPE },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "repeat", 6, HOMESIM_TOKEN_KEYWORD_REPEAT },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "scenario", 8, HOMESIM_TOKEN_KEYWORD_SCENARIO },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "pullup", 6, HOMESIM_TOKEN_KEYWORD_PULLUP },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "after", 5, HOMESIM_TOKEN_KEYWORD_AFTER },
+    { "export", 6, HOMESIM_TOKEN_KEYWORD_EXPORT },
+    { "component", 9, HOMESIM_TOKEN_KEYWORD_COMPONENT },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "false", 5, HOMESIM_TOKEN_KEYWORD_FALSE },
+    { "import", 6, HOMESIM_TOKEN_KEYWORD_IMPORT },
+    { nullptr, 0, HOMESIM_TOKEN_IDENTIFIER },
+    { "pin", 3, HOMESIM_TOKEN_KEYWORD_PIN },
+};
+
+static const size_t keyword_min_length = 2;
+static const size_t keyword_max_length = 9;
+
+static inline size_t keyword_hash(const char* str, size_t length)
+{
+    return
+        ((unsigned char)str[0]
+            + 22 * (unsigned char)str[length / 2]
+            + 21 * (unsigned char)str[length - 1]
+            + length)
+        & 63;
+}
+
+/**
+ * \brief Look up the keyword spelled by the given identifier.
+ *
+ * \param begin         The start of the identifier.
+ * \param end           One past the end of the identifier.
+ *
+ * \returns the keyword token, or HOMESIM_TOKEN_IDENTIFIER if this is not a
+ * keyword.
+ */
+token homesim::lexer::keyword(const char* begin, const char* end)
+{
+    size_t length = end - begin;
+
+    if (length < keyword_min_length || length > keyword_max_length)
+        return HOMESIM_TOKEN_IDENTIFIER;
+
+    const keyword_entry& entry = keyword_table[keyword_hash(begin, length)];
+    if (entry.length != length || memcmp(entry.name, begin, length))
+        return HOMESIM_TOKEN_IDENTIFIER;
+
+    return entry.value;
+}
@@ -13,5 +13,7 @@ using namespace std;
 
 void homesim::lexer::put_back(int ch)
 {
-    putbackbuf.push_front(ch);
+    /* only the last character read is ever put back. */
+    if (EOF != ch)
+        pos = last;
 }
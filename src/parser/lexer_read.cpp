@@ -11,6 +11,28 @@
 using namespace homesim;
 using namespace std;
 
+/**
+ * \brief Characters that may continue an identifier: [A-Za-z0-9_].
+ */
+static const bool identifier_char[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
 /**
  * \brief Read a token from the stream.
  *
@@ -28,7 +50,7 @@ token homesim::lexer::read()
     switch (ch)
     {
         case EOF:
-            tokenbuf.clear();
+            token_end = token_begin;
             return HOMESIM_TOKEN_EOF;
 
         case ':':
@@ -84,50 +106,12 @@ token homesim::lexer::read()
             start(ch);
             return maybeReadNumber();
 
-        case 'a':
-            start(ch);
-            return maybeReadKeywordAfterAssertAtOrIdentifier();
-
-        case 'c':
-            start(ch);
-            return
-                matchKeywordOrIdentifier(
-                    "omponent", HOMESIM_TOKEN_KEYWORD_COMPONENT);
-
-        case 'e':
-            start(ch);
-            return
-                maybeReadKeywordExamineExecutionExpectExportExternalOrIdentifier();
-
-        case 'f':
-            start(ch);
-            return
-                matchKeywordOrIdentifier("alse", HOMESIM_TOKEN_KEYWORD_FALSE);
-
-        case 'm':
-            start(ch);
-            return
-                matchKeywordOrIdentifier("odule", HOMESIM_TOKEN_KEYWORD_MODULE);
-
-        case 'p':
-            start(ch);
-            return maybeReadKeywordPinProbePulldownPullupOrIdentifier();
-
-        case 's':
-            start(ch);
-            return maybeReadKeywordScenarioSignalStartStateOrIdentifier();
-
-        case 't':
-            start(ch);
-            return maybeReadKeywordTrueTypeOrIdentifier();
-
-        case 'w':
+        default:
             start(ch);
-            return matchKeywordOrIdentifier("ire", HOMESIM_TOKEN_KEYWORD_WIRE);
+            if (isalpha(ch) || '_' == ch)
+                return maybeReadIdentifier();
 
-        default:
-            put_back(ch);
-            return maybeReadStartIdentifier();
+            return HOMESIM_TOKEN_INVALID;
     }
 }
 
@@ -135,13 +119,17 @@ token homesim::lexer::maybeReadAssign()
 {
     int ch = read_char();
 
-    accept(ch);
+    /* a colon followed by an equal is an assignment. */
+    if (ch == '=')
+    {
+        accept(ch);
+        return HOMESIM_TOKEN_ASSIGN;
+    }
 
-    /* after a colon, only an equal is valid. */
-    if (ch != '=')
-        return HOMESIM_TOKEN_INVALID;
+    /* otherwise, this is a colon, as in an index range. */
+    put_back(ch);
 
-    return HOMESIM_TOKEN_ASSIGN;
+    return HOMESIM_TOKEN_COLON;
 }
 
 token homesim::lexer::maybeReadAsterisk()
@@ -257,6 +245,11 @@ token homesim::lexer::maybeReadNumber()
             put_back(ch);
             return HOMESIM_TOKEN_NUMBER;
 
+        /* a colon separates the indices of a range. */
+        case ':':
+            put_back(ch);
+            return HOMESIM_TOKEN_NUMBER;
+
         /* equals is okay. */
         case '=':
             put_back(ch);
@@ -404,31 +397,29 @@ token homesim::lexer::maybeReadExponentNumber()
     }
 }
 
-token homesim::lexer::maybeReadStartIdentifier()
+token homesim::lexer::maybeReadIdentifier()
 {
-    int ch = read_char();
-
-    start(ch);
+    const char* scan = pos;
 
-    if (isalpha(ch) || '_' == ch)
-        return maybeReadIdentifier();
+    /* scan the rest of the identifier directly from the buffer. */
+    while (scan != end && identifier_char[(unsigned char)*scan])
+        ++scan;
 
-    return HOMESIM_TOKEN_INVALID;
-}
+    if (scan != pos)
+    {
+        last = scan - 1;
+        token_end = scan;
+        pos = scan;
+    }
 
-token homesim::lexer::maybeReadIdentifier()
-{
     int ch = read_char();
 
-    while (isalnum(ch) || '_' == ch)
-    {
-        accept(ch);
-        ch = read_char();
-    }
+    /* keywords are identifiers found in the keyword table. */
+    token t = keyword(token_begin, token_end);
 
     /* a space successfully terminates an identifier. */
     if (isspace(ch))
-        return HOMESIM_TOKEN_IDENTIFIER;
+        return t;
 
     /* any other value is something else. */
     put_back(ch);
@@ -443,294 +434,28 @@ token homesim::lexer::maybeReadIdentifier()
         case ']':
         case '(':
         case ')':
-            return HOMESIM_TOKEN_IDENTIFIER;
+            return t;
 
         /* equals is okay. */
         case '=':
-            return HOMESIM_TOKEN_IDENTIFIER;
+            return t;
 
         /* dot is okay. */
         case '.':
-            return HOMESIM_TOKEN_IDENTIFIER;
-
-        /* something fishy. */
-        default:
-            accept(ch);
-            return HOMESIM_TOKEN_INVALID;
-    }
-
-    return HOMESIM_TOKEN_INVALID;
-}
-
-token homesim::lexer::maybeReadKeywordAfterAssertAtOrIdentifier()
-{
-    int ch = read_char();
-
-    if (isspace(ch))
-        return HOMESIM_TOKEN_IDENTIFIER;
-
-    switch (ch)
-    {
-        case 'f':
-            accept(ch);
-            return
-                matchKeywordOrIdentifier("ter", HOMESIM_TOKEN_KEYWORD_AFTER);
-
-        case 's':
-            accept(ch);
-            return
-                matchKeywordOrIdentifier("sert", HOMESIM_TOKEN_KEYWORD_ASSERT);
-
-        case 't':
-            accept(ch);
-            return
-                matchKeywordOrIdentifier("", HOMESIM_TOKEN_KEYWORD_AT);
-
-        case EOF:
-            return HOMESIM_TOKEN_IDENTIFIER;
-
-        default:
-            put_back(ch);
-            return maybeReadIdentifier();
-    }
-
-    return HOMESIM_TOKEN_INVALID;
-}
-
-token
-homesim::lexer::maybeReadKeywordExamineExecutionExpectExportExternalOrIdentifier()
-{
-    int ch = read_char();
-
-    if ('x' != ch)
-    {
-        put_back(ch);
-        return maybeReadIdentifier();
-    }
-
-    accept(ch);
-    ch = read_char();
-
-    switch (ch)
-    {
-        case 'a':
-            accept(ch);
-            return
-                matchKeywordOrIdentifier("mine", HOMESIM_TOKEN_KEYWORD_EXAMINE);
-
-        case 'e':
-            accept(ch);
-            return
-                matchKeywordOrIdentifier(
-                    "cution", HOMESIM_TOKEN_KEYWORD_EXECUTION);
-
-        case 'p':
-            accept(ch);
-            return maybeReadKeywordExpectExportOrIdentifier();
-
-        case 't':
-            accept(ch);
-            return
-                matchKeywordOrIdentifier(
-                    "ernal", HOMESIM_TOKEN_KEYWORD_EXTERNAL);
-
-        case EOF:
-            return HOMESIM_TOKEN_IDENTIFIER;
-
-        default:
-            put_back(ch);
-            return maybeReadIdentifier();
-    }
-
-    return HOMESIM_TOKEN_INVALID;
-}
-
-token homesim::lexer::maybeReadKeywordExpectExportOrIdentifier()
-{
-    int ch = read_char();
-
-    switch (ch)
-    {
-        case 'e':
-            accept(ch);
-            return
-                matchKeywordOrIdentifier("ct", HOMESIM_TOKEN_KEYWORD_EXPECT);
-
-        case 'o':
-            accept(ch);
-            return
-                matchKeywordOrIdentifier(
-                    "rt", HOMESIM_TOKEN_KEYWORD_EXPORT);
-
-        case EOF:
-            return HOMESIM_TOKEN_IDENTIFIER;
+            return t;
 
-        default:
-            put_back(ch);
-            return maybeReadIdentifier();
-    }
-}
-
-token homesim::lexer::maybeReadKeywordPinProbePulldownPullupOrIdentifier()
-{
-    int ch = read_char();
-
-    switch (ch)
-    {
-        case 'i':
-            accept(ch);
-            return matchKeywordOrIdentifier("n", HOMESIM_TOKEN_KEYWORD_PIN);
-
-        case 'r':
-            accept(ch);
-            return matchKeywordOrIdentifier("obe", HOMESIM_TOKEN_KEYWORD_PROBE);
-
-        case 'u':
-            accept(ch);
-            return maybeReadKeywordPulldownPullupOrIdentifier();
-
-        case EOF:
-            return HOMESIM_TOKEN_IDENTIFIER;
-
-        default:
-            put_back(ch);
-            return maybeReadIdentifier();
-    }
-
-    return HOMESIM_TOKEN_INVALID;
-}
-
-token homesim::lexer::maybeReadKeywordPulldownPullupOrIdentifier()
-{
-    int ch = read_char();
-
-    if ('l' != ch)
-    {
-        put_back(ch);
-        return maybeReadIdentifier();
-    }
-
-    accept(ch);
-    ch = read_char();
-
-    if ('l' != ch)
-    {
-        put_back(ch);
-        return maybeReadIdentifier();
-    }
-
-    accept(ch);
-    ch = read_char();
-
-    switch (ch)
-    {
-        case 'd':
-            accept(ch);
-            return
-                matchKeywordOrIdentifier("own", HOMESIM_TOKEN_KEYWORD_PULLDOWN);
-
-        case 'u':
-            accept(ch);
-            return matchKeywordOrIdentifier("p", HOMESIM_TOKEN_KEYWORD_PULLUP);
-
-        case EOF:
-            return HOMESIM_TOKEN_IDENTIFIER;
-
-        default:
-            put_back(ch);
-            return maybeReadIdentifier();
-    }
-
-    return HOMESIM_TOKEN_INVALID;
-}
-
-token homesim::lexer::maybeReadKeywordScenarioSignalStartStateOrIdentifier()
-{
-    int ch = read_char();
-
-    switch (ch)
-    {
-        case 'c':
-            accept(ch);
-            return
-                matchKeywordOrIdentifier(
-                    "enario", HOMESIM_TOKEN_KEYWORD_SCENARIO);
-
-        case 'i':
-            accept(ch);
-            return
-                matchKeywordOrIdentifier("gnal", HOMESIM_TOKEN_KEYWORD_SIGNAL);
-
-        case 'o':
-            accept(ch);
-            return
-                matchKeywordOrIdentifier("urce", HOMESIM_TOKEN_KEYWORD_SOURCE);
-
-        case 't':
-            accept(ch);
-            return maybeReadKeywordStartStateOrIdentifier();
-
-        case EOF:
-            return HOMESIM_TOKEN_IDENTIFIER;
-
-        default:
-            put_back(ch);
-            return maybeReadIdentifier();
-    }
-}
-
-token homesim::lexer::maybeReadKeywordStartStateOrIdentifier()
-{
-    int ch = read_char();
-
-    if ('a' != ch)
-    {
-        put_back(ch);
-        return maybeReadIdentifier();
-    }
-
-    accept(ch);
-    ch = read_char();
-
-    switch (ch)
-    {
-        case 'r':
-            accept(ch);
-            return matchKeywordOrIdentifier("t", HOMESIM_TOKEN_KEYWORD_START);
+        /* only a keyword can be followed directly by an assignment. */
+        case ':':
+            if (HOMESIM_TOKEN_IDENTIFIER != t)
+                return t;
 
-        case 't':
             accept(ch);
-            return matchKeywordOrIdentifier("e", HOMESIM_TOKEN_KEYWORD_STATE);
-
-        case EOF:
-            return HOMESIM_TOKEN_IDENTIFIER;
+            return HOMESIM_TOKEN_INVALID;
 
+        /* something fishy. */
         default:
-            put_back(ch);
-            return maybeReadIdentifier();
-    }
-}
-
-token homesim::lexer::maybeReadKeywordTrueTypeOrIdentifier()
-{
-    int ch = read_char();
-
-    switch (ch)
-    {
-        case 'r':
-            accept(ch);
-            return matchKeywordOrIdentifier("ue", HOMESIM_TOKEN_KEYWORD_TRUE);
-
-        case 'y':
             accept(ch);
-            return matchKeywordOrIdentifier("pe", HOMESIM_TOKEN_KEYWORD_TYPE);
-
-        case EOF:
-            return HOMESIM_TOKEN_IDENTIFIER;
-
-        default:
-            put_back(ch);
-            return maybeReadIdentifier();
+            return HOMESIM_TOKEN_INVALID;
     }
 }
 
@@ -753,89 +478,3 @@ token homesim::lexer::maybeReadString()
 
     return HOMESIM_TOKEN_STRING;
 }
-
-token homesim::lexer::matchSequence(
-    const string& seq, function<token ()> onAccept, function<token ()> onFail)
-{
-    for (auto i : seq)
-    {
-        int ch = read_char();
-
-        if (ch != i)
-        {
-            put_back(ch);
-            return onFail();
-        }
-
-        accept(ch);
-    }
-
-    return onAccept();
-}
-
-token homesim::lexer::matchEndOfKeyword(
-    function<token ()> onAccept,
-    function<token ()> onFail)
-{
-    int ch = read_char();
-
-    /* space ends the keyword. */
-    if (isspace(ch))
-        return onAccept();
-
-    /* any other value turns this into an identifier. */
-    if (isalnum(ch) || '_' == ch)
-    {
-        accept(ch);
-        return onFail();
-    }
-
-    /* any other value is something else. */
-    put_back(ch);
-
-    /* handle other possible ending characters. */
-    switch (ch)
-    {
-        /* structural tokens or EOF are fine. */
-        case EOF:
-        case '{':
-        case '}':
-        case '[':
-        case ']':
-        case '(':
-        case ')':
-            return onAccept();
-
-        /* equals is okay. */
-        case '=':
-            return onAccept();
-
-        /* dot is okay. */
-        case '.':
-            return onAccept();
-
-        /* assignment is okay. */
-        case ':':
-            return onAccept();
-
-        /* something fishy. */
-        default:
-            return onFail();
-    }
-}
-
-token homesim::lexer::matchKeywordOrIdentifier(
-    const std::string& seq, token keywordToken)
-{
-    return
-        matchSequence(
-            seq,
-            [&]() -> token {
-                return
-                    matchEndOfKeyword(
-                        [=]() -> token {
-                            return keywordToken; },
-                        [&]() -> token {
-                            return maybeReadIdentifier(); });},
-            [&]() -> token { return maybeReadIdentifier(); });
-}
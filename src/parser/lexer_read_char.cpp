@@ -1,7 +1,7 @@
 /**
  * \file parser/lexer_read_char.cpp
  *
- * \brief Read a character from the input stream and adjust lines / cols.
+ * \brief Read a character from the source buffer.
  *
  * \copyright Copyright 2020 Justin Handville. All rights reserved.
  */
@@ -13,26 +13,10 @@ using namespace std;
 
 int homesim::lexer::read_char()
 {
-    int ch;
+    if (pos == end)
+        return EOF;
 
-    if (putbackbuf.size() > 0)
-    {
-        ch = putbackbuf.front();
-        putbackbuf.pop_front();
-    }
-    else
-    {
-        ch = in.get();
-        if ('\n' == ch)
-        {
-            ++curline;
-            curcol = 0;
-        }
-        else
-        {
-            ++curcol;
-        }
-    }
+    last = pos;
 
-    return ch;
+    return (unsigned char)*pos++;
 }
@@ -25,8 +25,26 @@ using namespace std;
 void homesim::lexer::read_linecol(
     int& sl, int& sc, int& el, int& ec) const
 {
-    sl = start_line;
-    sc = start_col;
-    el = start_line;
-    ec = sc + tokenbuf.size() - 1;
+    /* tokens only move forward, so resume counting lines where the last
+     * request left off. */
+    if (token_begin < line_pos)
+    {
+        line_pos = begin;
+        line_begin = begin;
+        line = 1;
+    }
+
+    for (; line_pos < token_begin; ++line_pos)
+    {
+        if ('\n' == *line_pos)
+        {
+            ++line;
+            line_begin = line_pos + 1;
+        }
+    }
+
+    sl = line;
+    sc = token_begin - line_begin + 1;
+    el = sl;
+    ec = sc + (token_end - token_begin) - 1;
 }
@@ -13,10 +13,8 @@ using namespace std;
 
 void homesim::lexer::start(int ch)
 {
-    start_line = curline;
-    start_col = curcol;
-
-    tokenbuf.clear();
+    token_begin = last;
+    token_end = last;
 
     accept(ch);
 }
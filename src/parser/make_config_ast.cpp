@@ -0,0 +1,227 @@
+/**
+ * \file parser/make_config_ast.cpp
+ *
+ * \brief Build a config AST from a flat module.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <algorithm>
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+static string name(const flat_module& mod, int id);
+static shared_ptr<config_ast_expression> expression(
+    const flat_module& mod, int index);
+static shared_ptr<config_ast_component> component(
+    const flat_module& mod, const flat_ast_component& c);
+static void steps(
+    const flat_module& mod, int first, int count,
+    list<shared_ptr<config_ast_step>>& step_list);
+
+/**
+ * \brief Build a config AST from a flat module.
+ *
+ * \param mod           The flat module to expand.
+ *
+ * \returns the config AST.
+ */
+shared_ptr<config_ast_module> homesim::make_config_ast(const flat_module& mod)
+{
+    auto module = make_shared<config_ast_module>();
+    module->name = name(mod, mod.name);
+
+    for (auto i : mod.imports)
+        module->import_list.push_back(name(mod, i));
+
+    /* arrays are expanded into a node per element. */
+    for (auto& c : mod.components)
+    {
+        for (int i = 0; i < max(c.count, 1); ++i)
+        {
+            auto comp = component(mod, c);
+            comp->name = mod.element_name(c.name, c.count, i);
+            module->component_map.insert(make_pair(comp->name, comp));
+        }
+    }
+
+    for (auto& w : mod.wires)
+    {
+        for (int k = 0; k < max(w.count, 1); ++k)
+        {
+            auto wire = make_shared<config_ast_wire>();
+            wire->name = mod.element_name(w.name, w.count, k);
+            wire->exported = w.exported;
+            wire->external_source = w.external_source;
+
+            for (int i = 0; i < w.connection_count; ++i)
+            {
+                int index = w.first_connection + i;
+                int width = mod.connection_width(index);
+
+                /* a scalar wire binds every element of a connection. */
+                for (int j = 0; j < width; ++j)
+                {
+                    if (w.count > 0 && j != k)
+                        continue;
+
+                    auto connection = make_shared<config_ast_connection>();
+                    mod.connection_target(
+                        index, j, connection->component, connection->pin);
+                    wire->connection_list.push_back(connection);
+                }
+            }
+
+            if (w.pull >= 0)
+                wire->pullup_pulldown = component(mod, mod.pulls[w.pull]);
+
+            module->wire_map.insert(make_pair(wire->name, wire));
+        }
+    }
+
+    for (auto& p : mod.probes)
+    {
+        auto probe = make_shared<config_ast_probe>();
+        probe->name = name(mod, p.name);
+        probe->type = name(mod, p.type);
+        if (p.sub_type >= 0)
+            probe->sub_type = make_shared<string>(name(mod, p.sub_type));
+
+        for (int i = 0; i < p.wire_ref_count; ++i)
+        {
+            probe->wire_ref_list.push_back(
+                name(mod, mod.wire_refs[p.first_wire_ref + i]));
+        }
+
+        module->probe_map.insert(make_pair(probe->name, probe));
+    }
+
+    for (auto& s : mod.scenarios)
+    {
+        auto scenario = make_shared<config_ast_scenario>();
+        scenario->name = name(mod, s.name);
+
+        for (int i = 0; i < s.execution_count; ++i)
+        {
+            auto& e = mod.executions[s.first_execution + i];
+            auto execution = make_shared<config_ast_execution>();
+            execution->name = name(mod, e.name);
+
+            steps(mod, e.first_step, e.step_count, execution->step_list);
+
+            scenario->execution_map.insert(
+                make_pair(execution->name, execution));
+        }
+
+        module->scenario_map.insert(make_pair(scenario->name, scenario));
+    }
+
+    return module;
+}
+
+/**
+ * \brief Get the name for a symbol id, or an empty name if unset.
+ */
+static string name(const flat_module& mod, int id)
+{
+    if (id < 0)
+        return string();
+
+    return mod.symbols.str(id);
+}
+
+/**
+ * \brief Expand a flat expression.
+ */
+static shared_ptr<config_ast_expression> expression(
+    const flat_module& mod, int index)
+{
+    if (index < 0)
+        return nullptr;
+
+    auto& e = mod.expressions[index];
+
+    if (e.functor >= 0)
+    {
+        auto expr = make_shared<config_ast_complex_expression>();
+        expr->functor = name(mod, e.functor);
+        expr->args.push_back(make_pair(e.ty, name(mod, e.value)));
+
+        return expr;
+    }
+
+    auto expr = make_shared<config_ast_simple_expression>();
+    expr->simple_value = name(mod, e.value);
+    expr->ty = e.ty;
+
+    return expr;
+}
+
+/**
+ * \brief Expand a flat component.
+ */
+static shared_ptr<config_ast_component> component(
+    const flat_module& mod, const flat_ast_component& c)
+{
+    auto comp = make_shared<config_ast_component>();
+    comp->name = name(mod, c.name);
+    if (c.type >= 0)
+        comp->type = make_shared<string>(name(mod, c.type));
+
+    for (int i = 0; i < c.config_count; ++i)
+    {
+        auto& config = mod.configs[c.first_config + i];
+        comp->config_map.insert(
+            make_pair(
+                name(mod, config.key), expression(mod, config.expression)));
+    }
+
+    return comp;
+}
+
+/**
+ * \brief Expand a range of flat steps, nesting the body of each repeat block.
+ */
+static void steps(
+    const flat_module& mod, int first, int count,
+    list<shared_ptr<config_ast_step>>& step_list)
+{
+    for (int j = first; j < first + count; ++j)
+    {
+        auto& st = mod.steps[j];
+        auto step = make_shared<config_ast_step>();
+        step->type = name(mod, st.type);
+        step->step_expression = expression(mod, st.expression);
+
+        for (int k = 0; k < st.pin_assignment_count; ++k)
+        {
+            auto& pa = mod.pin_assignments[st.first_pin_assignment + k];
+            auto assignment = make_shared<config_ast_assignment>();
+            /* a scalar reference has no element, and names no index. */
+            assignment->lhs_major =
+                mod.element_name(pa.component, pa.element + 1, pa.element);
+            assignment->lhs_minor = name(mod, pa.pin);
+            assignment->rhs = expression(mod, pa.expression);
+            step->pin_assignments.push_back(assignment);
+        }
+
+        for (int k = 0; k < st.assertion_count; ++k)
+        {
+            auto& a = mod.assertions[st.first_assertion + k];
+            auto assertion = make_shared<config_ast_assertion>();
+            assertion->type = name(mod, a.type);
+            if (a.wire >= 0)
+                assertion->lhs.push_back(
+                    mod.element_name(a.wire, a.element + 1, a.element));
+            assertion->rhs = expression(mod, a.expression);
+            step->assertion_list.push_back(assertion);
+        }
+
+        /* the body of a repeat block follows it. */
+        steps(mod, j + 1, st.body_count, step->step_list);
+        j += st.body_count;
+
+        step_list.push_back(step);
+    }
+}
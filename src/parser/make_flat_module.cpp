@@ -0,0 +1,223 @@
+/**
+ * \file parser/make_flat_module.cpp
+ *
+ * \brief Build a flat module from a config AST.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+static int expression(
+    flat_module& mod, const shared_ptr<config_ast_expression>& expr);
+static flat_ast_component component(
+    flat_module& mod, const config_ast_component& c);
+static void steps(
+    flat_module& mod, const list<shared_ptr<config_ast_step>>& step_list);
+
+/**
+ * \brief Build a flat module from a config AST.
+ *
+ * \param mod           The config AST to flatten.
+ *
+ * \returns the flat module.
+ */
+shared_ptr<flat_module> homesim::make_flat_module(const config_ast_module& mod)
+{
+    auto flat = make_shared<flat_module>();
+    flat->name = flat->symbols.intern(mod.name);
+
+    for (auto& i : mod.import_list)
+        flat->imports.push_back(flat->symbols.intern(i));
+
+    for (auto& i : mod.component_map)
+    {
+        auto c = component(*flat, *i.second);
+        c.name = flat->symbols.intern(i.first);
+        flat->components.push_back(c);
+    }
+
+    for (auto& i : mod.wire_map)
+    {
+        auto& w = *i.second;
+        flat_ast_wire wire;
+
+        wire.name = flat->symbols.intern(i.first);
+        wire.exported = w.exported;
+        wire.external_source = w.external_source;
+        wire.first_connection = flat->connections.size();
+        wire.connection_count = w.connection_list.size();
+        wire.pull = -1;
+        wire.count = 0;
+
+        for (auto& c : w.connection_list)
+        {
+            flat->connections.push_back(
+                flat_ast_connection{
+                    flat->symbols.intern(c->component),
+                    flat->symbols.intern(c->pin), -1, -1, -1, -1 });
+        }
+
+        if (!!w.pullup_pulldown)
+        {
+            flat->pulls.push_back(component(*flat, *w.pullup_pulldown));
+            wire.pull = flat->pulls.size() - 1;
+        }
+
+        flat->wires.push_back(wire);
+    }
+
+    for (auto& i : mod.probe_map)
+    {
+        auto& p = *i.second;
+        flat_ast_probe probe;
+
+        probe.name = flat->symbols.intern(i.first);
+        probe.type = flat->symbols.intern(p.type);
+        probe.sub_type = !!p.sub_type ? flat->symbols.intern(*p.sub_type) : -1;
+        probe.first_wire_ref = flat->wire_refs.size();
+        probe.wire_ref_count = p.wire_ref_list.size();
+
+        for (auto& r : p.wire_ref_list)
+            flat->wire_refs.push_back(flat->symbols.intern(r));
+
+        flat->probes.push_back(probe);
+    }
+
+    for (auto& i : mod.scenario_map)
+    {
+        flat_ast_scenario scenario;
+
+        scenario.name = flat->symbols.intern(i.first);
+        scenario.first_execution = flat->executions.size();
+        scenario.execution_count = i.second->execution_map.size();
+
+        for (auto& j : i.second->execution_map)
+        {
+            flat_ast_execution execution;
+
+            execution.name = flat->symbols.intern(j.first);
+            execution.first_step = flat->steps.size();
+            steps(*flat, j.second->step_list);
+            execution.step_count = flat->steps.size() - execution.first_step;
+
+            flat->executions.push_back(execution);
+        }
+
+        flat->scenarios.push_back(scenario);
+    }
+
+    return flat;
+}
+
+/**
+ * \brief Flatten an expression, returning its index or -1 if it is unset.
+ */
+static int expression(
+    flat_module& mod, const shared_ptr<config_ast_expression>& expr)
+{
+    if (!expr)
+        return -1;
+
+    flat_ast_expression e;
+
+    auto complex = dynamic_pointer_cast<config_ast_complex_expression>(expr);
+    if (!!complex && !complex->args.empty())
+    {
+        e.ty = complex->args.front().first;
+        e.value = mod.symbols.intern(complex->args.front().second);
+        e.functor = mod.symbols.intern(complex->functor);
+    }
+    else
+    {
+        e.ty = expr->type();
+        e.value = mod.symbols.intern(expr->eval());
+        e.functor = -1;
+    }
+
+    try
+    {
+        fold_expression(mod.symbols, e);
+    }
+    catch (config_value_error& ex)
+    {
+        throw parser_error(ex.what());
+    }
+
+    mod.expressions.push_back(e);
+
+    return mod.expressions.size() - 1;
+}
+
+/**
+ * \brief Flatten a component, leaving its name for the caller to set.
+ */
+static flat_ast_component component(
+    flat_module& mod, const config_ast_component& c)
+{
+    flat_ast_component comp;
+
+    comp.name = -1;
+    comp.type = !!c.type ? mod.symbols.intern(*c.type) : -1;
+    comp.first_config = mod.configs.size();
+    comp.config_count = c.config_map.size();
+    comp.count = 0;
+
+    for (auto& i : c.config_map)
+    {
+        mod.configs.push_back(
+            flat_ast_config{
+                mod.symbols.intern(i.first),
+                expression(mod, i.second) });
+    }
+
+    return comp;
+}
+
+/**
+ * \brief Flatten a list of steps, placing the body of each repeat block
+ * directly after it.
+ */
+static void steps(
+    flat_module& mod, const list<shared_ptr<config_ast_step>>& step_list)
+{
+    for (auto& st : step_list)
+    {
+        flat_ast_step step;
+
+        step.type = mod.symbols.intern(st->type);
+        step.expression = expression(mod, st->step_expression);
+        step.first_pin_assignment = mod.pin_assignments.size();
+        step.pin_assignment_count = st->pin_assignments.size();
+        step.first_assertion = mod.assertions.size();
+        step.assertion_count = st->assertion_list.size();
+        step.body_count = 0;
+
+        for (auto& pa : st->pin_assignments)
+        {
+            mod.pin_assignments.push_back(
+                flat_ast_pin_assignment{
+                    mod.symbols.intern(pa->lhs_major), -1,
+                    mod.symbols.intern(pa->lhs_minor),
+                    expression(mod, pa->rhs) });
+        }
+
+        for (auto& a : st->assertion_list)
+        {
+            mod.assertions.push_back(
+                flat_ast_assertion{
+                    mod.symbols.intern(a->type),
+                    a->lhs.empty() ? -1 : mod.symbols.intern(a->lhs.front()),
+                    -1,
+                    expression(mod, a->rhs) });
+        }
+
+        int index = mod.steps.size();
+        mod.steps.push_back(step);
+
+        steps(mod, st->step_list);
+        mod.steps[index].body_count = mod.steps.size() - index - 1;
+    }
+}
@@ -0,0 +1,67 @@
+/**
+ * \file parser/mapped_file.cpp
+ *
+ * \brief Map a source file into memory.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <fcntl.h>
+#include <homesim/parser.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Map the given file into memory.
+ *
+ * \param path          The path of the file to map.
+ *
+ * \throws a mapped_file_error if the file can't be opened or mapped.
+ */
+homesim::mapped_file::mapped_file(const string& path)
+    : data(nullptr)
+    , length(0)
+{
+    struct stat st;
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw mapped_file_error("Could not open " + path);
+
+    if (fstat(fd, &st) < 0)
+    {
+        close(fd);
+        throw mapped_file_error("Could not stat " + path);
+    }
+
+    /* an empty file can't be mapped, but it is a valid empty range. */
+    length = st.st_size;
+    if (0 == length)
+    {
+        close(fd);
+        return;
+    }
+
+    void* addr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (MAP_FAILED == addr)
+        throw mapped_file_error("Could not map " + path);
+
+    /* the lexer reads front to back. */
+    madvise(addr, length, MADV_SEQUENTIAL);
+
+    data = static_cast<const char*>(addr);
+}
+
+/**
+ * \brief Unmap the file.
+ */
+homesim::mapped_file::~mapped_file()
+{
+    if (nullptr != data)
+        munmap(const_cast<char*>(data), length);
+}
@@ -0,0 +1,19 @@
+/**
+ * \file parser/mapped_file_begin.cpp
+ *
+ * \brief Get the start of the mapped file contents.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/parser.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the start of the mapped file contents.
+ */
+const char* homesim::mapped_file::begin() const
+{
+    return data;
+}
@@ -0,0 +1,19 @@
+/**
+ * \file parser/mapped_file_end.cpp
+ *
+ * \brief Get the end of the mapped file contents.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/parser.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the end of the mapped file contents.
+ */
+const char* homesim::mapped_file::end() const
+{
+    return data + length;
+}
@@ -17,5 +17,20 @@ using namespace std;
  */
 homesim::parser::parser(std::istream& input)
     : in(input)
+    , lookahead_count(0)
+    , listener(nullptr)
+{
+}
+
+/**
+ * \brief Create a parser instance over the given buffer, without copying it.
+ *
+ * \param begin         The start of the buffer.
+ * \param end           One past the end of the buffer.
+ */
+homesim::parser::parser(const char* begin, const char* end)
+    : in(begin, end)
+    , lookahead_count(0)
+    , listener(nullptr)
 {
 }
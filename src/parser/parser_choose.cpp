@@ -0,0 +1,50 @@
+/**
+ * \file parser/parser_choose.cpp
+ *
+ * \brief Read one of a choice of tokens.
+ *
+ * \copyright Copyright 2020 Justin Handville. All rights reserved.
+ */
+#include <homesim/parser.h>
+#include <set>
+#include <sstream>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Read the next token, which must be one of the given types.
+ *
+ * \param choices       The token types that may be read.
+ *
+ * \returns the token read.
+ *
+ * \throws a parser_error if any other token was read.
+ */
+parser::parser_token
+homesim::parser::choose(initializer_list<token> choices)
+{
+    parser_token ret = read();
+
+    for (auto i : choices)
+    {
+        if (i == ret.type)
+            return ret;
+    }
+
+    /* describe the choices in token order. */
+    set<token> choice_set(choices.begin(), choices.end());
+    stringstream sout;
+    int sl, sc, el, ec;
+    in.read_linecol(sl, sc, el, ec);
+
+    sout << "Error at " << sl << ":" << sc << ": ";
+    sout << "Expecting one of (";
+    for (auto i : choice_set)
+    {
+        sout << " " << token_to_description(i) << " ";
+    }
+    sout << "). Got " << token_to_description(ret.type) << ".";
+
+    throw parser_error(sout.str());
+}
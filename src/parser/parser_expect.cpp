@@ -0,0 +1,43 @@
+/**
+ * \file parser/parser_expect.cpp
+ *
+ * \brief Read an expected token.
+ *
+ * \copyright Copyright 2020 Justin Handville. All rights reserved.
+ */
+#include <homesim/parser.h>
+#include <sstream>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Read the next token, which must be of the given type.
+ *
+ * \param t             The expected token type.
+ *
+ * \returns the token read.
+ *
+ * \throws a parser_error if a different token was read.
+ */
+parser::parser_token
+homesim::parser::expect(token t)
+{
+    parser_token ret = read();
+
+    /* fail if not the right token. */
+    if (t != ret.type)
+    {
+        stringstream sout;
+        int sl, sc, el, ec;
+        in.read_linecol(sl, sc, el, ec);
+
+        sout << "Error at " << sl << ":" << sc << ": ";
+        sout << "Expecting " << token_to_description(t)
+             << ". Got " << token_to_description(ret.type) << ".";
+
+        throw parser_error(sout.str());
+    }
+
+    return ret;
+}
@@ -5,34 +5,16 @@
  *
  * \copyright Copyright 2020 Justin Handville. All rights reserved.
  */
-#include <homesim/parser.h>
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <homesim/flat_ast.h>
+#include <limits>
+#include <sstream>
 
 using namespace homesim;
 using namespace std;
 
-/* macro hackery to make the parser below a bit easier to understand. */
-#define SEQUENCE_BEGIN() \
-    parse_sequence({
-#define SEQUENCE_END() \
-    });
-#define SEQ(tok) \
-    make_pair(tok, nullptr)
-#define SEQL_BEGIN(tok, var) \
-    make_pair(tok, \
-    make_shared<function<void(const token_pair&)>>( \
-        [&](const token_pair& var) {
-#define SEQL_END() \
-    }))
-#define CHOOSE_BEGIN() \
-    parse_choose({
-#define CHOOSE_END() \
-    });
-#define OPTION(token) SEQ(token)
-#define OPTIONL_BEGIN(token,var) SEQL_BEGIN(token,var)
-#define OPTIONL_END() SEQL_END()
-#define OPTIONF(tok, func) \
-    make_pair(tok, func)
-
 /**
  * \brief Parse the input stream producing a config ast.
  *
@@ -43,580 +25,766 @@ using namespace std;
  */
 shared_ptr<config_ast_module> homesim::parser::parse()
 {
-    auto module = make_shared<config_ast_module>();
+    return make_config_ast(*parse_flat());
+}
+
+/**
+ * \brief Parse the input stream producing a flat AST.
+ *
+ * \returns the flat module on success.
+ *
+ * \throws a parser_error on failure.
+ */
+shared_ptr<flat_module> homesim::parser::parse_flat()
+{
+    module_listener ignore;
+
+    return parse_flat(ignore);
+}
+
+/**
+ * \brief Parse the input stream producing a flat AST, announcing each node to
+ * a listener as it is parsed.
+ *
+ * \param l             The listener for parse events.
+ *
+ * \returns the flat module on success.
+ *
+ * \throws a parser_error on failure, or any exception thrown by the listener.
+ */
+shared_ptr<flat_module> homesim::parser::parse_flat(module_listener& l)
+{
+    flat = make_shared<flat_module>();
+    listener = &l;
 
     /* attempt to parse "module identifier {" */
-    SEQUENCE_BEGIN()
-        SEQ(HOMESIM_TOKEN_KEYWORD_MODULE),
-        SEQL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-            module->name = t.second;
-        SEQL_END(),
-        SEQ(HOMESIM_TOKEN_BRACE_LEFT)
-    SEQUENCE_END()
+    expect(HOMESIM_TOKEN_KEYWORD_MODULE);
+    flat->name = intern(expect(HOMESIM_TOKEN_IDENTIFIER));
+    expect(HOMESIM_TOKEN_BRACE_LEFT);
+    listener->on_module(*flat);
 
     bool done = false;
 
     /* parse each subsequence. */
     while (!done)
     {
-        CHOOSE_BEGIN()
-            OPTIONL_BEGIN(HOMESIM_TOKEN_BRACE_RIGHT,t)
+        parser_token t =
+            choose({
+                HOMESIM_TOKEN_BRACE_RIGHT,
+                HOMESIM_TOKEN_KEYWORD_IMPORT,
+                HOMESIM_TOKEN_KEYWORD_COMPONENT,
+                HOMESIM_TOKEN_KEYWORD_EXPORT,
+                HOMESIM_TOKEN_KEYWORD_WIRE,
+                HOMESIM_TOKEN_KEYWORD_SIGNAL,
+                HOMESIM_TOKEN_KEYWORD_STATE,
+                HOMESIM_TOKEN_KEYWORD_SCENARIO });
+
+        switch (t.type)
+        {
+            case HOMESIM_TOKEN_BRACE_RIGHT:
                 done = true;
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_COMPONENT,t)
-                auto component = parse_component();
-                module->component_map.insert(
-                    make_pair(component->name, component));
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_EXPORT,t)
-                auto wire = parse_export_wire();
-                module->wire_map.insert(make_pair(wire->name, wire));
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_WIRE,t)
-                auto wire = parse_wire();
-                module->wire_map.insert(make_pair(wire->name, wire));
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_SIGNAL,t)
-                auto probe = parse_probe(t.second);
-                module->probe_map.insert(make_pair(probe->name, probe));
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_STATE,t)
-                auto probe = parse_probe(t.second);
-                module->probe_map.insert(make_pair(probe->name, probe));
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_SCENARIO,t)
-                auto scenario = parse_scenario();
-                module->scenario_map.insert(
-                    make_pair(scenario->name, scenario));
-            OPTIONL_END()
-        CHOOSE_END()
+                break;
+
+            case HOMESIM_TOKEN_KEYWORD_IMPORT:
+                parse_import();
+                break;
+
+            case HOMESIM_TOKEN_KEYWORD_COMPONENT:
+                parse_component();
+                break;
+
+            case HOMESIM_TOKEN_KEYWORD_EXPORT:
+                parse_export_wire();
+                break;
+
+            case HOMESIM_TOKEN_KEYWORD_WIRE:
+                parse_wire(false);
+                break;
+
+            case HOMESIM_TOKEN_KEYWORD_SIGNAL:
+            case HOMESIM_TOKEN_KEYWORD_STATE:
+                parse_probe(t);
+                break;
+
+            default:
+                parse_scenario();
+                break;
+        }
     }
 
+    listener->on_module_end(*flat);
+
     /* success. */
+    auto module = flat;
+    flat.reset();
+    listener = nullptr;
+
     return module;
 }
 
-shared_ptr<config_ast_component> homesim::parser::parse_component()
+void homesim::parser::parse_import()
 {
-    auto component = make_shared<config_ast_component>();
+    flat->imports.push_back(intern_trimmed(expect(HOMESIM_TOKEN_STRING)));
+    listener->on_import(*flat, flat->imports.size() - 1);
+}
 
-    SEQUENCE_BEGIN()
-        SEQL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-            component->name = t.second;
-        SEQL_END(),
-        SEQ(HOMESIM_TOKEN_BRACE_LEFT)
-    SEQUENCE_END()
+void homesim::parser::parse_component()
+{
+    flat_ast_component component;
+
+    component.name = intern(expect(HOMESIM_TOKEN_IDENTIFIER));
+    component.type = -1;
+    component.first_config = flat->configs.size();
+    component.config_count = 0;
+    component.count = parse_count();
+
+    expect(HOMESIM_TOKEN_BRACE_LEFT);
 
     bool done = false;
 
     /* parse each subsequence. */
     while (!done)
     {
-        CHOOSE_BEGIN()
-            OPTIONL_BEGIN(HOMESIM_TOKEN_BRACE_RIGHT, t)
+        parser_token t =
+            choose({
+                HOMESIM_TOKEN_BRACE_RIGHT,
+                HOMESIM_TOKEN_IDENTIFIER,
+                HOMESIM_TOKEN_KEYWORD_TYPE });
+
+        switch (t.type)
+        {
+            case HOMESIM_TOKEN_BRACE_RIGHT:
                 done = true;
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-                auto assign = parse_assign(t.second);
-                handle_assignment(component, assign);
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_TYPE, t)
-                auto type = parse_type();
-                component->type = type;
-            OPTIONL_END()
-        CHOOSE_END()
+                break;
+
+            case HOMESIM_TOKEN_IDENTIFIER:
+                parse_assign(t, component);
+                break;
+
+            default:
+                component.type = parse_type();
+                break;
+        }
     }
 
-    return component;
+    flat->components.push_back(component);
+    listener->on_component(*flat, flat->components.size() - 1);
 }
 
-shared_ptr<config_ast_wire> homesim::parser::parse_export_wire()
+void homesim::parser::parse_export_wire()
 {
-    shared_ptr<config_ast_wire> wire;
+    expect(HOMESIM_TOKEN_KEYWORD_WIRE);
 
-    SEQUENCE_BEGIN()
-        SEQL_BEGIN(HOMESIM_TOKEN_KEYWORD_WIRE, t)
-            wire = parse_wire();
-            wire->exported = true;
-        SEQL_END(),
-    SEQUENCE_END()
-
-    return wire;
+    parse_wire(true);
 }
 
-shared_ptr<config_ast_wire> homesim::parser::parse_wire()
+void homesim::parser::parse_wire(bool exported)
 {
-    auto wire = make_shared<config_ast_wire>();
+    flat_ast_wire wire;
+
+    wire.name = intern(expect(HOMESIM_TOKEN_IDENTIFIER));
+    wire.exported = exported;
+    wire.external_source = false;
+    wire.first_connection = flat->connections.size();
+    wire.connection_count = 0;
+    wire.pull = -1;
+    wire.count = parse_count();
 
-    SEQUENCE_BEGIN()
-        SEQL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-            wire->name = t.second;
-        SEQL_END(),
-        SEQ(HOMESIM_TOKEN_BRACE_LEFT)
-    SEQUENCE_END()
+    /* the wire is announced before its connections, so it is added now and
+     * updated in place. */
+    int index = flat->wires.size();
+    flat->wires.push_back(wire);
+    listener->on_wire(*flat, index);
+
+    expect(HOMESIM_TOKEN_BRACE_LEFT);
 
     bool done = false;
 
     /* parse each subsequence. */
     while (!done)
     {
-        CHOOSE_BEGIN()
-            OPTIONL_BEGIN(HOMESIM_TOKEN_BRACE_RIGHT, t)
+        parser_token t =
+            choose({
+                HOMESIM_TOKEN_BRACE_RIGHT,
+                HOMESIM_TOKEN_IDENTIFIER,
+                HOMESIM_TOKEN_KEYWORD_PULLUP,
+                HOMESIM_TOKEN_KEYWORD_PULLDOWN,
+                HOMESIM_TOKEN_KEYWORD_SIGNAL });
+
+        switch (t.type)
+        {
+            case HOMESIM_TOKEN_BRACE_RIGHT:
                 done = true;
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-                auto connection = parse_connection(t.second);
-                wire->connection_list.push_back(connection);
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_PULLUP, t)
-                auto pullup = parse_pull(t.second);
-                wire->pullup_pulldown = pullup;
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_PULLDOWN, t)
-                auto pulldown = parse_pull(t.second);
-                wire->pullup_pulldown = pulldown;
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_SIGNAL, t)
+                break;
+
+            case HOMESIM_TOKEN_IDENTIFIER:
+                parse_connection(t, flat->wires[index].count);
+                ++flat->wires[index].connection_count;
+                listener->on_connection(
+                    *flat, index, flat->connections.size() - 1);
+                break;
+
+            case HOMESIM_TOKEN_KEYWORD_PULLUP:
+            case HOMESIM_TOKEN_KEYWORD_PULLDOWN:
+                flat->wires[index].pull = parse_pull(t);
+                break;
+
+            default:
                 parse_wire_signal_source();
-                wire->external_source = true;
-            OPTIONL_END()
-        CHOOSE_END()
+                flat->wires[index].external_source = true;
+                break;
+        }
     }
-
-    return wire;
 }
 
 void homesim::parser::parse_wire_signal_source()
 {
-    SEQUENCE_BEGIN()
-        SEQ(HOMESIM_TOKEN_KEYWORD_SOURCE),
-        SEQ(HOMESIM_TOKEN_KEYWORD_EXTERNAL)
-    SEQUENCE_END()
+    expect(HOMESIM_TOKEN_KEYWORD_SOURCE);
+    expect(HOMESIM_TOKEN_KEYWORD_EXTERNAL);
 }
 
-shared_ptr<config_ast_probe>
-homesim::parser::parse_probe(const string& type)
+void homesim::parser::parse_probe(const parser_token& type)
 {
-    auto probe = make_shared<config_ast_probe>();
-    probe->type = type;
+    flat_ast_probe probe;
 
-    SEQUENCE_BEGIN()
-        SEQ(HOMESIM_TOKEN_KEYWORD_PROBE),
-        SEQL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-            probe->name = t.second;
-        SEQL_END(),
-        SEQ(HOMESIM_TOKEN_BRACE_LEFT)
-    SEQUENCE_END()
+    probe.type = intern(type);
+    probe.sub_type = -1;
+    probe.first_wire_ref = flat->wire_refs.size();
+    probe.wire_ref_count = 0;
+
+    expect(HOMESIM_TOKEN_KEYWORD_PROBE);
+    probe.name = intern(expect(HOMESIM_TOKEN_IDENTIFIER));
+    expect(HOMESIM_TOKEN_BRACE_LEFT);
 
     bool done = false;
 
     /* parse each subsequence. */
     while (!done)
     {
-        CHOOSE_BEGIN()
-            OPTIONL_BEGIN(HOMESIM_TOKEN_BRACE_RIGHT, t)
+        parser_token t =
+            choose({
+                HOMESIM_TOKEN_BRACE_RIGHT,
+                HOMESIM_TOKEN_KEYWORD_TYPE,
+                HOMESIM_TOKEN_KEYWORD_WIRE });
+
+        switch (t.type)
+        {
+            case HOMESIM_TOKEN_BRACE_RIGHT:
                 done = true;
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_TYPE, t)
-                auto type = parse_type();
-                probe->sub_type = type;
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_WIRE, t)
-                auto wire_ref = parse_wire_ref();
-                probe->wire_ref_list.push_back(*wire_ref);
-            OPTIONL_END()
-        CHOOSE_END()
+                break;
+
+            case HOMESIM_TOKEN_KEYWORD_TYPE:
+                probe.sub_type = parse_type();
+                break;
+
+            default:
+                flat->wire_refs.push_back(parse_wire_ref());
+                ++probe.wire_ref_count;
+                break;
+        }
     }
 
-    return probe;
+    flat->probes.push_back(probe);
+}
+
+int homesim::parser::parse_type()
+{
+    return intern(expect(HOMESIM_TOKEN_IDENTIFIER));
 }
 
-shared_ptr<string> homesim::parser::parse_type()
+int homesim::parser::parse_wire_ref()
 {
-    string name;
+    parser_token t =
+        choose({ HOMESIM_TOKEN_IDENTIFIER, HOMESIM_TOKEN_ASTERISK });
 
-    SEQUENCE_BEGIN()
-        SEQL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-            name = t.second;
-        SEQL_END()
-    SEQUENCE_END()
+    if (HOMESIM_TOKEN_ASTERISK == t.type)
+        return intern(t);
 
-    return make_shared<string>(name);
+    return parse_element_ref(t);
 }
 
-shared_ptr<string> homesim::parser::parse_wire_ref()
+int homesim::parser::parse_element_ref(const parser_token& id)
 {
-    string ref;
+    int index = parse_element_index();
+    if (index < 0)
+        return intern(id);
 
-    CHOOSE_BEGIN()
-        OPTIONL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-            ref = t.second;
-        OPTIONL_END(),
-        OPTIONL_BEGIN(HOMESIM_TOKEN_ASTERISK, t)
-            ref = t.second;
-        OPTIONL_END()
-    CHOOSE_END()
+    /* an element of an array is named by its index, as in bus[3]. */
+    string name(id.begin, id.end);
+    name += "[";
+    name += to_string(index);
+    name += "]";
 
-    return make_shared<string>(ref);
+    return flat->symbols.intern(name);
 }
 
-shared_ptr<config_ast_assignment>
-homesim::parser::parse_assign(
-    const string& id)
+int homesim::parser::parse_element_index()
 {
-    auto assignment = make_shared<config_ast_assignment>();
-    assignment->lhs_major = id;
+    parser_token t = read();
 
-    SEQUENCE_BEGIN()
-        SEQ(HOMESIM_TOKEN_BRACKET_LEFT),
-        SEQL_BEGIN(HOMESIM_TOKEN_STRING, t)
-            assignment->lhs_minor =
-                trim_string(t.second);
-        SEQL_END(),
-        SEQ(HOMESIM_TOKEN_BRACKET_RIGHT),
-        SEQ(HOMESIM_TOKEN_ASSIGN)
-    SEQUENCE_END()
+    if (HOMESIM_TOKEN_BRACKET_LEFT != t.type)
+    {
+        put_back(t);
+        return -1;
+    }
 
-    CHOOSE_BEGIN()
-        OPTIONF(HOMESIM_TOKEN_NUMBER, simple_assignment_maker(assignment)),
-        OPTIONF(HOMESIM_TOKEN_STRING, simple_assignment_maker(assignment)),
-        OPTIONL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-            auto expression = parse_complex_expression(t.second);
-            assignment->rhs = expression;
-        OPTIONL_END()
-    CHOOSE_END()
+    int index =
+        parse_integer(expect(HOMESIM_TOKEN_NUMBER), 0, max_count - 1);
+    expect(HOMESIM_TOKEN_BRACKET_RIGHT);
 
-    return assignment;
+    return index;
 }
 
-shared_ptr<config_ast_assignment>
-homesim::parser::parse_pin_assign(
-    const string& id)
+int homesim::parser::parse_count()
 {
-    auto assignment = make_shared<config_ast_assignment>();
-    assignment->lhs_major = id;
+    parser_token t = read();
 
-    SEQUENCE_BEGIN()
-        SEQ(HOMESIM_TOKEN_DOT),
-        SEQ(HOMESIM_TOKEN_KEYWORD_PIN),
-        SEQ(HOMESIM_TOKEN_BRACKET_LEFT),
-        SEQL_BEGIN(HOMESIM_TOKEN_STRING, t)
-            assignment->lhs_minor =
-                trim_string(t.second);
-        SEQL_END(),
-        SEQ(HOMESIM_TOKEN_BRACKET_RIGHT),
-        SEQ(HOMESIM_TOKEN_ASSIGN)
-    SEQUENCE_END()
+    if (HOMESIM_TOKEN_BRACKET_LEFT != t.type)
+    {
+        put_back(t);
+        return 0;
+    }
 
-    CHOOSE_BEGIN()
-        OPTIONF(
-            HOMESIM_TOKEN_KEYWORD_TRUE,
-            simple_assignment_maker(assignment)),
-        OPTIONF(
-            HOMESIM_TOKEN_KEYWORD_FALSE,
-            simple_assignment_maker(assignment)),
-    CHOOSE_END()
+    int count = parse_integer(expect(HOMESIM_TOKEN_NUMBER), 1, max_count);
+    expect(HOMESIM_TOKEN_BRACKET_RIGHT);
 
-    return assignment;
+    return count;
 }
 
-void homesim::parser::handle_assignment(
-    shared_ptr<config_ast_component> component,
-    shared_ptr<config_ast_assignment> assignment)
+void homesim::parser::parse_range(int& first, int& last)
+{
+    parser_token t = read();
+
+    if (HOMESIM_TOKEN_BRACKET_LEFT != t.type)
+    {
+        put_back(t);
+        first = last = -1;
+        return;
+    }
+
+    first = last =
+        parse_integer(expect(HOMESIM_TOKEN_NUMBER), 0, max_count - 1);
+
+    t = choose({ HOMESIM_TOKEN_COLON, HOMESIM_TOKEN_BRACKET_RIGHT });
+    if (HOMESIM_TOKEN_COLON == t.type)
+    {
+        last =
+            parse_integer(expect(HOMESIM_TOKEN_NUMBER), 0, max_count - 1);
+        expect(HOMESIM_TOKEN_BRACKET_RIGHT);
+    }
+}
+
+int homesim::parser::parse_integer(
+    const parser_token& t, int min, int max)
 {
-    if ("config" == assignment->lhs_major)
+    int value = -1;
+    auto res = from_chars(t.begin, t.end, value);
+
+    if (res.ec != errc() || res.ptr != t.end || value < min
+     || value > max)
     {
-        component->config_map.insert(
-            make_pair(assignment->lhs_minor, assignment->rhs));
+        throw error_at(
+            string("Invalid ") + (min > 0 ? "count " : "index ")
+          + string(t.begin, t.end) + ".");
     }
+
+    return value;
+}
+
+void homesim::parser::parse_assign(
+    const parser_token& id, flat_ast_component& component)
+{
+    static const string config = "config";
+
+    expect(HOMESIM_TOKEN_BRACKET_LEFT);
+    int key = intern_trimmed(expect(HOMESIM_TOKEN_STRING));
+    expect(HOMESIM_TOKEN_BRACKET_RIGHT);
+    expect(HOMESIM_TOKEN_ASSIGN);
+
+    parser_token t =
+        choose({
+            HOMESIM_TOKEN_NUMBER,
+            HOMESIM_TOKEN_STRING,
+            HOMESIM_TOKEN_IDENTIFIER });
+
+    int expression;
+    if (HOMESIM_TOKEN_IDENTIFIER == t.type)
+        expression = parse_complex_expression(t);
+    else
+        expression = simple_expression(t);
+
     /* TODO - add warning if a different assignment lhs is used. */
+    if (config.compare(0, string::npos, id.begin, id.end - id.begin) == 0)
+        handle_assignment(component, key, expression);
 }
 
-shared_ptr<config_ast_connection>
-homesim::parser::parse_connection(const string& id)
+void homesim::parser::parse_pin_assign(const parser_token& id)
 {
-    auto connection = make_shared<config_ast_connection>();
-    connection->component = id;
+    flat_ast_pin_assignment assignment;
+
+    /* the element is kept apart from the name, as in a connection. */
+    assignment.component = intern(id);
+    assignment.element = parse_element_index();
+
+    expect(HOMESIM_TOKEN_DOT);
+    expect(HOMESIM_TOKEN_KEYWORD_PIN);
+    expect(HOMESIM_TOKEN_BRACKET_LEFT);
+    assignment.pin = intern_trimmed(expect(HOMESIM_TOKEN_STRING));
+    expect(HOMESIM_TOKEN_BRACKET_RIGHT);
+    expect(HOMESIM_TOKEN_ASSIGN);
+
+    assignment.expression =
+        simple_expression(
+            choose({
+                HOMESIM_TOKEN_KEYWORD_TRUE,
+                HOMESIM_TOKEN_KEYWORD_FALSE }));
+
+    flat->pin_assignments.push_back(assignment);
+}
 
-    SEQUENCE_BEGIN()
-        SEQ(HOMESIM_TOKEN_DOT),
-        SEQ(HOMESIM_TOKEN_KEYWORD_PIN),
-        SEQ(HOMESIM_TOKEN_BRACKET_LEFT),
-        SEQL_BEGIN(HOMESIM_TOKEN_STRING, t)
-            connection->pin =
-                trim_string(t.second);
-        SEQL_END(),
-        SEQ(HOMESIM_TOKEN_BRACKET_RIGHT)
-    SEQUENCE_END()
+void homesim::parser::handle_assignment(
+    flat_ast_component& component, int key, int expression)
+{
+    /* the first assignment to a key wins. */
+    for (int i = 0; i < component.config_count; ++i)
+    {
+        if (key == flat->configs[component.first_config + i].key)
+            return;
+    }
+
+    flat->configs.push_back(flat_ast_config{ key, expression });
+    ++component.config_count;
+}
+
+void homesim::parser::parse_connection(const parser_token& id, int count)
+{
+    flat_ast_connection connection;
+
+    connection.component = intern(id);
+    parse_range(connection.first, connection.last);
+
+    expect(HOMESIM_TOKEN_DOT);
+    expect(HOMESIM_TOKEN_KEYWORD_PIN);
+    expect(HOMESIM_TOKEN_BRACKET_LEFT);
+    connection.pin = intern_trimmed(expect(HOMESIM_TOKEN_STRING));
+    expect(HOMESIM_TOKEN_BRACKET_RIGHT);
+    parse_range(connection.pin_first, connection.pin_last);
+
+    int width = abs(connection.last - connection.first) + 1;
+    int pin_width = abs(connection.pin_last - connection.pin_first) + 1;
+
+    /* a ranged component and a ranged pin must agree. */
+    if (width > 1 && pin_width > 1 && width != pin_width)
+    {
+        throw error_at(
+            "Component range width " + to_string(width)
+          + " does not match pin range width " + to_string(pin_width) + ".");
+    }
+
+    /* a wire array is bound element by element. */
+    width = max(width, pin_width);
+    if (count > 0 && width != count)
+    {
+        throw error_at(
+            "Connection width " + to_string(width)
+          + " does not match wire width " + to_string(count) + ".");
+    }
 
-    return connection;
+    flat->connections.push_back(connection);
 }
 
-string homesim::parser::trim_string(const string& str)
+parser_error homesim::parser::error_at(const string& message)
 {
-    return string(str.begin()+1, str.end()-1);
+    stringstream sout;
+    int sl, sc, el, ec;
+    in.read_linecol(sl, sc, el, ec);
+
+    sout << "Error at " << sl << ":" << sc << ": " << message;
+
+    return parser_error(sout.str());
 }
 
-shared_ptr<function<void(const token_pair&)>>
-homesim::parser::simple_assignment_maker(
-    shared_ptr<config_ast_assignment> assignment)
+int homesim::parser::intern(const parser_token& t)
 {
-    return
-        make_shared<function<void(const token_pair&)>>(
-            [=](const token_pair& t) {
-                auto assign =
-                    make_shared<config_ast_simple_expression>();
-                assign->simple_value = t.second;
-                assign->ty = t.first;
-                assignment->rhs = assign;
-            });
+    return flat->symbols.intern(t.begin, t.end);
 }
 
-shared_ptr<config_ast_expression>
-homesim::parser::parse_complex_expression(const string& id)
+int homesim::parser::intern_trimmed(const parser_token& t)
 {
-    shared_ptr<config_ast_expression> expr;
+    return flat->symbols.intern(t.begin + 1, t.end - 1);
+}
 
-    CHOOSE_BEGIN()
-        OPTIONL_BEGIN(HOMESIM_TOKEN_BRACE_LEFT, t)
-            /* we're looking ahead, so save the token. */
-            put_back(t);
+int homesim::parser::simple_expression(const parser_token& t)
+{
+    return add_expression(t.type, intern(t), -1);
+}
+
+int homesim::parser::add_expression(token ty, int value, int functor)
+{
+    flat_ast_expression expr{ ty, value, functor, CONFIG_VALUE_NUMBER, 0, 0 };
+
+    /* fold the expression now, so that it is never reparsed. */
+    try
+    {
+        fold_expression(flat->symbols, expr);
+    }
+    catch (config_value_error& e)
+    {
+        throw error_at(e.what());
+    }
+
+    flat->expressions.push_back(expr);
+
+    return flat->expressions.size() - 1;
+}
+
+int homesim::parser::parse_complex_expression(const parser_token& id)
+{
+    parser_token t =
+        choose({
+            HOMESIM_TOKEN_BRACE_LEFT,
+            HOMESIM_TOKEN_BRACE_RIGHT,
+            HOMESIM_TOKEN_PAREN_LEFT });
 
-            /* this is an identifier. */
-            auto assign =
-                make_shared<config_ast_simple_expression>();
-            assign->simple_value = id;
-            assign->ty = HOMESIM_TOKEN_IDENTIFIER;
-            expr = assign;
-        OPTIONL_END(),
-        OPTIONL_BEGIN(HOMESIM_TOKEN_BRACE_RIGHT, t)
-            /* we're looking ahead, so save the token. */
-            put_back(t);
+    if (HOMESIM_TOKEN_PAREN_LEFT == t.type)
+        return parse_inner_expression(id);
 
-            /* this is an identifier. */
-            auto assign =
-                make_shared<config_ast_simple_expression>();
-            assign->simple_value = id;
-            assign->ty = HOMESIM_TOKEN_IDENTIFIER;
-            expr = assign;
-        OPTIONL_END(),
-        OPTIONL_BEGIN(HOMESIM_TOKEN_PAREN_LEFT, t)
-            auto result =
-                 parse_inner_expression(id);
-            expr = result;
-        OPTIONL_END()
-    CHOOSE_END()
+    /* we're looking ahead, so save the token. */
+    put_back(t);
 
-    return expr;
+    /* this is an identifier. */
+    return add_expression(HOMESIM_TOKEN_IDENTIFIER, intern(id), -1);
 }
 
-shared_ptr<config_ast_expression>
-homesim::parser::parse_inner_expression(const string& id)
+int homesim::parser::parse_inner_expression(const parser_token& id)
 {
-    shared_ptr<config_ast_expression> expr;
+    /* this is a complex expression involving a number. */
+    parser_token t = choose({ HOMESIM_TOKEN_NUMBER });
 
-    CHOOSE_BEGIN()
-        OPTIONL_BEGIN(HOMESIM_TOKEN_NUMBER, t)
-            /* this is a complex expression involving a number. */
-            auto assign =
-                make_shared<config_ast_complex_expression>();
-            assign->functor = id;
-            assign->args.push_back(t);
-            expr = assign;
-        OPTIONL_END()
-    CHOOSE_END()
+    int expression = add_expression(t.type, intern(t), intern(id));
 
-    SEQUENCE_BEGIN()
-        SEQ(HOMESIM_TOKEN_PAREN_RIGHT)
-    SEQUENCE_END()
+    expect(HOMESIM_TOKEN_PAREN_RIGHT);
 
-    return expr;
+    return expression;
 }
 
-shared_ptr<config_ast_component>
-homesim::parser::parse_pull(const string& type)
-{
-    auto component = make_shared<config_ast_component>();
-    component->type = make_shared<string>(type);
-
-    SEQUENCE_BEGIN()
-        SEQ(HOMESIM_TOKEN_BRACE_LEFT)
-    SEQUENCE_END()
+int homesim::parser::parse_pull(const parser_token& type)
+{
+    flat_ast_component component;
+
+    component.name = -1;
+    component.type = intern(type);
+    component.first_config = flat->configs.size();
+    component.config_count = 0;
+    component.count = 0;
+
+    expect(HOMESIM_TOKEN_BRACE_LEFT);
 
     bool done = false;
 
     /* parse each subsequence. */
     while (!done)
     {
-        CHOOSE_BEGIN()
-            OPTIONL_BEGIN(HOMESIM_TOKEN_BRACE_RIGHT, t)
-                done = true;
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-                auto assign = parse_assign(t.second);
-                handle_assignment(component, assign);
-            OPTIONL_END(),
-        CHOOSE_END()
+        parser_token t =
+            choose({ HOMESIM_TOKEN_BRACE_RIGHT, HOMESIM_TOKEN_IDENTIFIER });
+
+        if (HOMESIM_TOKEN_BRACE_RIGHT == t.type)
+            done = true;
+        else
+            parse_assign(t, component);
     }
 
-    return component;
+    flat->pulls.push_back(component);
+
+    return flat->pulls.size() - 1;
 }
 
-shared_ptr<config_ast_scenario> homesim::parser::parse_scenario()
+void homesim::parser::parse_scenario()
 {
-    auto scenario = make_shared<config_ast_scenario>();
+    flat_ast_scenario scenario;
+
+    scenario.name = intern(expect(HOMESIM_TOKEN_IDENTIFIER));
+    scenario.first_execution = flat->executions.size();
+    scenario.execution_count = 0;
 
-    SEQUENCE_BEGIN()
-        SEQL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-                    scenario->name = t.second;
-        SEQL_END(),
-        SEQ(HOMESIM_TOKEN_BRACE_LEFT)
-    SEQUENCE_END()
+    expect(HOMESIM_TOKEN_BRACE_LEFT);
 
     bool done = false;
 
     /* parse each subsequence. */
     while (!done)
     {
-        CHOOSE_BEGIN()
-            OPTIONL_BEGIN(HOMESIM_TOKEN_BRACE_RIGHT, t)
-                done = true;
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_EXECUTION, t)
-                auto execution = parse_execution();
-                scenario->execution_map.insert(
-                    make_pair(execution->name, execution));
-            OPTIONL_END()
-        CHOOSE_END()
+        parser_token t =
+            choose({
+                HOMESIM_TOKEN_BRACE_RIGHT,
+                HOMESIM_TOKEN_KEYWORD_EXECUTION });
+
+        if (HOMESIM_TOKEN_BRACE_RIGHT == t.type)
+        {
+            done = true;
+        }
+        else
+        {
+            parse_execution();
+            ++scenario.execution_count;
+        }
     }
 
-    return scenario;
+    flat->scenarios.push_back(scenario);
 }
 
-shared_ptr<config_ast_execution> homesim::parser::parse_execution()
+void homesim::parser::parse_execution()
 {
-    auto execution = make_shared<config_ast_execution>();
+    flat_ast_execution execution;
+
+    execution.name =
+        intern(choose({ HOMESIM_TOKEN_IDENTIFIER, HOMESIM_TOKEN_NUMBER }));
+    execution.first_step = flat->steps.size();
 
-    CHOOSE_BEGIN()
-        OPTIONL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-            execution->name = t.second;
-        OPTIONL_END(),
-        OPTIONL_BEGIN(HOMESIM_TOKEN_NUMBER, t)
-            execution->name = t.second;
-        OPTIONL_END(),
-    CHOOSE_END()
+    parse_step_block();
 
+    execution.step_count = flat->steps.size() - execution.first_step;
+    flat->executions.push_back(execution);
+}
+
+void homesim::parser::parse_step_block()
+{
     /* parse the left brace. */
-    SEQUENCE_BEGIN()
-        SEQ(HOMESIM_TOKEN_BRACE_LEFT)
-    SEQUENCE_END()
+    expect(HOMESIM_TOKEN_BRACE_LEFT);
 
     bool done = false;
 
     /* parse each subsequence. */
     while (!done)
     {
-        CHOOSE_BEGIN()
-            OPTIONL_BEGIN(HOMESIM_TOKEN_BRACE_RIGHT, t)
+        parser_token t =
+            choose({
+                HOMESIM_TOKEN_BRACE_RIGHT,
+                HOMESIM_TOKEN_KEYWORD_AT,
+                HOMESIM_TOKEN_KEYWORD_AFTER,
+                HOMESIM_TOKEN_KEYWORD_REPEAT });
+
+        switch (t.type)
+        {
+            case HOMESIM_TOKEN_BRACE_RIGHT:
                 done = true;
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_AT, t)
-                auto step = parse_step(t.second);
-                execution->step_list.push_back(step);
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_AFTER, t)
-                auto step = parse_step(t.second);
-                execution->step_list.push_back(step);
-            OPTIONL_END(),
-        CHOOSE_END()
+                break;
+
+            case HOMESIM_TOKEN_KEYWORD_REPEAT:
+                parse_repeat(t);
+                break;
+
+            default:
+                parse_step(t);
+                break;
+        }
     }
+}
+
+void homesim::parser::parse_repeat(const parser_token& type)
+{
+    flat_ast_step step;
 
-    return execution;
+    step.type = intern(type);
+    step.first_pin_assignment = flat->pin_assignments.size();
+    step.pin_assignment_count = 0;
+    step.first_assertion = flat->assertions.size();
+    step.assertion_count = 0;
+    step.body_count = 0;
+
+    parser_token count = expect(HOMESIM_TOKEN_NUMBER);
+    parse_integer(count, 1, numeric_limits<int>::max());
+    step.expression = simple_expression(count);
+
+    /* the body follows the repeat step, so it is added now and updated in
+     * place. */
+    int index = flat->steps.size();
+    flat->steps.push_back(step);
+
+    parse_step_block();
+
+    flat->steps[index].body_count = flat->steps.size() - index - 1;
 }
 
-shared_ptr<config_ast_step>
-homesim::parser::parse_step(const std::string& type)
+void homesim::parser::parse_step(const parser_token& type)
 {
-    auto step = make_shared<config_ast_step>();
-    step->type = type;
+    flat_ast_step step;
+
+    step.type = intern(type);
+    step.first_pin_assignment = flat->pin_assignments.size();
+    step.pin_assignment_count = 0;
+    step.first_assertion = flat->assertions.size();
+    step.assertion_count = 0;
+    step.body_count = 0;
 
-    CHOOSE_BEGIN()
-        OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_START, t)
-            auto expression = make_shared<config_ast_simple_expression>();
-            expression->ty = HOMESIM_TOKEN_NUMBER;
-            expression->simple_value = "0";
-            step->step_expression = expression;
-        OPTIONL_END(),
-        OPTIONL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-            auto expression = parse_complex_expression(t.second);
-            step->step_expression = expression;
-        OPTIONL_END()
-    CHOOSE_END()
+    parser_token t =
+        choose({ HOMESIM_TOKEN_KEYWORD_START, HOMESIM_TOKEN_IDENTIFIER });
+
+    if (HOMESIM_TOKEN_KEYWORD_START == t.type)
+    {
+        step.expression =
+            add_expression(
+                HOMESIM_TOKEN_NUMBER, flat->symbols.intern("0"), -1);
+    }
+    else
+    {
+        step.expression = parse_complex_expression(t);
+    }
 
     /* parse the left brace. */
-    SEQUENCE_BEGIN()
-        SEQ(HOMESIM_TOKEN_BRACE_LEFT)
-    SEQUENCE_END()
+    expect(HOMESIM_TOKEN_BRACE_LEFT);
 
     bool done = false;
 
     /* parse each subsequence. */
     while (!done)
     {
-        CHOOSE_BEGIN()
-            OPTIONL_BEGIN(HOMESIM_TOKEN_BRACE_RIGHT, t)
+        t = choose({
+                HOMESIM_TOKEN_BRACE_RIGHT,
+                HOMESIM_TOKEN_IDENTIFIER,
+                HOMESIM_TOKEN_KEYWORD_ASSERT,
+                HOMESIM_TOKEN_KEYWORD_EXPECT });
+
+        switch (t.type)
+        {
+            case HOMESIM_TOKEN_BRACE_RIGHT:
                 done = true;
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-                auto assign = parse_pin_assign(t.second);
-                step->pin_assignments.push_back(assign);
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_ASSERT, t)
-                auto assert = parse_assertion(t.second);
-                step->assertion_list.push_back(assert);
-            OPTIONL_END(),
-            OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_EXPECT, t)
-                auto assert = parse_assertion(t.second);
-                step->assertion_list.push_back(assert);
-            OPTIONL_END(),
-        CHOOSE_END()
+                break;
+
+            case HOMESIM_TOKEN_IDENTIFIER:
+                parse_pin_assign(t);
+                ++step.pin_assignment_count;
+                break;
+
+            default:
+                parse_assertion(t);
+                ++step.assertion_count;
+                break;
+        }
     }
 
-    return step;
-}
-
-shared_ptr<config_ast_assertion>
-homesim::parser::parse_assertion(
-    const string& type)
-{
-    auto assertion = make_shared<config_ast_assertion>();
-    assertion->type = type;
-
-    SEQUENCE_BEGIN()
-        SEQ(HOMESIM_TOKEN_KEYWORD_WIRE),
-        SEQ(HOMESIM_TOKEN_DOT),
-        SEQL_BEGIN(HOMESIM_TOKEN_IDENTIFIER, t)
-            assertion->lhs.push_back(t.second);
-        SEQL_END(),
-        SEQ(HOMESIM_TOKEN_DOT),
-        SEQ(HOMESIM_TOKEN_KEYWORD_SIGNAL),
-        SEQ(HOMESIM_TOKEN_EQUALS),
-    SEQUENCE_END()
-
-    CHOOSE_BEGIN()
-        OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_TRUE, t)
-            auto expr = make_shared<config_ast_simple_expression>();
-            expr->simple_value = t.second;
-            expr->ty = t.first;
-            assertion->rhs = expr;
-        OPTIONL_END(),
-        OPTIONL_BEGIN(HOMESIM_TOKEN_KEYWORD_FALSE, t)
-            auto expr = make_shared<config_ast_simple_expression>();
-            expr->simple_value = t.second;
-            expr->ty = t.first;
-            assertion->rhs = expr;
-        OPTIONL_END(),
-    CHOOSE_END()
-
-    return assertion;
+    flat->steps.push_back(step);
+}
+
+void homesim::parser::parse_assertion(const parser_token& type)
+{
+    flat_ast_assertion assertion;
+
+    assertion.type = intern(type);
+
+    expect(HOMESIM_TOKEN_KEYWORD_WIRE);
+    expect(HOMESIM_TOKEN_DOT);
+    assertion.wire = intern(expect(HOMESIM_TOKEN_IDENTIFIER));
+    assertion.element = parse_element_index();
+    expect(HOMESIM_TOKEN_DOT);
+    expect(HOMESIM_TOKEN_KEYWORD_SIGNAL);
+    expect(HOMESIM_TOKEN_EQUALS);
+
+    assertion.expression =
+        simple_expression(
+            choose({
+                HOMESIM_TOKEN_KEYWORD_TRUE,
+                HOMESIM_TOKEN_KEYWORD_FALSE }));
+
+    flat->assertions.push_back(assertion);
 }
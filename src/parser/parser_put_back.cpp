@@ -12,7 +12,10 @@ using namespace homesim;
 using namespace std;
 
 void
-homesim::parser::put_back(const token_pair& t)
+homesim::parser::put_back(const parser_token& t)
 {
-    lookahead.push_front(t);
+    if (lookahead_count == lookahead_max)
+        throw parser_error("Parser lookahead exceeded.");
+
+    lookahead[lookahead_count++] = t;
 }
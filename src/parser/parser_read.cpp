@@ -1,7 +1,7 @@
 /**
  * \file parser/parser_read.cpp
  *
- * \brief Read a token pair from either the stream or the lookahead.
+ * \brief Read a token from either the lexer or the lookahead.
  *
  * \copyright Copyright 2020 Justin Handville. All rights reserved.
  */
@@ -11,22 +11,17 @@
 using namespace homesim;
 using namespace std;
 
-token_pair
+parser::parser_token
 homesim::parser::read()
 {
-    token_pair ret;
+    if (lookahead_count > 0)
+        return lookahead[--lookahead_count];
 
-    if (lookahead.size() > 0)
-    {
-        ret = lookahead.front();
-        lookahead.pop_front();
-    }
-    else
-    {
-        ret.first = in.read();
-        if (HOMESIM_TOKEN_EOF != ret.first)
-            ret.second = in.get_token_string();
-    }
+    parser_token ret;
+    ret.type = in.read();
+    auto text = in.get_token_view();
+    ret.begin = text.data();
+    ret.end = text.data() + text.size();
 
     return ret;
 }
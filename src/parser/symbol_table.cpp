@@ -0,0 +1,24 @@
+/**
+ * \file parser/symbol_table.cpp
+ *
+ * \brief Symbol table constructor.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief The initial number of hash slots; always a power of two.
+ */
+static const size_t symbol_table_initial_slots = 64;
+
+/**
+ * \brief Create an empty symbol table.
+ */
+homesim::symbol_table::symbol_table()
+    : slots(symbol_table_initial_slots, -1)
+{
+}
@@ -0,0 +1,25 @@
+/**
+ * \file parser/symbol_table_find.cpp
+ *
+ * \brief Find a name in the symbol table.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Find the id of a name, without interning it.
+ *
+ * \param name          The name to find.
+ *
+ * \returns the id of the name, or -1 if it has not been interned.
+ */
+int homesim::symbol_table::find(const string& name) const
+{
+    size_t h = hash(name.data(), name.size());
+
+    return slots[lookup(name.data(), name.size(), h)];
+}
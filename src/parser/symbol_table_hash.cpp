@@ -0,0 +1,33 @@
+/**
+ * \file parser/symbol_table_hash.cpp
+ *
+ * \brief Hash a name for the symbol table.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <cstdint>
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Hash a name with FNV-1a.
+ *
+ * \param name          The start of the name.
+ * \param length        The length of the name.
+ *
+ * \returns the hash of the name.
+ */
+size_t homesim::symbol_table::hash(const char* name, size_t length)
+{
+    uint32_t h = 2166136261u;
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        h ^= (unsigned char)name[i];
+        h *= 16777619u;
+    }
+
+    return h;
+}
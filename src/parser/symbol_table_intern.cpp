@@ -0,0 +1,53 @@
+/**
+ * \file parser/symbol_table_intern.cpp
+ *
+ * \brief Intern a name in the symbol table.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Intern the given name.
+ *
+ * \param begin         The start of the name.
+ * \param end           One past the end of the name.
+ *
+ * \returns the id of the name.
+ */
+int homesim::symbol_table::intern(const char* begin, const char* end)
+{
+    size_t length = end - begin;
+    size_t h = hash(begin, length);
+    int slot = lookup(begin, length, h);
+
+    if (slots[slot] >= 0)
+        return slots[slot];
+
+    int id = offsets.size();
+    offsets.push_back(pool.size());
+    lengths.push_back(length);
+    pool.insert(pool.end(), begin, end);
+    slots[slot] = id;
+
+    /* keep the slots at most half full. */
+    if (offsets.size() * 2 > slots.size())
+        rehash();
+
+    return id;
+}
+
+/**
+ * \brief Intern the given name.
+ *
+ * \param name          The name to intern.
+ *
+ * \returns the id of the name.
+ */
+int homesim::symbol_table::intern(const string& name)
+{
+    return intern(name.data(), name.data() + name.size());
+}
@@ -0,0 +1,40 @@
+/**
+ * \file parser/symbol_table_lookup.cpp
+ *
+ * \brief Look up the hash slot of a name.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <cstring>
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Look up the slot for a name with linear probing.
+ *
+ * \param name          The start of the name.
+ * \param length        The length of the name.
+ * \param h             The hash of the name.
+ *
+ * \returns the slot holding the name, or the empty slot where it belongs.
+ */
+int homesim::symbol_table::lookup(
+    const char* name, size_t length, size_t h) const
+{
+    size_t mask = slots.size() - 1;
+
+    for (size_t i = h & mask; ; i = (i + 1) & mask)
+    {
+        int id = slots[i];
+
+        if (id < 0)
+            return i;
+
+        if (lengths[id] == length
+         && (0 == length
+          || !memcmp(pool.data() + offsets[id], name, length)))
+            return i;
+    }
+}
@@ -0,0 +1,26 @@
+/**
+ * \file parser/symbol_table_rehash.cpp
+ *
+ * \brief Grow the symbol table hash slots.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Double the number of hash slots and reinsert every name.
+ */
+void homesim::symbol_table::rehash()
+{
+    slots.assign(slots.size() * 2, -1);
+
+    for (size_t id = 0; id < offsets.size(); ++id)
+    {
+        const char* name = pool.data() + offsets[id];
+
+        slots[lookup(name, lengths[id], hash(name, lengths[id]))] = id;
+    }
+}
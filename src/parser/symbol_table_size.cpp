@@ -0,0 +1,19 @@
+/**
+ * \file parser/symbol_table_size.cpp
+ *
+ * \brief Get the number of interned names.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the number of interned names.
+ */
+int homesim::symbol_table::size() const
+{
+    return offsets.size();
+}
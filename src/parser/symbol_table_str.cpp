@@ -0,0 +1,23 @@
+/**
+ * \file parser/symbol_table_str.cpp
+ *
+ * \brief Get the name for a symbol id.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/flat_ast.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the name for the given id.
+ *
+ * \param id            The id of the name.
+ *
+ * \returns the name.
+ */
+string homesim::symbol_table::str(int id) const
+{
+    return string(pool.data() + offsets[id], lengths[id]);
+}
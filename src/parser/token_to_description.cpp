@@ -27,6 +27,7 @@ string homesim::token_to_description(token t)
         case HOMESIM_TOKEN_BRACE_RIGHT:             return "}";
         case HOMESIM_TOKEN_BRACKET_LEFT:            return "[";
         case HOMESIM_TOKEN_BRACKET_RIGHT:           return "]";
+        case HOMESIM_TOKEN_COLON:                   return ":";
         case HOMESIM_TOKEN_DOT:                     return ".";
         case HOMESIM_TOKEN_EQUALS:                  return "=";
         case HOMESIM_TOKEN_IDENTIFIER:              return "identifier";
@@ -38,11 +39,13 @@ string homesim::token_to_description(token t)
         case HOMESIM_TOKEN_KEYWORD_EXECUTION:       return "execution";
         case HOMESIM_TOKEN_KEYWORD_EXPECT:          return "expect";
         case HOMESIM_TOKEN_KEYWORD_FALSE:           return "false";
+        case HOMESIM_TOKEN_KEYWORD_IMPORT:          return "import";
         case HOMESIM_TOKEN_KEYWORD_MODULE:          return "module";
         case HOMESIM_TOKEN_KEYWORD_PIN:             return "pin";
         case HOMESIM_TOKEN_KEYWORD_PROBE:           return "probe";
         case HOMESIM_TOKEN_KEYWORD_PULLDOWN:        return "pulldown";
         case HOMESIM_TOKEN_KEYWORD_PULLUP:          return "pullup";
+        case HOMESIM_TOKEN_KEYWORD_REPEAT:          return "repeat";
         case HOMESIM_TOKEN_KEYWORD_SCENARIO:        return "scenario";
         case HOMESIM_TOKEN_KEYWORD_SIGNAL:          return "signal";
         case HOMESIM_TOKEN_KEYWORD_START:           return "start";
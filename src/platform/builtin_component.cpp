@@ -0,0 +1,25 @@
+/**
+ * \file platform/builtin_component.cpp
+ *
+ * \brief Built-in component constructor.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include "builtin_components.h"
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Constructor for a built-in component.
+ *
+ * \param table     The pin table for this part.
+ * \param delay     The default delay for this part.
+ */
+homesim::builtin_component::builtin_component(
+    const component_pin_table& table, double delay)
+        : component(table)
+        , delay(delay)
+        , built(false)
+{
+}
@@ -0,0 +1,40 @@
+/**
+ * \file platform/builtin_component_configure.cpp
+ *
+ * \brief Configure a built-in component.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include "builtin_components.h"
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Configure this component.
+ *
+ * \param key       The configuration key.
+ * \param value     The evaluated configuration value.
+ *
+ * \throws \ref invalid_config_error if the key or value is invalid.
+ */
+void homesim::builtin_component::configure(
+    const string& key, const string& value)
+{
+    /* the only common configuration is the propagation delay. */
+    if (key != "propagation_delay")
+    {
+        component::configure(key, value);
+        return;
+    }
+
+    double d;
+
+    /* the delay must be a non-negative number of seconds. */
+    if (!config_parse_number(value.data(), value.data() + value.size(), d)
+     || d < 0.0)
+        throw invalid_config_error(
+            string("Config ") + key + " must be a delay in seconds.");
+
+    delay = d;
+}
@@ -0,0 +1,37 @@
+/**
+ * \file platform/builtin_component_configure_value.cpp
+ *
+ * \brief Configure a built-in component with a typed value.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include "builtin_components.h"
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Configure this component with a typed value.
+ *
+ * \param key       The configuration key.
+ * \param value     The folded configuration value.
+ *
+ * \throws \ref invalid_config_error if the key or value is invalid.
+ */
+void homesim::builtin_component::configure(
+    const string& key, const config_value& value)
+{
+    if (key != "propagation_delay")
+    {
+        component::configure(key, value);
+        return;
+    }
+
+    /* the delay must be a non-negative time, or number of seconds. */
+    if ((CONFIG_VALUE_TIME != value.type && CONFIG_VALUE_NUMBER != value.type)
+     || value.seconds() < 0.0)
+        throw invalid_config_error(
+            string("Config ") + key + " must be a delay in seconds.");
+
+    delay = value.seconds();
+}
@@ -0,0 +1,211 @@
+/**
+ * \file builtin_components.h
+ *
+ * \brief Component wrappers for the built-in parts.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#pragma once
+
+#include <homesim/component.h>
+#include <homesim/ic/74173.h>
+#include <homesim/ic/74245.h>
+#include <homesim/ic/ram.h>
+#include <homesim/ic/rom.h>
+#include <memory>
+#include <string>
+
+namespace homesim
+{
+
+/**
+ * \brief Base class for built-in parts, which all accept a propagation delay.
+ */
+class builtin_component : public component
+{
+public:
+
+    /**
+     * \brief Configure this component.
+     *
+     * \param key       The configuration key.
+     * \param value     The evaluated configuration value.
+     *
+     * \throws \ref invalid_config_error if the key or value is invalid.
+     */
+    virtual void configure(
+        const std::string& key, const std::string& value) override;
+
+    /**
+     * \brief Configure this component with a typed value.
+     *
+     * \param key       The configuration key.
+     * \param value     The folded configuration value.
+     *
+     * \throws \ref invalid_config_error if the key or value is invalid.
+     */
+    virtual void configure(
+        const std::string& key, const config_value& value) override;
+
+protected:
+
+    /**
+     * \brief Constructor for a built-in component.
+     *
+     * \param table     The pin table for this part.
+     * \param delay     The default delay for this part.
+     */
+    builtin_component(const component_pin_table& table, double delay);
+
+    double delay;
+    bool built;
+};
+
+/**
+ * \brief A built-in two input gate, with pins a, b, and y.
+ */
+template <typename gate_type>
+class builtin_gate : public builtin_component
+{
+public:
+
+    builtin_gate(const component_pin_table& table, double delay)
+        : builtin_component(table, delay)
+    {
+    }
+
+    virtual void build() override
+    {
+        if (built)
+            return;
+
+        gate = std::make_unique<gate_type>(
+            get_wire(0), get_wire(1), get_wire(2), delay);
+        built = true;
+    }
+
+private:
+    std::unique_ptr<gate_type> gate;
+};
+
+/**
+ * \brief A built-in single input gate, with pins a and y.
+ */
+template <typename gate_type>
+class builtin_unary_gate : public builtin_component
+{
+public:
+
+    builtin_unary_gate(const component_pin_table& table, double delay)
+        : builtin_component(table, delay)
+    {
+    }
+
+    virtual void build() override
+    {
+        if (built)
+            return;
+
+        gate = std::make_unique<gate_type>(get_wire(0), get_wire(1), delay);
+        built = true;
+    }
+
+private:
+    std::unique_ptr<gate_type> gate;
+};
+
+/**
+ * \brief A built-in 14 pin DIP part, with its twelve signal pins in package
+ * order.
+ */
+template <typename ic_type>
+class builtin_dip14 : public builtin_component
+{
+public:
+
+    builtin_dip14(const component_pin_table& table, double delay)
+        : builtin_component(table, delay)
+    {
+    }
+
+    virtual void build() override
+    {
+        if (built)
+            return;
+
+        ic = std::make_unique<ic_type>(
+            get_wire(0), get_wire(1), get_wire(2), get_wire(3), get_wire(4),
+            get_wire(5), get_wire(6), get_wire(7), get_wire(8), get_wire(9),
+            get_wire(10), get_wire(11), delay);
+        built = true;
+    }
+
+private:
+    std::unique_ptr<ic_type> ic;
+};
+
+/**
+ * \brief The built-in 74173 Quad D-type Register.
+ */
+class builtin_ic74173 : public builtin_component
+{
+public:
+
+    builtin_ic74173();
+    virtual void build() override;
+
+private:
+    std::unique_ptr<ic74173> ic;
+};
+
+/**
+ * \brief The built-in 74245 Octal Bus Transceiver.
+ */
+class builtin_ic74245 : public builtin_component
+{
+public:
+
+    builtin_ic74245();
+    virtual void build() override;
+
+private:
+    std::unique_ptr<ic74245> ic;
+};
+
+/**
+ * \brief The built-in 32K x 8 ROM.
+ */
+class builtin_icrom : public builtin_component
+{
+public:
+
+    builtin_icrom();
+    using builtin_component::configure;
+    virtual void configure(
+        const std::string& key, const std::string& value) override;
+    virtual void build() override;
+
+private:
+    std::string image_path;
+    std::unique_ptr<icrom> ic;
+};
+
+/**
+ * \brief The built-in 32K x 8 RAM.
+ */
+class builtin_icram : public builtin_component
+{
+public:
+
+    builtin_icram();
+    using builtin_component::configure;
+    virtual void configure(
+        const std::string& key, const std::string& value) override;
+    virtual void build() override;
+
+private:
+    std::string image_path;
+    std::unique_ptr<icram> ic;
+};
+
+} /* namespace homesim */
@@ -0,0 +1,46 @@
+/**
+ * \file platform/builtin_ic74173.cpp
+ *
+ * \brief Built-in 74173 Quad D-type Register.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include "builtin_components.h"
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the pin table for the 74173.
+ */
+static const component_pin_table& pin_table()
+{
+    static const component_pin_table table{
+        "m", "n", "1q", "2q", "3q", "4q", "clk", "clr", "1d", "2d", "3d", "4d",
+        "g1", "g2" };
+
+    return table;
+}
+
+/**
+ * \brief Constructor for the built-in 74173.
+ */
+homesim::builtin_ic74173::builtin_ic74173()
+    : builtin_component(pin_table(), ic74173_delay)
+{
+}
+
+/**
+ * \brief Build the 74173 from its bound pins.
+ */
+void homesim::builtin_ic74173::build()
+{
+    if (built)
+        return;
+
+    ic = make_unique<ic74173>(
+        get_wire(0), get_wire(1), get_wire(2), get_wire(3), get_wire(4),
+        get_wire(5), get_wire(6), get_wire(7), get_wire(8), get_wire(9),
+        get_wire(10), get_wire(11), get_wire(12), get_wire(13), delay);
+    built = true;
+}
@@ -0,0 +1,47 @@
+/**
+ * \file platform/builtin_ic74245.cpp
+ *
+ * \brief Built-in 74245 Octal Bus Transceiver.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include "builtin_components.h"
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the pin table for the 74245.
+ */
+static const component_pin_table& pin_table()
+{
+    static const component_pin_table table{
+        "dir", "a1", "a2", "a3", "a4", "a5", "a6", "a7", "a8", "oe", "b8", "b7",
+        "b6", "b5", "b4", "b3", "b2", "b1" };
+
+    return table;
+}
+
+/**
+ * \brief Constructor for the built-in 74245.
+ */
+homesim::builtin_ic74245::builtin_ic74245()
+    : builtin_component(pin_table(), ic74245_delay)
+{
+}
+
+/**
+ * \brief Build the 74245 from its bound pins.
+ */
+void homesim::builtin_ic74245::build()
+{
+    if (built)
+        return;
+
+    ic = make_unique<ic74245>(
+        get_wire(0), get_wire(1), get_wire(2), get_wire(3), get_wire(4),
+        get_wire(5), get_wire(6), get_wire(7), get_wire(8), get_wire(9),
+        get_wire(10), get_wire(11), get_wire(12), get_wire(13), get_wire(14),
+        get_wire(15), get_wire(16), get_wire(17), delay);
+    built = true;
+}
@@ -0,0 +1,81 @@
+/**
+ * \file platform/builtin_icram.cpp
+ *
+ * \brief Built-in 32K x 8 RAM.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include "builtin_components.h"
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief The number of address lines on the built-in RAM.
+ */
+static const int address_lines = 15;
+
+/**
+ * \brief Get the pin table for the RAM.
+ */
+static const component_pin_table& pin_table()
+{
+    static const component_pin_table table{
+        "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7", "a8", "a9", "a10",
+        "a11", "a12", "a13", "a14", "d0", "d1", "d2", "d3", "d4", "d5", "d6",
+        "d7", "ce", "oe", "we" };
+
+    return table;
+}
+
+/**
+ * \brief Constructor for the built-in RAM.
+ */
+homesim::builtin_icram::builtin_icram()
+    : builtin_component(pin_table(), icram_delay)
+{
+}
+
+/**
+ * \brief Configure the RAM.
+ *
+ * \param key       The configuration key.
+ * \param value     The evaluated configuration value.
+ *
+ * \throws \ref invalid_config_error if the key or value is invalid.
+ */
+void homesim::builtin_icram::configure(
+    const string& key, const string& value)
+{
+    if (key == "image")
+        image_path = value;
+    else
+        builtin_component::configure(key, value);
+}
+
+/**
+ * \brief Build the RAM from its bound pins, preloading its image file.
+ */
+void homesim::builtin_icram::build()
+{
+    if (built)
+        return;
+
+    auto memory = make_shared<paged_memory>(address_lines, 8);
+    if (!image_path.empty())
+        memory->load(image_path, 0);
+
+    vector<wire*> addresses;
+    for (int i = 0; i < address_lines; ++i)
+        addresses.push_back(get_wire(i));
+
+    vector<wire*> data;
+    for (int i = 0; i < 8; ++i)
+        data.push_back(get_wire(address_lines + i));
+
+    int ce = address_lines + 8;
+    ic = make_unique<icram>(
+        addresses, data, memory, get_wire(ce), get_wire(ce + 1),
+        get_wire(ce + 2), delay);
+    built = true;
+}
@@ -0,0 +1,82 @@
+/**
+ * \file platform/builtin_icrom.cpp
+ *
+ * \brief Built-in 32K x 8 ROM.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include "builtin_components.h"
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief The number of address lines on the built-in ROM.
+ */
+static const int address_lines = 15;
+
+/**
+ * \brief Get the pin table for the ROM.
+ */
+static const component_pin_table& pin_table()
+{
+    static const component_pin_table table{
+        "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7", "a8", "a9", "a10",
+        "a11", "a12", "a13", "a14", "d0", "d1", "d2", "d3", "d4", "d5", "d6",
+        "d7", "ce", "oe" };
+
+    return table;
+}
+
+/**
+ * \brief Constructor for the built-in ROM.
+ */
+homesim::builtin_icrom::builtin_icrom()
+    : builtin_component(pin_table(), icrom_delay)
+{
+}
+
+/**
+ * \brief Configure the ROM.
+ *
+ * \param key       The configuration key.
+ * \param value     The evaluated configuration value.
+ *
+ * \throws \ref invalid_config_error if the key or value is invalid.
+ */
+void homesim::builtin_icrom::configure(
+    const string& key, const string& value)
+{
+    if (key == "image")
+        image_path = value;
+    else
+        builtin_component::configure(key, value);
+}
+
+/**
+ * \brief Build the ROM from its bound pins and its image file.
+ *
+ * \throws \ref invalid_config_error if no image is configured.
+ */
+void homesim::builtin_icrom::build()
+{
+    if (built)
+        return;
+
+    if (image_path.empty())
+        throw invalid_config_error("ROM requires config image.");
+
+    vector<wire*> addresses;
+    for (int i = 0; i < address_lines; ++i)
+        addresses.push_back(get_wire(i));
+
+    /* the data pins follow the address pins, then ce and oe. */
+    int data = address_lines;
+    ic = make_unique<icrom>(
+        addresses, make_shared<const rom_image>(image_path),
+        get_wire(data + 9), get_wire(data + 8), get_wire(data + 0),
+        get_wire(data + 1), get_wire(data + 2), get_wire(data + 3),
+        get_wire(data + 4), get_wire(data + 5), get_wire(data + 6),
+        get_wire(data + 7), delay);
+    built = true;
+}
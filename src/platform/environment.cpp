@@ -5,6 +5,7 @@
  *
  * \copyright Copyright 2020 Justin Handville. All rights reserved.
  */
+#include <homesim/builtin_components.h>
 #include <homesim/component.h>
 #include <homesim/environment.h>
 
@@ -12,9 +13,13 @@ using namespace homesim;
 using namespace std;
 
 /**
- * \brief Construct an empty environment.
+ * \brief Construct a default environment.
+ *
+ * The component factory of a default environment holds the built-in parts.
  */
 homesim::environment::environment()
     : cf(make_shared<component_factory>())
+    , workers(0)
 {
+    register_builtin_components(*cf);
 }
@@ -0,0 +1,24 @@
+/**
+ * \file platform/environment_add_import.cpp
+ *
+ * \brief Record a module imported into the environment.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/environment.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Record a module imported into this environment, so that later imports
+ * of the same file share its definition.
+ *
+ * \param path      The canonical path of the module file.
+ * \param def       The definition of the module.
+ */
+void homesim::environment::add_import(
+    const string& path, shared_ptr<const composite_definition> def)
+{
+    imports[path] = def;
+}
@@ -0,0 +1,29 @@
+/**
+ * \file platform/environment_find_import.cpp
+ *
+ * \brief Find a module imported into the environment.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/environment.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Find a module imported into this environment.
+ *
+ * \param path      The canonical path of the module file.
+ *
+ * \returns the shared definition of the module, or nullptr if it has not been
+ * imported.
+ */
+shared_ptr<const composite_definition>
+homesim::environment::find_import(const string& path) const
+{
+    auto f = imports.find(path);
+    if (imports.end() == f)
+        return nullptr;
+
+    return f->second;
+}
@@ -0,0 +1,20 @@
+/**
+ * \file platform/environment_get_worker_count.cpp
+ *
+ * \brief Get the number of worker threads for the environment.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/environment.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Get the number of worker threads used to parse and analyze imported
+ * modules, or zero for one per hardware thread.
+ */
+unsigned homesim::environment::get_worker_count() const
+{
+    return workers;
+}
@@ -0,0 +1,22 @@
+/**
+ * \file platform/environment_set_worker_count.cpp
+ *
+ * \brief Set the number of worker threads for the environment.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/environment.h>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Set the number of worker threads used to parse and analyze imported
+ * modules.
+ *
+ * \param count     The number of workers, or zero for one per hardware thread.
+ */
+void homesim::environment::set_worker_count(unsigned count)
+{
+    workers = count;
+}
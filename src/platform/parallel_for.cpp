@@ -0,0 +1,76 @@
+/**
+ * \file platform/parallel_for.cpp
+ *
+ * \brief Run a loop body on a pool of worker threads.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <homesim/parallel.h>
+#include <thread>
+#include <vector>
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Run a loop body for each index from zero to count on a pool of worker
+ * threads.
+ *
+ * \param count         The number of indices.
+ * \param body          The loop body, called once per index.
+ * \param workers       The number of worker threads, or zero for one per
+ *                      hardware thread.
+ */
+void homesim::parallel_for(
+    size_t count, const function<void (size_t)>& body, unsigned workers)
+{
+    if (0 == workers)
+        workers = max(thread::hardware_concurrency(), 1U);
+    if (workers > count)
+        workers = count;
+
+    /* a single worker runs the loop in place. */
+    if (workers <= 1)
+    {
+        for (size_t i = 0; i < count; ++i)
+            body(i);
+
+        return;
+    }
+
+    atomic<size_t> next(0);
+    vector<exception_ptr> errors(count);
+
+    auto work = [&]() {
+        for (size_t i = next++; i < count; i = next++)
+        {
+            try
+            {
+                body(i);
+            }
+            catch (...)
+            {
+                errors[i] = current_exception();
+            }
+        }
+    };
+
+    vector<thread> pool;
+    pool.reserve(workers - 1);
+    for (unsigned i = 1; i < workers; ++i)
+        pool.emplace_back(work);
+
+    work();
+
+    for (auto& t : pool)
+        t.join();
+
+    for (auto& e : errors)
+    {
+        if (e)
+            rethrow_exception(e);
+    }
+}
@@ -0,0 +1,125 @@
+/**
+ * \file platform/register_builtin_components.cpp
+ *
+ * \brief Register the built-in component library.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/and_gate.h>
+#include <homesim/buffer.h>
+#include <homesim/builtin_components.h>
+#include <homesim/ic/7400.h>
+#include <homesim/ic/7402.h>
+#include <homesim/ic/7404.h>
+#include <homesim/ic/7408.h>
+#include <homesim/ic/7432.h>
+#include <homesim/ic/7486.h>
+#include <homesim/inverter.h>
+#include <homesim/nand_gate.h>
+#include <homesim/nor_gate.h>
+#include <homesim/or_gate.h>
+#include <homesim/xnor_gate.h>
+#include <homesim/xor_gate.h>
+
+#include "builtin_components.h"
+
+using namespace homesim;
+using namespace std;
+
+/**
+ * \brief Register a built-in part whose wrapper takes a pin table and delay.
+ */
+template <typename part_type>
+static void register_part(
+    component_factory& factory, const string& type,
+    const component_pin_table& table, double delay)
+{
+    factory.register_component(
+        type, [&table, delay]() -> shared_ptr<component> {
+            return make_shared<part_type>(table, delay);
+        });
+
+    factory.register_arena_component(
+        type, [&table, delay](netlist_arena& arena) -> shared_ptr<component> {
+            return allocate_shared<part_type>(
+                arena_allocator<part_type>(&arena), table, delay);
+        });
+}
+
+/**
+ * \brief Register a built-in part with a default constructor.
+ */
+template <typename part_type>
+static void register_part(component_factory& factory, const string& type)
+{
+    factory.register_component(type, []() -> shared_ptr<component> {
+        return make_shared<part_type>();
+    });
+
+    factory.register_arena_component(
+        type, [](netlist_arena& arena) -> shared_ptr<component> {
+            return allocate_shared<part_type>(
+                arena_allocator<part_type>(&arena));
+        });
+}
+
+/**
+ * \brief Register every built-in part with the given component factory.
+ *
+ * \param factory       The factory in which the parts are registered.
+ */
+void homesim::register_builtin_components(component_factory& factory)
+{
+    static const component_pin_table gate_pins{ "a", "b", "y" };
+    static const component_pin_table unary_gate_pins{ "a", "y" };
+    static const component_pin_table ic7400_pins{
+        "1a", "1b", "1y", "2a", "2b", "2y", "3y", "3b", "3a", "4y", "4b",
+        "4a" };
+    static const component_pin_table ic7402_pins{
+        "1y", "1a", "1b", "2y", "2a", "2b", "3a", "3b", "3y", "4a", "4b",
+        "4y" };
+    static const component_pin_table ic7404_pins{
+        "1a", "1y", "2a", "2y", "3a", "3y", "4y", "4a", "5y", "5a", "6y",
+        "6a" };
+    static const component_pin_table ic7408_pins{
+        "1a", "1b", "1y", "2a", "2b", "2y", "3y", "3a", "3b", "4y", "4a",
+        "4b" };
+
+    /* discrete gates. */
+    register_part<builtin_gate<and_gate>>(
+        factory, "and_gate", gate_pins, and_gate_delay);
+    register_part<builtin_gate<or_gate>>(
+        factory, "or_gate", gate_pins, or_gate_delay);
+    register_part<builtin_gate<nand_gate>>(
+        factory, "nand_gate", gate_pins, nand_gate_delay);
+    register_part<builtin_gate<nor_gate>>(
+        factory, "nor_gate", gate_pins, nor_gate_delay);
+    register_part<builtin_gate<xor_gate>>(
+        factory, "xor_gate", gate_pins, xor_gate_delay);
+    register_part<builtin_gate<xnor_gate>>(
+        factory, "xnor_gate", gate_pins, xnor_gate_delay);
+    register_part<builtin_unary_gate<inverter>>(
+        factory, "inverter", unary_gate_pins, inverter_delay);
+    register_part<builtin_unary_gate<buffer>>(
+        factory, "buffer", unary_gate_pins, buffer_delay);
+
+    /* 14 pin gate packages; the 7432 and 7486 share the 7408 pinout. */
+    register_part<builtin_dip14<ic7400>>(
+        factory, "ic7400", ic7400_pins, ic7400_delay);
+    register_part<builtin_dip14<ic7402>>(
+        factory, "ic7402", ic7402_pins, ic7402_delay);
+    register_part<builtin_dip14<ic7404>>(
+        factory, "ic7404", ic7404_pins, ic7404_delay);
+    register_part<builtin_dip14<ic7408>>(
+        factory, "ic7408", ic7408_pins, ic7408_delay);
+    register_part<builtin_dip14<ic7432>>(
+        factory, "ic7432", ic7408_pins, ic7432_delay);
+    register_part<builtin_dip14<ic7486>>(
+        factory, "ic7486", ic7408_pins, ic7486_delay);
+
+    /* registers, transceivers, and memories. */
+    register_part<builtin_ic74173>(factory, "ic74173");
+    register_part<builtin_ic74245>(factory, "ic74245");
+    register_part<builtin_icrom>(factory, "icrom");
+    register_part<builtin_icram>(factory, "icram");
+}
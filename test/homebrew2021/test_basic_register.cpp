@@ -0,0 +1,153 @@
+/**
+ * \file test/homebrew2021/test_basic_register.cpp
+ *
+ * \brief Unit tests for the basic register and its behavioral model.
+ *
+ * \copyright Copyright 2021 Justin Handville.  All rights reserved.
+ */
+#include <homesim/agenda.h>
+#include <homesim/macro_model.h>
+#include <minunit/minunit.h>
+#include <tuple>
+#include <vector>
+
+#include "basic_register.h"
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(basic_register);
+
+namespace {
+
+/**
+ * \brief The wires of a basic register.
+ */
+struct register_wires
+{
+    wire clock, clear, read, write;
+    wire in[8], out[8];
+};
+
+} /* namespace */
+
+/**
+ * \brief Build a basic register in the given mode.
+ */
+static shared_ptr<homebrew2021::basic_register> make_register(
+    register_wires& w, macro_model_mode mode)
+{
+    global_macro_models.set_mode(homebrew2021::basic_register_model_name, mode);
+
+    auto reg =
+        make_shared<homebrew2021::basic_register>(
+            &w.clock, &w.clear, &w.read, &w.write, &w.in[0], &w.in[1],
+            &w.in[2], &w.in[3], &w.in[4], &w.in[5], &w.in[6], &w.in[7],
+            &w.out[0], &w.out[1], &w.out[2], &w.out[3], &w.out[4], &w.out[5],
+            &w.out[6], &w.out[7]);
+
+    global_macro_models.set_mode(
+        homebrew2021::basic_register_model_name, MACRO_MODEL_MODE_BEHAVIORAL);
+
+    return reg;
+}
+
+/**
+ * \brief Get the connection counts of each wire of a basic register.
+ */
+static vector<tuple<int, int, int>> connections(register_wires& w)
+{
+    vector<tuple<int, int, int>> counts;
+    vector<wire*> wires{ &w.clock, &w.clear, &w.read, &w.write };
+    for (int i = 0; i < 8; ++i)
+    {
+        wires.push_back(&w.in[i]);
+        wires.push_back(&w.out[i]);
+    }
+
+    for (auto x : wires)
+        counts.push_back(
+            make_tuple(x->get_inputs(), x->get_outputs(), x->get_high_zs()));
+
+    return counts;
+}
+
+/**
+ * The basic register model loads its wires as the structural register does.
+ */
+TEST(model_connections)
+{
+    register_wires structural, behavioral;
+
+    global_agenda.clear();
+    auto s = make_register(structural, MACRO_MODEL_MODE_STRUCTURAL);
+    auto b = make_register(behavioral, MACRO_MODEL_MODE_BEHAVIORAL);
+
+    /* the structural outputs are enabled until the read inverter settles. */
+    for (auto r : { &structural.read, &behavioral.read })
+    {
+        r->set_signal(true);
+        propagate();
+        r->set_signal(false);
+        propagate();
+    }
+
+    TEST_EXPECT(connections(structural) == connections(behavioral));
+    TEST_EXPECT(2 == behavioral.clock.get_inputs());
+    TEST_EXPECT(1 == behavioral.read.get_inputs());
+    TEST_EXPECT(1 == behavioral.write.get_inputs());
+
+    global_agenda.clear();
+}
+
+/**
+ * The basic register model matches the two-74173 structural register when
+ * the two are co-simulated.
+ */
+TEST(model_cosimulate)
+{
+    register_wires w;
+
+    global_agenda.clear();
+    global_macro_models.clear_divergences();
+    auto reg = make_register(w, MACRO_MODEL_MODE_COSIMULATE);
+
+    /* settle the read and write inverters. */
+    w.read.set_signal(true);
+    w.write.set_signal(true);
+    propagate();
+    w.read.set_signal(false);
+    w.write.set_signal(false);
+    propagate();
+
+    /* latch a value. */
+    const int value = 0xA5;
+    for (int i = 0; i < 8; ++i)
+        w.in[i].set_signal((value >> i) & 1);
+    w.write.set_signal(true);
+    propagate();
+    w.clock.set_signal(true);
+    propagate();
+    w.clock.set_signal(false);
+    w.write.set_signal(false);
+    propagate();
+
+    /* read it back. */
+    w.read.set_signal(true);
+    propagate();
+    for (int i = 0; i < 8; ++i)
+        TEST_EXPECT(((value >> i) & 1) == w.out[i].get_signal());
+
+    /* clear it. */
+    w.clear.set_signal(true);
+    propagate();
+    w.clear.set_signal(false);
+    propagate();
+    for (int i = 0; i < 8; ++i)
+        TEST_EXPECT(!w.out[i].get_signal());
+
+    TEST_EXPECT(global_macro_models.divergences().empty());
+
+    global_macro_models.clear_divergences();
+    global_agenda.clear();
+}
@@ -0,0 +1,142 @@
+/**
+ * \file test/test_builtin_components.cpp
+ *
+ * \brief Unit tests for the built-in component library.
+ *
+ * \copyright Copyright 2021 Justin Handville.  All rights reserved.
+ */
+#include <homesim/agenda.h>
+#include <homesim/builtin_components.h>
+#include <homesim/environment.h>
+#include <homesim/ic/rom_image.h>
+#include <minunit/minunit.h>
+#include <unistd.h>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(builtin_components);
+
+/**
+ * The default environment knows every built-in part.
+ */
+TEST(default_environment)
+{
+    environment en;
+    auto& factory = en.get_component_factory();
+
+    for (auto type : {
+            "and_gate", "or_gate", "nand_gate", "nor_gate", "xor_gate",
+            "xnor_gate", "inverter", "buffer", "ic7400", "ic7402", "ic7404",
+            "ic7408", "ic7432", "ic7486", "ic74173", "ic74245", "icrom",
+            "icram" })
+    {
+        TEST_EXPECT(!!factory.create(type));
+    }
+}
+
+/**
+ * A built-in part is wired up by pin name and simulates the real part.
+ */
+TEST(build_ic7400)
+{
+    environment en;
+    wire w[12];
+
+    auto c = en.get_component_factory().create("ic7400");
+    TEST_ASSERT(12 == c->pins());
+    TEST_EXPECT(string("1a") == c->pin_name(0));
+    TEST_EXPECT(string("4a") == c->pin_name(11));
+
+    for (int i = 0; i < c->pins(); ++i)
+        c->set_pin(c->pin_name(i), w + i);
+
+    c->configure("propagation_delay", "1e-09");
+    c->build();
+
+    /* 1y = !(1a && 1b). */
+    propagate();
+    TEST_EXPECT(true == w[2].get_signal());
+    w[0].set_signal(true);
+    w[1].set_signal(true);
+    propagate();
+    TEST_EXPECT(false == w[2].get_signal());
+}
+
+/**
+ * Building a part with an unbound pin fails.
+ */
+TEST(build_missing_wire)
+{
+    environment en;
+    wire a, y;
+
+    auto c = en.get_component_factory().create("and_gate");
+    c->set_pin("a", &a);
+    c->set_pin("y", &y);
+
+    try
+    {
+        c->build();
+
+        /* the build call above should have thrown. */
+        TEST_FAILURE();
+    }
+    catch (missing_wire_error& e)
+    {
+        TEST_SUCCESS();
+    }
+}
+
+/**
+ * Invalid configuration is rejected.
+ */
+TEST(invalid_config)
+{
+    environment en;
+
+    auto c = en.get_component_factory().create("inverter");
+
+    try
+    {
+        c->configure("propagation_delay", "fast");
+
+        /* the configure call above should have thrown. */
+        TEST_FAILURE();
+    }
+    catch (invalid_config_error& e)
+    {
+        TEST_SUCCESS();
+    }
+}
+
+/**
+ * The built-in ROM loads its image from a file.
+ */
+TEST(build_icrom)
+{
+    environment en;
+    wire w[25];
+    char path[] = "/tmp/homesim_builtin_romXXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT(fd >= 0);
+    close(fd);
+
+    vector<uint8_t> bytes(32768, 0);
+    bytes[1] = 0x81;
+    write_rom_image(path, bytes);
+
+    auto c = en.get_component_factory().create("icrom");
+    for (int i = 0; i < c->pins(); ++i)
+        c->set_pin(c->pin_name(i), w + i);
+    c->configure("image", path);
+    c->build();
+    unlink(path);
+
+    /* select the chip and read address 1. */
+    w[0].set_signal(true);
+    propagate();
+    TEST_EXPECT(true == w[15].get_signal());
+    TEST_EXPECT(false == w[16].get_signal());
+    TEST_EXPECT(true == w[22].get_signal());
+}
@@ -0,0 +1,160 @@
+/**
+ * \file test/test_combinational_netlist.cpp
+ *
+ * \brief Unit tests for combinational netlist elaboration.
+ *
+ * \copyright Copyright 2021 Justin Handville.  All rights reserved.
+ */
+#include <homesim/combinational_netlist.h>
+#include <minunit/minunit.h>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(combinational_netlist);
+
+/**
+ * \brief Run the global agenda to completion, counting the events performed.
+ */
+static int count_events()
+{
+    int count = 0;
+
+    for (;;)
+    {
+        auto a = global_agenda.next();
+        if (!a.first)
+            return count;
+
+        global_agenda.pop();
+        a.second();
+        ++count;
+    }
+}
+
+/**
+ * \brief Build a 2-to-4 active low decoder in the given netlist.
+ */
+static void build_decoder(
+    combinational_netlist& net, wire* a0, wire* a1, wire* y[4])
+{
+    int i0 = net.add_input(a0);
+    int i1 = net.add_input(a1);
+    int n0 = net.add_gate(LUT_GATE_OP_INVERTER, i0, 1.0);
+    int n1 = net.add_gate(LUT_GATE_OP_INVERTER, i1, 1.0);
+
+    net.add_output(net.add_gate(LUT_GATE_OP_NAND, n0, n1, 1.0), y[0]);
+    net.add_output(net.add_gate(LUT_GATE_OP_NAND, i0, n1, 1.0), y[1]);
+    net.add_output(net.add_gate(LUT_GATE_OP_NAND, n0, i1, 1.0), y[2]);
+    net.add_output(net.add_gate(LUT_GATE_OP_NAND, i0, i1, 1.0), y[3]);
+}
+
+/**
+ * Gates may only refer to nodes that already exist.
+ */
+TEST(unknown_node)
+{
+    combinational_netlist net;
+    wire a;
+
+    int i = net.add_input(&a);
+
+    try
+    {
+        net.add_gate(LUT_GATE_OP_AND, i, i + 1, 1.0);
+
+        /* the add_gate call above should have thrown. */
+        TEST_FAILURE();
+    }
+    catch (lut_error& e)
+    {
+        TEST_SUCCESS();
+    }
+}
+
+/**
+ * A small decoder collapses into a single lookup table.
+ */
+TEST(collapse_decoder)
+{
+    combinational_netlist net;
+    wire a0, a1, y0, y1, y2, y3;
+    wire* y[4] = { &y0, &y1, &y2, &y3 };
+
+    build_decoder(net, &a0, &a1, y);
+    net.elaborate();
+
+    TEST_ASSERT(1 == net.luts());
+    TEST_ASSERT(0 == net.fallback_gates());
+
+    /* every address selects exactly one output. */
+    for (int addr = 0; addr < 4; ++addr)
+    {
+        a0.set_signal(addr & 1);
+        a1.set_signal(addr & 2);
+        propagate();
+
+        for (int i = 0; i < 4; ++i)
+            TEST_EXPECT((i != addr) == y[i]->get_signal());
+    }
+
+    /* an input change is a single update after the longest path delay. */
+    a0.set_signal(false);
+    double start = global_agenda.current_time();
+    TEST_EXPECT(1 == count_events());
+    TEST_EXPECT(2.0 == global_agenda.current_time() - start);
+}
+
+/**
+ * Cones with too many inputs fall back to gates with the same behavior.
+ */
+TEST(fallback)
+{
+    combinational_netlist net;
+    wire a0, a1, y0, y1, y2, y3;
+    wire* y[4] = { &y0, &y1, &y2, &y3 };
+
+    build_decoder(net, &a0, &a1, y);
+    net.elaborate(1);
+
+    TEST_ASSERT(0 == net.luts());
+    TEST_ASSERT(6 == net.fallback_gates());
+
+    for (int addr = 0; addr < 4; ++addr)
+    {
+        a0.set_signal(addr & 1);
+        a1.set_signal(addr & 2);
+        propagate();
+
+        for (int i = 0; i < 4; ++i)
+            TEST_EXPECT((i != addr) == y[i]->get_signal());
+    }
+}
+
+/**
+ * Outputs that can't share a table get their own.
+ */
+TEST(separate_tables)
+{
+    combinational_netlist net;
+    wire a, b, c, d, y0, y1;
+
+    net.add_output(
+        net.add_gate(
+            LUT_GATE_OP_XOR, net.add_input(&a), net.add_input(&b), 1.0),
+        &y0);
+    net.add_output(
+        net.add_gate(
+            LUT_GATE_OP_AND, net.add_input(&c), net.add_input(&d), 1.0),
+        &y1);
+    net.elaborate(2);
+
+    TEST_ASSERT(2 == net.luts());
+
+    a.set_signal(true);
+    c.set_signal(true);
+    d.set_signal(true);
+    propagate();
+    TEST_EXPECT(true == y0.get_signal());
+    TEST_EXPECT(true == y1.get_signal());
+}
@@ -111,3 +111,76 @@ TEST(build)
     c.set_pin("2y", &w2y);
     c.build();
 }
+
+/* Pins can be bound by index, and share the binding with the name. */
+TEST(set_pin_by_index)
+{
+    test_component c;
+    wire w;
+
+    int index = c.pin_index("2b");
+    TEST_ASSERT(4 == index);
+    TEST_EXPECT(-1 == c.pin_index("3a"));
+
+    c.set_pin(index, &w);
+
+    try
+    {
+        c.set_pin("2b", &w);
+
+        /* the pin was already bound by index. */
+        TEST_FAILURE();
+    }
+    catch (pin_binding_error& e)
+    {
+        TEST_SUCCESS();
+    }
+}
+
+/* Binding an out of range pin index causes an error. */
+TEST(invalid_pin_index)
+{
+    test_component c;
+    wire w;
+
+    try
+    {
+        c.set_pin(6, &w);
+
+        /* the set_pin call above should have thrown. */
+        TEST_FAILURE();
+    }
+    catch (invalid_pin_error& e)
+    {
+        TEST_SUCCESS();
+    }
+}
+
+/* Every name in a large pin table hashes to its own index. */
+TEST(pin_table_perfect_hash)
+{
+    vector<string> names;
+    for (int i = 0; i < 500; ++i)
+        names.push_back(string("p") + to_string(i));
+
+    component_pin_table table(names);
+
+    TEST_ASSERT(500 == table.size());
+    for (int i = 0; i < 500; ++i)
+        TEST_EXPECT(i == table.find(names[i]));
+
+    TEST_EXPECT(-1 == table.find("p500"));
+    TEST_EXPECT(-1 == table.find(""));
+}
+
+/* Components of the same type share a single pin table. */
+TEST(pin_table_intern)
+{
+    auto& t1 = component_pin_table::intern({ "a", "b" });
+    auto& t2 = component_pin_table::intern({ "a", "b" });
+    auto& t3 = component_pin_table::intern({ "b", "a" });
+
+    TEST_EXPECT(&t1 == &t2);
+    TEST_EXPECT(&t1 != &t3);
+    TEST_EXPECT(1 == t3.find("a"));
+}
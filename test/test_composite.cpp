@@ -0,0 +1,225 @@
+/**
+ * \file test/test_composite.cpp
+ *
+ * \brief Unit tests for hierarchical composite components.
+ *
+ * \copyright Copyright 2021 Justin Handville.  All rights reserved.
+ */
+#include <homesim/agenda.h>
+#include <homesim/composite.h>
+#include <homesim/environment.h>
+#include <homesim/semantic_analyzer.h>
+#include <minunit/minunit.h>
+#include <sstream>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(composite);
+
+/**
+ * \brief Define a half adder with pins a, b, s, and c.
+ */
+static shared_ptr<const composite_definition> half_adder(
+    component_factory& factory)
+{
+    auto def = make_shared<composite_definition>(factory);
+
+    int x = def->add_child("x", "xor_gate");
+    int n = def->add_child("n", "and_gate");
+
+    int a = def->add_net("a", true);
+    int b = def->add_net("b", true);
+    int s = def->add_net("s", true);
+    int c = def->add_net("c", true);
+
+    def->connect(a, x, "a");
+    def->connect(a, n, "a");
+    def->connect(b, x, "b");
+    def->connect(b, n, "b");
+    def->connect(s, x, "y");
+    def->connect(c, n, "y");
+
+    return def;
+}
+
+/**
+ * \brief Define a full adder from two half adders, with internal nets.
+ */
+static shared_ptr<const composite_definition> full_adder(
+    component_factory& factory)
+{
+    auto def = make_shared<composite_definition>(factory);
+
+    int h1 = def->add_child("h1", "half_adder");
+    int h2 = def->add_child("h2", "half_adder");
+    int o = def->add_child("o", "or_gate");
+
+    int a = def->add_net("a", true);
+    int b = def->add_net("b", true);
+    int cin = def->add_net("cin", true);
+    int s = def->add_net("s", true);
+    int cout = def->add_net("cout", true);
+    int s1 = def->add_net("s1", false);
+    int c1 = def->add_net("c1", false);
+    int c2 = def->add_net("c2", false);
+
+    def->connect(a, h1, "a");
+    def->connect(b, h1, "b");
+    def->connect(s1, h1, "s");
+    def->connect(c1, h1, "c");
+    def->connect(s1, h2, "a");
+    def->connect(cin, h2, "b");
+    def->connect(s, h2, "s");
+    def->connect(c2, h2, "c");
+    def->connect(c1, o, "a");
+    def->connect(c2, o, "b");
+    def->connect(cout, o, "y");
+
+    return def;
+}
+
+/**
+ * Connecting an unknown child pin fails when the definition is built.
+ */
+TEST(unknown_pin)
+{
+    environment en;
+    composite_definition def(en.get_component_factory());
+
+    int x = def.add_child("x", "xor_gate");
+    int n = def.add_net("n", false);
+
+    try
+    {
+        def.connect(n, x, "q");
+
+        /* the connect call above should have thrown. */
+        TEST_FAILURE();
+    }
+    catch (invalid_pin_error& e)
+    {
+        TEST_SUCCESS();
+    }
+}
+
+/**
+ * Exporting two nets with the same name fails when the pin table is built.
+ */
+TEST(duplicate_pin)
+{
+    environment en;
+    composite_definition def(en.get_component_factory());
+
+    def.add_net("a", true);
+    def.add_net("b", false);
+    def.add_net("a", true);
+
+    try
+    {
+        def.pin_table();
+
+        /* the pin_table call above should have thrown. */
+        TEST_FAILURE();
+    }
+    catch (invalid_pin_error& e)
+    {
+        TEST_SUCCESS();
+    }
+}
+
+/**
+ * Nested composites flatten into working logic, with names in a side table.
+ */
+TEST(nested_full_adder)
+{
+    environment en;
+    auto& factory = en.get_component_factory();
+    hierarchy_names names;
+    wire a, b, cin, s, cout;
+
+    register_composite(factory, "half_adder", half_adder(factory));
+    auto def = full_adder(factory);
+    register_composite(factory, "full_adder", def);
+
+    auto fa = factory.create("full_adder");
+    TEST_ASSERT(5 == fa->pins());
+    fa->set_pin("a", &a);
+    fa->set_pin("b", &b);
+    fa->set_pin("cin", &cin);
+    fa->set_pin("s", &s);
+    fa->set_pin("cout", &cout);
+
+    dynamic_cast<composite_component*>(fa.get())->set_hierarchy(
+        &names, "fa");
+    fa->build();
+
+    /* three internal nets and seven children, two of them composites. */
+    TEST_EXPECT(10 == names.size());
+
+    for (int i = 0; i < 8; ++i)
+    {
+        a.set_signal(i & 1);
+        b.set_signal(i & 2);
+        cin.set_signal(i & 4);
+        propagate();
+
+        int sum = (i & 1) + ((i >> 1) & 1) + ((i >> 2) & 1);
+        TEST_EXPECT((sum & 1) == s.get_signal());
+        TEST_EXPECT((sum >> 1) == cout.get_signal());
+    }
+}
+
+/**
+ * Instances share their definition.
+ */
+TEST(shared_definition)
+{
+    environment en;
+    auto& factory = en.get_component_factory();
+    auto def = half_adder(factory);
+
+    register_composite(factory, "half_adder", def);
+
+    auto h1 = factory.create("half_adder");
+    auto h2 = factory.create("half_adder");
+
+    /* both factory entries, and each instance, hold the one definition. */
+    TEST_EXPECT(5 == def.use_count());
+    TEST_EXPECT(&h1->pin_name(0) == &h2->pin_name(0));
+}
+
+/**
+ * A module with exported wires is extracted as a composite.
+ */
+TEST(extract_from_module)
+{
+    stringstream in(
+        R"TEST(
+            module inv2 {
+                component u1 { type inverter }
+                component u2 { type inverter }
+                export wire in { u1.pin["a"] }
+                wire mid { u1.pin["y"] u2.pin["a"] }
+                export wire out { u2.pin["y"] }
+            }
+        )TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+    wire win, wout;
+
+    semantic_analyzer analyzer(en, p.parse());
+    auto c = analyzer.extract_component();
+
+    TEST_ASSERT(2 == c->pins());
+    c->set_pin("in", &win);
+    c->set_pin("out", &wout);
+    c->build();
+
+    win.set_signal(true);
+    propagate();
+    TEST_EXPECT(true == wout.get_signal());
+    win.set_signal(false);
+    propagate();
+    TEST_EXPECT(false == wout.get_signal());
+}
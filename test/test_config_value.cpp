@@ -0,0 +1,92 @@
+/**
+ * \file test/test_config_value.cpp
+ *
+ * \brief Unit tests for typed configuration values.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/config_value.h>
+#include <homesim/constants.h>
+#include <minunit/minunit.h>
+#include <string>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(config_value);
+
+/**
+ * \brief Parse a number from a string.
+ */
+static bool parse(const string& text, double& out)
+{
+    return config_parse_number(text.data(), text.data() + text.size(), out);
+}
+
+/**
+ * Numbers are parsed in full, ignoring surrounding blanks.
+ */
+TEST(parse_number)
+{
+    double x;
+
+    TEST_ASSERT(parse("27", x));
+    TEST_EXPECT(27.0 == x);
+    TEST_ASSERT(parse(" 2.5e-3 ", x));
+    TEST_EXPECT(2.5e-3 == x);
+    TEST_ASSERT(parse("+1", x));
+    TEST_EXPECT(1.0 == x);
+    TEST_ASSERT(parse("-0.5", x));
+    TEST_EXPECT(-0.5 == x);
+
+    TEST_EXPECT(!parse("", x));
+    TEST_EXPECT(!parse("1.5x", x));
+    TEST_EXPECT(!parse("ns", x));
+    TEST_EXPECT(!parse("1 2", x));
+}
+
+/**
+ * Numbers are formatted in their shortest exact form.
+ */
+TEST(format_number)
+{
+    TEST_EXPECT(string("10000") == config_format_number(10000.0));
+    TEST_EXPECT(string("2.7e-08") == config_format_number(2.7e-8));
+    TEST_EXPECT(string("0.1") == config_format_number(0.1));
+    TEST_EXPECT(string("1e+06") == config_format_number(1.0e6));
+}
+
+/**
+ * Times are held as ticks and read back in seconds.
+ */
+TEST(time_seconds)
+{
+    config_value v{};
+    v.type = CONFIG_VALUE_TIME;
+    v.ticks = 27 * nanoseconds_to_ticks_scale;
+
+    TEST_EXPECT(27e-9 == v.seconds());
+    TEST_EXPECT(string("2.7e-08") == v.str());
+}
+
+/**
+ * Only numeric values have a value in seconds.
+ */
+TEST(seconds_type_error)
+{
+    config_value v{};
+    v.type = CONFIG_VALUE_BOOLEAN;
+    v.boolean = true;
+
+    TEST_EXPECT(string("true") == v.str());
+
+    try
+    {
+        v.seconds();
+        TEST_FAILURE();
+    }
+    catch (config_value_error& e)
+    {
+        TEST_SUCCESS();
+    }
+}
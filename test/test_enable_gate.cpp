@@ -0,0 +1,74 @@
+/**
+ * \file test/test_enable_gate.cpp
+ *
+ * \brief Unit tests for the enable gate.
+ *
+ * \copyright Copyright 2021 Justin Handville.  All rights reserved.
+ */
+#include <homesim/enable_gate.h>
+#include <minunit/minunit.h>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(enable_gate);
+
+/**
+ * Data actions only run while every enable pin is low.
+ */
+TEST(suspend_while_disabled)
+{
+    wire e1, e2, d;
+    int actions = 0;
+
+    enable_gate gate({&e1, &e2});
+    gate.add_action(&d, [&]() { ++actions; });
+
+    /* subscribing runs the action once, like any wire action. */
+    TEST_EXPECT(gate.awake());
+    TEST_EXPECT(1 == actions);
+
+    d.set_signal(true);
+    TEST_EXPECT(2 == actions);
+
+    /* either enable pin puts the gate to sleep. */
+    e2.set_signal(true);
+    TEST_EXPECT(!gate.awake());
+    d.set_signal(false);
+    TEST_EXPECT(2 == actions);
+
+    e2.set_signal(false);
+    TEST_EXPECT(gate.awake());
+    d.set_signal(true);
+    TEST_EXPECT(3 == actions);
+}
+
+/**
+ * Waking runs the catch-up action once, only if something was missed.
+ */
+TEST(wake_catch_up)
+{
+    wire e, d;
+    int wakes = 0;
+
+    enable_gate gate({&e}, [&]() { ++wakes; });
+    gate.add_action(&d, []() { });
+
+    /* nothing was missed, so there is nothing to catch up on. */
+    e.set_signal(true);
+    e.set_signal(false);
+    TEST_EXPECT(0 == wakes);
+
+    /* several missed changes cause a single catch-up. */
+    e.set_signal(true);
+    d.set_signal(true);
+    d.set_signal(false);
+    d.set_signal(true);
+    TEST_EXPECT(0 == wakes);
+    e.set_signal(false);
+    TEST_EXPECT(1 == wakes);
+
+    e.set_signal(true);
+    e.set_signal(false);
+    TEST_EXPECT(1 == wakes);
+}
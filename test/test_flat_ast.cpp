@@ -0,0 +1,491 @@
+/**
+ * \file test/test_flat_ast.cpp
+ *
+ * \brief Unit tests for the flat AST and its symbol table.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/environment.h>
+#include <homesim/flat_ast.h>
+#include <homesim/semantic_analyzer.h>
+#include <minunit/minunit.h>
+#include <sstream>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(flat_ast);
+
+/**
+ * Interning a name twice returns the same id.
+ */
+TEST(symbol_table_intern)
+{
+    symbol_table symbols;
+
+    int foo = symbols.intern("foo");
+    int bar = symbols.intern("bar");
+
+    TEST_EXPECT(foo != bar);
+    TEST_EXPECT(foo == symbols.intern("foo"));
+    TEST_EXPECT(bar == symbols.find("bar"));
+    TEST_EXPECT(-1 == symbols.find("baz"));
+    TEST_EXPECT(string("foo") == symbols.str(foo));
+    TEST_EXPECT(2 == symbols.size());
+}
+
+/**
+ * The symbol table keeps its ids as it grows.
+ */
+TEST(symbol_table_growth)
+{
+    symbol_table symbols;
+
+    for (int i = 0; i < 1000; ++i)
+        TEST_ASSERT(i == symbols.intern(string("n") + to_string(i)));
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        TEST_EXPECT(i == symbols.find(string("n") + to_string(i)));
+        TEST_EXPECT(string("n") + to_string(i) == symbols.str(i));
+    }
+
+    TEST_EXPECT(1000 == symbols.size());
+}
+
+/**
+ * A module parses into contiguous, index-linked nodes.
+ */
+TEST(parse_flat)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component u1 {
+                    type and_gate
+                    config["propagation_delay"] := ns(5)
+                    config["propagation_delay"] := 7 }
+                component u2 { type inverter }
+                wire w1 { u1.pin["y"] u2.pin["a"] pullup { } }
+                signal probe p { wire w1 }
+            }
+        )TEST");
+    parser p(in);
+
+    auto mod = p.parse_flat();
+
+    TEST_EXPECT(string("foo") == mod->symbols.str(mod->name));
+    TEST_ASSERT(2 == mod->components.size());
+    TEST_EXPECT(
+        string("and_gate") == mod->symbols.str(mod->components[0].type));
+
+    /* the first assignment to a config key wins. */
+    TEST_ASSERT(1 == mod->components[0].config_count);
+    auto& config = mod->configs[mod->components[0].first_config];
+    TEST_EXPECT(
+        string("propagation_delay") == mod->symbols.str(config.key));
+    TEST_EXPECT(HOMESIM_TOKEN_NUMBER == mod->type(config.expression));
+    TEST_EXPECT(string("5e-09") == mod->eval(config.expression));
+
+    TEST_ASSERT(1 == mod->wires.size());
+    auto& w = mod->wires[0];
+    TEST_ASSERT(2 == w.connection_count);
+    auto& c = mod->connections[w.first_connection + 1];
+    TEST_EXPECT(string("u2") == mod->symbols.str(c.component));
+    TEST_EXPECT(string("a") == mod->symbols.str(c.pin));
+    TEST_ASSERT(0 == w.pull);
+    TEST_EXPECT(string("pullup") == mod->symbols.str(mod->pulls[0].type));
+
+    /* names are interned once. */
+    TEST_EXPECT(mod->wire_refs[0] == w.name);
+}
+
+/**
+ * A config AST survives a round trip through the flat AST.
+ */
+TEST(round_trip)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component u1 { type and_gate }
+                export wire w1 { u1.pin["y"] }
+                scenario s {
+                    execution e {
+                        at start { u1.pin["a"] := true }
+                        after ns(3) { expect wire.w1.signal = false }
+                    }
+                }
+            }
+        )TEST");
+    parser p(in);
+
+    auto mod = make_config_ast(*make_flat_module(*p.parse()));
+
+    TEST_EXPECT(string("foo") == mod->name);
+    TEST_ASSERT(1 == mod->component_map.size());
+    TEST_EXPECT(
+        string("and_gate") == *mod->component_map.begin()->second->type);
+    TEST_ASSERT(1 == mod->wire_map.size());
+    TEST_EXPECT(mod->wire_map.begin()->second->exported);
+
+    auto execution = mod->scenario_map["s"]->execution_map["e"];
+    TEST_ASSERT(2 == execution->step_list.size());
+    auto step = execution->step_list.back();
+    TEST_EXPECT(string("after") == step->type);
+    TEST_EXPECT(string("3e-09") == step->step_expression->eval());
+    TEST_ASSERT(1 == step->assertion_list.size());
+    TEST_EXPECT(string("w1") == step->assertion_list.front()->lhs.front());
+}
+
+/**
+ * The semantic analyzer runs directly on a flat module.
+ */
+TEST(analyze_flat)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component u1 { type and_gate }
+                wire w1 { u1.pin["y"] u2.pin["a"] }
+            }
+        )TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+
+    shared_ptr<const flat_module> mod = p.parse_flat();
+    semantic_analyzer analyzer(en, mod);
+
+    try
+    {
+        analyzer.extract_simulation();
+
+        /* the unknown component should have been reported. */
+        TEST_FAILURE();
+    }
+    catch (semantic_error& e)
+    {
+        TEST_EXPECT(
+            string("In wire w1: reference to unknown component u2.")
+                == e.what());
+    }
+}
+
+/**
+ * Expressions are folded to typed values when they are parsed.
+ */
+TEST(folded_values)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component u1 {
+                    type resistor
+                    config["delay"] := ns(27)
+                    config["long_delay"] := us(1.5)
+                    config["resistance"] := kohms(10)
+                    config["scale"] := 0.5
+                    config["image"] := "rom.bin"
+                    config["mode"] := fast
+                }
+            }
+        )TEST");
+    parser p(in);
+
+    auto mod = p.parse_flat();
+    auto& c = mod->components[0];
+    TEST_ASSERT(6 == c.config_count);
+
+    auto value = [&](int i) {
+        return mod->value(mod->configs[c.first_config + i].expression);
+    };
+
+    TEST_ASSERT(CONFIG_VALUE_TIME == value(0).type);
+    TEST_EXPECT(27000 == value(0).ticks);
+    TEST_ASSERT(CONFIG_VALUE_TIME == value(1).type);
+    TEST_EXPECT(1500000 == value(1).ticks);
+    TEST_ASSERT(CONFIG_VALUE_NUMBER == value(2).type);
+    TEST_EXPECT(10000.0 == value(2).number);
+    TEST_ASSERT(CONFIG_VALUE_NUMBER == value(3).type);
+    TEST_EXPECT(0.5 == value(3).number);
+    TEST_ASSERT(CONFIG_VALUE_STRING == value(4).type);
+    TEST_EXPECT(string("\"rom.bin\"") == value(4).text);
+    TEST_ASSERT(CONFIG_VALUE_IDENTIFIER == value(5).type);
+    TEST_EXPECT(string("fast") == value(5).text);
+}
+
+/**
+ * An unknown functor is a parse error.
+ */
+TEST(unknown_functor)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component u1 {
+                    type and_gate
+                    config["propagation_delay"] := fs(27) }
+            }
+        )TEST");
+    parser p(in);
+
+    try
+    {
+        p.parse_flat();
+        TEST_FAILURE();
+    }
+    catch (parser_error& e)
+    {
+        string what = e.what();
+        TEST_EXPECT(string::npos != what.find("Error at 5:"));
+        TEST_EXPECT(string::npos != what.find("Unknown functor fs."));
+    }
+}
+
+/**
+ * Arrays and ranges are kept as counts and indices, not expanded.
+ */
+TEST(arrays)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component reg[16] { type ic74173 }
+                wire bus[4] { reg[0:3].pin["1d"] reg[4].pin["d"][3:0] }
+                wire clk { reg[0:15].pin["clk"] }
+                signal probe p { wire bus[2] }
+            }
+        )TEST");
+    parser p(in);
+
+    auto mod = p.parse_flat();
+    TEST_ASSERT(1 == mod->components.size());
+    TEST_EXPECT(16 == mod->components[0].count);
+    TEST_ASSERT(2 == mod->wires.size());
+    TEST_EXPECT(4 == mod->wires[0].count);
+    TEST_EXPECT(0 == mod->wires[1].count);
+    TEST_ASSERT(3 == mod->connections.size());
+
+    auto& c0 = mod->connections[0];
+    TEST_EXPECT(0 == c0.first && 3 == c0.last);
+    TEST_EXPECT(-1 == c0.pin_first && -1 == c0.pin_last);
+    TEST_EXPECT(4 == mod->connection_width(0));
+    TEST_EXPECT(4 == mod->connection_width(1));
+    TEST_EXPECT(16 == mod->connection_width(2));
+
+    string component, pin;
+    mod->connection_target(0, 2, component, pin);
+    TEST_EXPECT(string("reg[2]") == component);
+    TEST_EXPECT(string("1d") == pin);
+    mod->connection_target(1, 0, component, pin);
+    TEST_EXPECT(string("reg[4]") == component);
+    TEST_EXPECT(string("d3") == pin);
+
+    int bus = mod->wires[0].name, clk = mod->wires[1].name;
+    TEST_EXPECT(string("bus[3]") == mod->element_name(bus, 4, 3));
+    TEST_EXPECT(string("clk") == mod->element_name(clk, 0, 3));
+    TEST_ASSERT(1 == mod->wire_refs.size());
+    TEST_EXPECT(string("bus[2]") == mod->symbols.str(mod->wire_refs[0]));
+
+    /* the config AST has a node per element. */
+    auto ast = make_config_ast(*mod);
+    TEST_EXPECT(16 == ast->component_map.size());
+    TEST_EXPECT(5 == ast->wire_map.size());
+    auto& clk_list = ast->wire_map.find("clk")->second->connection_list;
+    TEST_EXPECT(16 == clk_list.size());
+    auto& bus1 = ast->wire_map.find("bus[1]")->second->connection_list;
+    TEST_ASSERT(2 == bus1.size());
+    TEST_EXPECT(string("reg[1]") == bus1.front()->component);
+    TEST_EXPECT(string("reg[4]") == bus1.back()->component);
+    TEST_EXPECT(string("d2") == bus1.back()->pin);
+}
+
+/**
+ * A connection to a wire array must be as wide as the array.
+ */
+TEST(array_width_mismatch)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component reg[16] { type ic74173 }
+                wire bus[8] { reg[0:3].pin["clk"] }
+            }
+        )TEST");
+    parser p(in);
+
+    try
+    {
+        p.parse_flat();
+        TEST_FAILURE();
+    }
+    catch (parser_error& e)
+    {
+        string what = e.what();
+        TEST_EXPECT(string::npos != what.find("Error at 4:"));
+        TEST_EXPECT(
+            string::npos
+                != what.find(
+                    "Connection width 4 does not match wire width 8."));
+    }
+}
+
+/**
+ * A connection in a wire with an external source must also be as wide as the
+ * wire.
+ */
+TEST(array_width_mismatch_source)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component inv[4] { type inverter }
+                wire in[2] { signal source external inv[0:3].pin["a"] }
+            }
+        )TEST");
+    parser p(in);
+
+    try
+    {
+        p.parse_flat();
+        TEST_FAILURE();
+    }
+    catch (parser_error& e)
+    {
+        string what = e.what();
+        TEST_EXPECT(
+            string::npos
+                != what.find(
+                    "Connection width 4 does not match wire width 2."));
+    }
+}
+
+/**
+ * An array must have at least one element.
+ */
+TEST(array_invalid_count)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                wire bus[0] { }
+            }
+        )TEST");
+    parser p(in);
+
+    try
+    {
+        p.parse_flat();
+        TEST_FAILURE();
+    }
+    catch (parser_error& e)
+    {
+        string what = e.what();
+        TEST_EXPECT(string::npos != what.find("Invalid count 0."));
+    }
+}
+
+/**
+ * An array can't have more elements than the parser allows.
+ */
+TEST(array_count_too_large)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                wire bus[65537] { }
+            }
+        )TEST");
+    parser p(in);
+
+    try
+    {
+        p.parse_flat();
+        TEST_FAILURE();
+    }
+    catch (parser_error& e)
+    {
+        string what = e.what();
+        TEST_EXPECT(string::npos != what.find("Invalid count 65537."));
+    }
+}
+
+/**
+ * A repeat block is stored once, with its body following it.
+ */
+TEST(repeat_block)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                scenario x {
+                    execution 1 {
+                        at start { }
+                        repeat 1000000 {
+                            after ns(10) { u1.pin["a"] := true }
+                            repeat 2 {
+                                after ns(10) { u1.pin["a"] := false }
+                            }
+                        }
+                        after ns(10) { }
+                    }
+                }
+            }
+        )TEST");
+    parser p(in);
+
+    auto mod = p.parse_flat();
+    TEST_ASSERT(1 == mod->executions.size());
+    TEST_EXPECT(6 == mod->executions[0].step_count);
+    TEST_ASSERT(6 == mod->steps.size());
+    TEST_EXPECT(0 == mod->steps[0].body_count);
+    TEST_EXPECT(3 == mod->steps[1].body_count);
+    TEST_EXPECT(1000000.0 == mod->value(mod->steps[1].expression).number);
+    TEST_EXPECT(0 == mod->steps[2].body_count);
+    TEST_EXPECT(1 == mod->steps[3].body_count);
+    TEST_EXPECT(0 == mod->steps[5].body_count);
+
+    /* the config AST nests the body under the repeat step. */
+    auto ast = make_config_ast(*mod);
+    auto& steps = ast->scenario_map["x"]->execution_map["1"]->step_list;
+    TEST_ASSERT(3 == steps.size());
+    auto repeat = *next(steps.begin());
+    TEST_EXPECT(string("repeat") == repeat->type);
+    TEST_ASSERT(2 == repeat->step_list.size());
+    TEST_EXPECT(1 == repeat->step_list.back()->step_list.size());
+
+    /* and flattens back to the same layout. */
+    auto flat = make_flat_module(*ast);
+    TEST_ASSERT(6 == flat->steps.size());
+    TEST_EXPECT(3 == flat->steps[1].body_count);
+    TEST_EXPECT(1 == flat->steps[3].body_count);
+}
+
+/**
+ * Imports are recorded by path, and survive a round trip.
+ */
+TEST(imports)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                import "lib/inv2.hs"
+                import "alu.hs"
+                component u1 { type inv2 }
+            }
+        )TEST");
+    parser p(in);
+
+    auto mod = p.parse_flat();
+    TEST_ASSERT(2 == mod->imports.size());
+    TEST_EXPECT(string("lib/inv2.hs") == mod->symbols.str(mod->imports[0]));
+    TEST_EXPECT(string("alu.hs") == mod->symbols.str(mod->imports[1]));
+
+    auto ast = make_config_ast(*mod);
+    TEST_ASSERT(2 == ast->import_list.size());
+    TEST_EXPECT(string("lib/inv2.hs") == ast->import_list.front());
+
+    auto flat = make_flat_module(*ast);
+    TEST_ASSERT(2 == flat->imports.size());
+    TEST_EXPECT(string("alu.hs") == flat->symbols.str(flat->imports[1]));
+}
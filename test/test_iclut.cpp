@@ -0,0 +1,65 @@
+/**
+ * \file test/test_iclut.cpp
+ *
+ * \brief Unit tests for the lookup-table component.
+ *
+ * \copyright Copyright 2021 Justin Handville.  All rights reserved.
+ */
+#include <homesim/ic/lut.h>
+#include <minunit/minunit.h>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(iclut);
+
+/**
+ * The table size must match the number of inputs.
+ */
+TEST(table_mismatch)
+{
+    wire a, b, y;
+
+    auto table = make_shared<const vector<uint32_t>>(vector<uint32_t>{ 0, 1 });
+
+    try
+    {
+        iclut lut({&a, &b}, {&y}, table, 1.0);
+
+        /* the constructor above should have thrown. */
+        TEST_FAILURE();
+    }
+    catch (lut_error& e)
+    {
+        TEST_SUCCESS();
+    }
+}
+
+/**
+ * The outputs follow the table entry for the current inputs.
+ */
+TEST(lookup)
+{
+    wire a, b, y0, y1;
+
+    /* y0 = a xor b, y1 = a and b. */
+    auto table =
+        make_shared<const vector<uint32_t>>(
+            vector<uint32_t>{ 0x0, 0x1, 0x1, 0x2 });
+
+    iclut lut({&a, &b}, {&y0, &y1}, table, 1.0);
+
+    propagate();
+    TEST_EXPECT(false == y0.get_signal());
+    TEST_EXPECT(false == y1.get_signal());
+
+    a.set_signal(true);
+    propagate();
+    TEST_EXPECT(true == y0.get_signal());
+    TEST_EXPECT(false == y1.get_signal());
+
+    b.set_signal(true);
+    propagate();
+    TEST_EXPECT(false == y0.get_signal());
+    TEST_EXPECT(true == y1.get_signal());
+}
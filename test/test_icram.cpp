@@ -0,0 +1,127 @@
+/**
+ * \file test/test_icram.cpp
+ *
+ * \brief Unit tests for the RAM IC.
+ *
+ * \copyright Copyright 2021 Justin Handville.  All rights reserved.
+ */
+
+#include <homesim/agenda.h>
+#include <homesim/ic/ram.h>
+#include <minunit/minunit.h>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(icram);
+
+/**
+ * \brief Drive a group of wires with the bits of a value.
+ */
+static void drive(wire* w, size_t count, uint32_t value)
+{
+    for (size_t i = 0; i < count; ++i)
+        w[i].set_signal((value >> i) & 1);
+}
+
+/**
+ * \brief Read a value from the bits of a group of wires.
+ */
+static uint32_t sample(wire* w, size_t count)
+{
+    uint32_t value = 0;
+    for (size_t i = 0; i < count; ++i)
+        if (w[i].get_signal())
+            value |= 1U << i;
+
+    return value;
+}
+
+/**
+ * The number of address and data lines must match the memory.
+ */
+TEST(mismatch)
+{
+    wire ce, oe, we;
+    wire a[4];
+    wire d[8];
+    vector<wire*> addrs{ a + 0, a + 1, a + 2, a + 3 };
+    vector<wire*> data{ d + 0, d + 1, d + 2, d + 3 };
+
+    try
+    {
+        icram ic(addrs, data, make_shared<paged_memory>(4, 8), &ce, &oe, &we);
+        TEST_FAILURE();
+    }
+    catch (memory_error& e)
+    {
+        TEST_SUCCESS();
+    }
+}
+
+/**
+ * A 16-bit RAM can be written and read back.
+ */
+TEST(write_read)
+{
+    wire ce, oe, we;
+    wire a[20];
+    wire d[16];
+    vector<wire*> addrs;
+    vector<wire*> data;
+    auto mem = make_shared<paged_memory>(20, 16);
+
+    for (int i = 0; i < 20; ++i)
+    {
+        a[i].add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+        addrs.push_back(a + i);
+    }
+    for (int i = 0; i < 16; ++i)
+        data.push_back(d + i);
+
+    ce.add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+    oe.add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+    we.add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+    ce.set_signal(true);
+    oe.set_signal(true);
+    we.set_signal(true);
+
+    icram ic(addrs, data, mem, &ce, &oe, &we);
+    propagate();
+
+    /* the bus is floating while the chip is deselected. */
+    TEST_EXPECT(d[0].is_floating());
+
+    /* write a word while driving the data bus. */
+    for (int i = 0; i < 16; ++i)
+        d[i].add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+    drive(a, 20, 0xABCDE);
+    drive(d, 16, 0xBEEF);
+    ce.set_signal(false);
+    we.set_signal(false);
+    propagate();
+    we.set_signal(true);
+    propagate();
+    TEST_EXPECT(0xBEEF == mem->read(0xABCDE));
+    TEST_EXPECT(1 == mem->pages());
+
+    /* release the data bus and read the word back. */
+    for (int i = 0; i < 16; ++i)
+        d[i].change_connection_type(
+            WIRE_CONNECTION_TYPE_OUTPUT, WIRE_CONNECTION_TYPE_INPUT, false);
+    drive(d, 16, 0);
+    oe.set_signal(false);
+    propagate();
+    TEST_EXPECT(!d[0].is_floating());
+    TEST_EXPECT(0xBEEF == sample(d, 16));
+
+    /* an unwritten address reads as zero. */
+    drive(a, 20, 0x12345);
+    propagate();
+    TEST_EXPECT(0 == sample(d, 16));
+
+    /* deselecting the chip floats the bus. */
+    ce.set_signal(true);
+    propagate();
+    TEST_EXPECT(d[0].is_floating());
+}
@@ -314,3 +314,160 @@ TEST(output_all_bytes)
     TEST_EXPECT(!bus[7].is_floating());
     TEST_EXPECT(bus[7].get_signal() == false);
 }
+
+/**
+ * Multiple ROMs can share a single ROM image.
+ */
+TEST(shared_image)
+{
+    wire oe;
+    wire ce;
+    wire a[2];
+    wire bus1[8];
+    wire bus2[8];
+    vector<wire*> addrs;
+
+    addrs.push_back(a + 0);
+    addrs.push_back(a + 1);
+    for (auto a : addrs)
+    {
+        a->add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+        a->set_signal(false);
+    }
+
+    auto image = make_shared<const rom_image>(vector<uint8_t>{ 1, 2, 3, 4 });
+
+    /* create two ics sharing the same image. */
+    icrom ic1(
+        addrs, image, &oe, &ce, bus1 + 0, bus1 + 1, bus1 + 2, bus1 + 3,
+        bus1 + 4, bus1 + 5, bus1 + 6, bus1 + 7);
+    icrom ic2(
+        addrs, image, &oe, &ce, bus2 + 0, bus2 + 1, bus2 + 2, bus2 + 3,
+        bus2 + 4, bus2 + 5, bus2 + 6, bus2 + 7);
+
+    /* the image is shared, not copied. */
+    TEST_EXPECT(3 == image.use_count());
+
+    /* make sure the output and chip enable lines are low. */
+    oe.add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+    oe.set_signal(false);
+    ce.add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+    ce.set_signal(false);
+
+    /* encode the fourth byte address. */
+    addrs[0]->set_signal(true);
+    addrs[1]->set_signal(true);
+    propagate();
+
+    /* both buses should be outputting the fourth byte. */
+    TEST_EXPECT(bus1[2].get_signal() == true);
+    TEST_EXPECT(bus2[2].get_signal() == true);
+    TEST_EXPECT(bus1[0].get_signal() == false);
+    TEST_EXPECT(bus2[0].get_signal() == false);
+}
+
+/**
+ * Address changes that decode to the same byte leave the bus untouched.
+ */
+TEST(unchanged_byte)
+{
+    wire oe;
+    wire ce;
+    wire a[2];
+    wire bus[8];
+    vector<wire*> addrs;
+    vector<uint8_t> bytes{ 7, 7, 7, 8 };
+    int bus_changes = 0;
+
+    addrs.push_back(a + 0);
+    addrs.push_back(a + 1);
+    for (auto a : addrs)
+    {
+        a->add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+        a->set_signal(false);
+    }
+
+    /* create the ic. */
+    icrom ic(
+        addrs, bytes, &oe, &ce, bus + 0, bus + 1, bus + 2, bus + 3, bus + 4,
+        bus + 5, bus + 6, bus + 7);
+
+    /* make sure the output and chip enable lines are low. */
+    oe.add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+    oe.set_signal(false);
+    ce.add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+    ce.set_signal(false);
+    propagate();
+    TEST_EXPECT(bus[0].get_signal() == true);
+    TEST_EXPECT(bus[3].get_signal() == false);
+
+    /* count bus connection state changes from here on. */
+    for (int i = 0; i < 8; ++i)
+        bus[i].add_state_change_action([&]() { ++bus_changes; });
+    bus_changes = 0;
+
+    /* sweep through the addresses that decode to the same byte. */
+    addrs[0]->set_signal(true);
+    propagate();
+    addrs[0]->set_signal(false);
+    addrs[1]->set_signal(true);
+    propagate();
+    TEST_EXPECT(0 == bus_changes);
+    TEST_EXPECT(bus[0].get_signal() == true);
+
+    /* the last address decodes to a different byte. */
+    addrs[0]->set_signal(true);
+    propagate();
+    TEST_EXPECT(bus_changes > 0);
+    TEST_EXPECT(bus[0].get_signal() == false);
+    TEST_EXPECT(bus[1].get_signal() == false);
+    TEST_EXPECT(bus[2].get_signal() == false);
+    TEST_EXPECT(bus[3].get_signal() == true);
+    TEST_EXPECT(!bus[3].is_floating());
+}
+
+/**
+ * A deselected ROM schedules no events for address changes, and catches up on
+ * the current address when it is selected again.
+ */
+TEST(deselected_sleeps)
+{
+    wire oe;
+    wire ce;
+    wire a[2];
+    wire bus[8];
+    vector<wire*> addrs;
+    vector<uint8_t> bytes{ 1, 2, 4, 8 };
+
+    addrs.push_back(a + 0);
+    addrs.push_back(a + 1);
+    for (auto a : addrs)
+    {
+        a->add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+        a->set_signal(false);
+    }
+
+    /* create the ic. */
+    icrom ic(
+        addrs, bytes, &oe, &ce, bus + 0, bus + 1, bus + 2, bus + 3, bus + 4,
+        bus + 5, bus + 6, bus + 7);
+
+    /* deselect the chip. */
+    oe.add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+    oe.set_signal(false);
+    ce.add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+    ce.set_signal(true);
+    propagate();
+
+    /* address changes while deselected don't schedule anything. */
+    addrs[0]->set_signal(true);
+    addrs[1]->set_signal(true);
+    TEST_EXPECT(!global_agenda.next().first);
+
+    /* selecting the chip outputs the byte at the current address. */
+    ce.set_signal(false);
+    propagate();
+    TEST_EXPECT(bus[0].get_signal() == false);
+    TEST_EXPECT(bus[3].get_signal() == true);
+    TEST_EXPECT(!bus[3].is_floating());
+}
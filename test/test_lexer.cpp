@@ -8,6 +8,8 @@
 #include <homesim/parser.h>
 #include <memory>
 #include <minunit/minunit.h>
+#include <cstdio>
+#include <fstream>
 #include <sstream>
 
 using namespace homesim;
@@ -40,6 +42,24 @@ TEST(assign_token)
     TEST_EXPECT(HOMESIM_TOKEN_EOF == scanner.read());
 }
 
+/**
+ * A colon that is not part of an assignment separates a range.
+ */
+TEST(colon_token)
+{
+    const string VALUE = "0:7";
+    stringstream in(VALUE);
+    lexer scanner(in);
+
+    TEST_EXPECT(HOMESIM_TOKEN_NUMBER == scanner.read());
+    TEST_EXPECT(string("0") == scanner.get_token_string());
+    TEST_EXPECT(HOMESIM_TOKEN_COLON == scanner.read());
+    TEST_EXPECT(string(":") == scanner.get_token_string());
+    TEST_EXPECT(HOMESIM_TOKEN_NUMBER == scanner.read());
+    TEST_EXPECT(string("7") == scanner.get_token_string());
+    TEST_EXPECT(HOMESIM_TOKEN_EOF == scanner.read());
+}
+
 /**
  * It's possible to scan an asterisk token.
  */
@@ -1277,6 +1297,19 @@ TEST(identifier_falses)
     TEST_EXPECT(HOMESIM_TOKEN_EOF == scanner.read());
 }
 
+/**
+ * import keyword.
+ */
+TEST(keyword_import)
+{
+    stringstream in("import");
+    lexer scanner(in);
+
+    TEST_EXPECT(HOMESIM_TOKEN_KEYWORD_IMPORT == scanner.read());
+    TEST_EXPECT(string("import") == scanner.get_token_string());
+    TEST_EXPECT(HOMESIM_TOKEN_EOF == scanner.read());
+}
+
 /**
  * module keyword.
  */
@@ -1628,6 +1661,19 @@ TEST(identifier_pullups)
     TEST_EXPECT(HOMESIM_TOKEN_EOF == scanner.read());
 }
 
+/**
+ * repeat keyword.
+ */
+TEST(keyword_repeat)
+{
+    stringstream in("repeat");
+    lexer scanner(in);
+
+    TEST_EXPECT(HOMESIM_TOKEN_KEYWORD_REPEAT == scanner.read());
+    TEST_EXPECT(string("repeat") == scanner.get_token_string());
+    TEST_EXPECT(HOMESIM_TOKEN_EOF == scanner.read());
+}
+
 /**
  * scenario keyword.
  */
@@ -2359,3 +2405,100 @@ TEST(identifier_newline_identifier_linecol)
     TEST_EXPECT(2 == el);
     TEST_EXPECT(3 == ec);
 }
+
+/**
+ * A lexer over a buffer returns tokens as ranges into that buffer.
+ */
+TEST(buffer_tokens_are_ranges)
+{
+    const string VALUE = "component foo\n  { type \"and_gate\" }";
+    lexer scanner(VALUE.data(), VALUE.data() + VALUE.size());
+    int sl, sc, el, ec;
+
+    TEST_EXPECT(HOMESIM_TOKEN_KEYWORD_COMPONENT == scanner.read());
+    TEST_EXPECT(VALUE.data() == scanner.get_token_view().data());
+    TEST_EXPECT(9 == scanner.get_token_view().size());
+
+    TEST_EXPECT(HOMESIM_TOKEN_IDENTIFIER == scanner.read());
+    TEST_EXPECT(VALUE.data() + 10 == scanner.get_token_view().data());
+    TEST_EXPECT(string("foo") == scanner.get_token_string());
+
+    TEST_EXPECT(HOMESIM_TOKEN_BRACE_LEFT == scanner.read());
+    scanner.read_linecol(sl, sc, el, ec);
+    TEST_EXPECT(2 == sl);
+    TEST_EXPECT(3 == sc);
+
+    TEST_EXPECT(HOMESIM_TOKEN_KEYWORD_TYPE == scanner.read());
+    TEST_EXPECT(HOMESIM_TOKEN_STRING == scanner.read());
+    TEST_EXPECT(string("\"and_gate\"") == scanner.get_token_string());
+    scanner.read_linecol(sl, sc, el, ec);
+    TEST_EXPECT(2 == sl);
+    TEST_EXPECT(10 == sc);
+    TEST_EXPECT(19 == ec);
+
+    TEST_EXPECT(HOMESIM_TOKEN_BRACE_RIGHT == scanner.read());
+    TEST_EXPECT(HOMESIM_TOKEN_EOF == scanner.read());
+}
+
+/**
+ * A mapped file can be scanned in place.
+ */
+TEST(mapped_file_scan)
+{
+    const char* PATH = "test_lexer_mapped_file.tmp";
+
+    {
+        ofstream out(PATH);
+        out << "wire foo";
+    }
+
+    {
+        mapped_file file(PATH);
+        lexer scanner(file.begin(), file.end());
+
+        TEST_EXPECT(HOMESIM_TOKEN_KEYWORD_WIRE == scanner.read());
+        TEST_EXPECT(HOMESIM_TOKEN_IDENTIFIER == scanner.read());
+        TEST_EXPECT(string("foo") == scanner.get_token_string());
+        TEST_EXPECT(HOMESIM_TOKEN_EOF == scanner.read());
+    }
+
+    remove(PATH);
+}
+
+/**
+ * Mapping a missing file throws a mapped_file_error.
+ */
+TEST(mapped_file_missing)
+{
+    try
+    {
+        mapped_file file("this file does not exist.hs");
+
+        /* the constructor above should have thrown. */
+        TEST_FAILURE();
+    }
+    catch (mapped_file_error& e)
+    {
+        TEST_SUCCESS();
+    }
+}
+
+/**
+ * Prefixes, extensions, and near misses of keywords are identifiers.
+ */
+TEST(keyword_near_misses)
+{
+    const char* VALUES[] = {
+        "a", "af", "atx", "expor", "exports", "expoct", "stat", "stattt",
+        "pul", "pullupdown", "Wire", "wir_", "true1", "_type" };
+
+    for (auto value : VALUES)
+    {
+        stringstream in(value);
+        lexer scanner(in);
+
+        TEST_EXPECT(HOMESIM_TOKEN_IDENTIFIER == scanner.read());
+        TEST_EXPECT(string(value) == scanner.get_token_string());
+        TEST_EXPECT(HOMESIM_TOKEN_EOF == scanner.read());
+    }
+}
@@ -0,0 +1,77 @@
+/**
+ * \file test/test_macro_model.cpp
+ *
+ * \brief Unit tests for macro-model substitution.
+ *
+ * \copyright Copyright 2021 Justin Handville.  All rights reserved.
+ */
+#include <homesim/agenda.h>
+#include <homesim/macro_model.h>
+#include <minunit/minunit.h>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(macro_model);
+
+/**
+ * Composites without a registered model are always structural.
+ */
+TEST(unregistered_is_structural)
+{
+    macro_model_registry registry;
+
+    TEST_EXPECT(MACRO_MODEL_MODE_STRUCTURAL == registry.mode("foo"));
+
+    registry.set_mode("foo", MACRO_MODEL_MODE_BEHAVIORAL);
+    TEST_EXPECT(MACRO_MODEL_MODE_STRUCTURAL == registry.mode("foo"));
+}
+
+/**
+ * Registered composites use the default mode unless a mode is set.
+ */
+TEST(registered_modes)
+{
+    macro_model_registry registry;
+
+    registry.register_model("foo");
+    registry.register_model("bar");
+    TEST_EXPECT(MACRO_MODEL_MODE_BEHAVIORAL == registry.mode("foo"));
+
+    registry.set_default_mode(MACRO_MODEL_MODE_COSIMULATE);
+    registry.set_mode("bar", MACRO_MODEL_MODE_STRUCTURAL);
+    TEST_EXPECT(MACRO_MODEL_MODE_COSIMULATE == registry.mode("foo"));
+    TEST_EXPECT(MACRO_MODEL_MODE_STRUCTURAL == registry.mode("bar"));
+}
+
+/**
+ * The co-simulation monitor only flags pins that disagree after settling.
+ */
+TEST(cosim_monitor)
+{
+    wire structural, behavioral;
+    cosim_monitor monitor("foo", 5.0);
+
+    global_macro_models.clear_divergences();
+    monitor.watch("pin", &structural, &behavioral);
+    propagate();
+    TEST_EXPECT(global_macro_models.divergences().empty());
+
+    /* a brief disagreement inside the tolerance is not flagged. */
+    structural.set_signal(true);
+    global_agenda.add(1.0, [&]() { behavioral.set_signal(true); });
+    propagate();
+    TEST_EXPECT(global_macro_models.divergences().empty());
+
+    /* a lasting disagreement is flagged. */
+    structural.set_signal(false);
+    propagate();
+    TEST_ASSERT(!global_macro_models.divergences().empty());
+    TEST_EXPECT(
+        string("foo") == global_macro_models.divergences().front().composite);
+    TEST_EXPECT(string("pin") == global_macro_models.divergences().front().pin);
+    TEST_EXPECT(!global_macro_models.divergences().front().structural_signal);
+    TEST_EXPECT(global_macro_models.divergences().front().behavioral_signal);
+
+    global_macro_models.clear_divergences();
+}
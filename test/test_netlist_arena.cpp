@@ -0,0 +1,122 @@
+/**
+ * \file test/test_netlist_arena.cpp
+ *
+ * \brief Unit tests for the netlist arena.
+ *
+ * \copyright Copyright 2021 Justin Handville.  All rights reserved.
+ */
+#include <homesim/agenda.h>
+#include <homesim/and_gate.h>
+#include <homesim/component.h>
+#include <homesim/environment.h>
+#include <homesim/netlist_arena.h>
+#include <homesim/wire.h>
+#include <minunit/minunit.h>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(netlist_arena);
+
+namespace {
+
+/**
+ * \brief An object that counts its destruction.
+ */
+struct counted
+{
+    counted(int* count, int id, int* last)
+        : count(count), id(id), last(last)
+    {
+    }
+
+    ~counted()
+    {
+        ++*count;
+        *last = id;
+    }
+
+    int* count;
+    int id;
+    int* last;
+};
+
+} /* anonymous namespace */
+
+/**
+ * Allocations are aligned and don't overlap.
+ */
+TEST(allocate)
+{
+    netlist_arena arena(64);
+
+    char* c = static_cast<char*>(arena.allocate(1, 1));
+    double* d = static_cast<double*>(arena.allocate(sizeof(double), 8));
+    TEST_EXPECT(0 == reinterpret_cast<uintptr_t>(d) % 8);
+
+    /* larger than a block still works. */
+    char* big = static_cast<char*>(arena.allocate(1000, 1));
+    big[999] = 'x';
+    *c = 'y';
+    *d = 1.0;
+    TEST_EXPECT('x' == big[999]);
+    TEST_EXPECT(1001 + sizeof(double) == arena.size());
+}
+
+/**
+ * Objects are destroyed in reverse order when the arena is destroyed.
+ */
+TEST(destroy_in_reverse)
+{
+    int count = 0;
+    int last = -1;
+
+    {
+        netlist_arena arena;
+        arena.create<counted>(&count, 1, &last);
+        arena.create<counted>(&count, 2, &last);
+        TEST_EXPECT(0 == count);
+    }
+
+    TEST_EXPECT(2 == count);
+    TEST_EXPECT(1 == last);
+}
+
+/**
+ * Wires and gates built in an arena simulate like any others.
+ */
+TEST(arena_wires)
+{
+    netlist_arena arena;
+    arena.reserve(64 * 1024);
+
+    wire* a = arena.create<wire>(&arena);
+    wire* b = arena.create<wire>(&arena);
+    wire* y = arena.create<wire>(&arena);
+    arena.create<and_gate>(a, b, y, 1.0);
+
+    a->set_signal(true);
+    b->set_signal(true);
+    propagate();
+    TEST_EXPECT(true == y->get_signal());
+}
+
+/**
+ * Built-in parts can be created in an arena through the factory.
+ */
+TEST(arena_components)
+{
+    netlist_arena arena;
+    environment en;
+    wire a(&arena), y(&arena);
+
+    auto c = en.get_component_factory().create("inverter", arena);
+    TEST_ASSERT(!!c);
+    TEST_EXPECT(arena.size() > 0);
+
+    c->set_pin("a", &a);
+    c->set_pin("y", &y);
+    c->build();
+    propagate();
+    TEST_EXPECT(true == y.get_signal());
+}
@@ -0,0 +1,349 @@
+/**
+ * \file test/test_netlist_cache.cpp
+ *
+ * \brief Unit tests for the binary netlist cache.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <homesim/agenda.h>
+#include <homesim/component.h>
+#include <homesim/environment.h>
+#include <homesim/netlist_cache.h>
+#include <homesim/semantic_analyzer.h>
+#include <homesim/wire.h>
+#include <minunit/minunit.h>
+#include <sstream>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(netlist_cache);
+
+static const char* cache_path = "test_netlist_cache.cache";
+
+static const string inv2_source =
+    R"TEST(
+        module inv2 {
+            component u1 { type inverter }
+            component u2 { type inverter }
+            export wire in { u1.pin["a"] }
+            wire mid { u1.pin["y"] u2.pin["a"] }
+            export wire out { u2.pin["y"] }
+        }
+    )TEST";
+
+/**
+ * \brief Analyze the given source and write it to the test cache.
+ */
+static uint64_t write_test_cache(const string& source)
+{
+    uint64_t hash =
+        netlist_cache_hash(source.data(), source.data() + source.size());
+    parser p(source.data(), source.data() + source.size());
+    semantic_analyzer analyzer(make_shared<environment>(), p.parse_flat());
+
+    analyzer.write_cache(cache_path, hash);
+
+    return hash;
+}
+
+/**
+ * The content hash depends on every byte of the source.
+ */
+TEST(hash)
+{
+    string a = "module a { }";
+    string b = "module b { }";
+
+    TEST_EXPECT(
+        netlist_cache_hash(a.data(), a.data() + a.size())
+            == netlist_cache_hash(a.data(), a.data() + a.size()));
+    TEST_EXPECT(
+        netlist_cache_hash(a.data(), a.data() + a.size())
+            != netlist_cache_hash(b.data(), b.data() + b.size()));
+}
+
+/**
+ * A netlist read back from the cache behaves like the original.
+ */
+TEST(round_trip)
+{
+    uint64_t hash = write_test_cache(inv2_source);
+    wire win, wout;
+
+    auto analyzer =
+        semantic_analyzer::read_cache(
+            make_shared<environment>(), cache_path, hash);
+    TEST_ASSERT(!!analyzer);
+
+    auto c = analyzer->extract_component();
+    TEST_ASSERT(2 == c->pins());
+    c->set_pin("in", &win);
+    c->set_pin("out", &wout);
+    c->build();
+
+    win.set_signal(true);
+    propagate();
+    TEST_EXPECT(true == wout.get_signal());
+    win.set_signal(false);
+    propagate();
+    TEST_EXPECT(false == wout.get_signal());
+
+    remove(cache_path);
+}
+
+/**
+ * A module with a pullup is read back from the cache.
+ */
+TEST(pull_round_trip)
+{
+    string source =
+        R"TEST(
+            module pulled {
+                component u1 { type inverter }
+                wire in { u1.pin["a"] pullup { } }
+                export wire out { u1.pin["y"] }
+            }
+        )TEST";
+    uint64_t hash = write_test_cache(source);
+
+    auto analyzer =
+        semantic_analyzer::read_cache(
+            make_shared<environment>(), cache_path, hash);
+    TEST_ASSERT(!!analyzer);
+
+    auto c = analyzer->extract_component();
+    TEST_EXPECT(1 == c->pins());
+
+    remove(cache_path);
+}
+
+/**
+ * Arrays are bound by element when read back from the cache.
+ */
+TEST(array_round_trip)
+{
+    uint64_t hash =
+        write_test_cache(
+            R"TEST(
+                module inv4 {
+                    component inv[4] { type inverter }
+                    export wire in { inv[0:3].pin["a"] }
+                    export wire out[4] { inv[3:0].pin["y"] }
+                }
+            )TEST");
+    wire win, wout[4];
+
+    auto analyzer =
+        semantic_analyzer::read_cache(
+            make_shared<environment>(), cache_path, hash);
+    TEST_ASSERT(!!analyzer);
+
+    auto c = analyzer->extract_component();
+    TEST_ASSERT(5 == c->pins());
+    c->set_pin("in", &win);
+    for (int i = 0; i < 4; ++i)
+        c->set_pin("out[" + to_string(i) + "]", &wout[i]);
+    c->build();
+
+    /* in drives every inverter. */
+    win.set_signal(true);
+    propagate();
+    for (int i = 0; i < 4; ++i)
+        TEST_EXPECT(false == wout[i].get_signal());
+    win.set_signal(false);
+    propagate();
+    for (int i = 0; i < 4; ++i)
+        TEST_EXPECT(true == wout[i].get_signal());
+
+    remove(cache_path);
+}
+
+/**
+ * A cache written for different source text is ignored.
+ */
+TEST(stale_hash)
+{
+    uint64_t hash = write_test_cache(inv2_source);
+
+    TEST_EXPECT(
+        nullptr
+            == semantic_analyzer::read_cache(
+                make_shared<environment>(), cache_path, hash + 1));
+
+    remove(cache_path);
+}
+
+/**
+ * A missing or corrupt cache is ignored.
+ */
+TEST(corrupt_cache)
+{
+    uint64_t hash = write_test_cache(inv2_source);
+
+    /* flip a byte past the header. */
+    {
+        fstream file(cache_path, ios::in | ios::out | ios::binary);
+        file.seekg(sizeof(netlist_cache_header) + 16);
+        char ch = file.get();
+        file.seekp(sizeof(netlist_cache_header) + 16);
+        file.put(ch ^ 0x55);
+    }
+
+    TEST_EXPECT(
+        nullptr
+            == semantic_analyzer::read_cache(
+                make_shared<environment>(), cache_path, hash));
+
+    remove(cache_path);
+
+    TEST_EXPECT(
+        nullptr
+            == semantic_analyzer::read_cache(
+                make_shared<environment>(), cache_path, hash));
+}
+
+/**
+ * A module that fails analysis is not cached.
+ */
+TEST(invalid_module)
+{
+    string source =
+        R"TEST(
+            module foo {
+                component u1 { type and_gate }
+                wire w1 { u1.pin["y"] u2.pin["a"] }
+            }
+        )TEST";
+
+    remove(cache_path);
+
+    try
+    {
+        write_test_cache(source);
+        TEST_FAILURE();
+    }
+    catch (semantic_error& e)
+    {
+        TEST_SUCCESS();
+    }
+
+    TEST_EXPECT(
+        nullptr
+            == semantic_analyzer::read_cache(
+                make_shared<environment>(), cache_path,
+                netlist_cache_hash(
+                    source.data(), source.data() + source.size())));
+}
+
+/**
+ * \brief Read the test cache into a string.
+ */
+static string read_test_cache()
+{
+    ifstream in(cache_path, ios::binary);
+    stringstream out;
+    out << in.rdbuf();
+
+    return out.str();
+}
+
+/**
+ * \brief Write a patched test cache, with its checksum updated to match.
+ */
+static void patch_test_cache(string data)
+{
+    netlist_cache_header header;
+    memcpy(&header, data.data(), sizeof(header));
+    header.checksum =
+        netlist_cache_hash(
+            data.data() + sizeof(header), data.data() + data.size());
+    memcpy(&data[0], &header, sizeof(header));
+
+    ofstream out(cache_path, ios::binary);
+    out.write(data.data(), data.size());
+}
+
+/**
+ * \brief Get the offset of the section after the one at the given offset.
+ */
+static size_t skip_section(const string& data, size_t pos, size_t record)
+{
+    uint64_t count;
+    memcpy(&count, data.data() + pos, sizeof(count));
+
+    return pos + sizeof(count) + ((count * record + 7) & ~size_t(7));
+}
+
+/**
+ * A cache with an index out of range is ignored, even if its checksum
+ * matches.
+ */
+TEST(bad_index)
+{
+    uint64_t hash = write_test_cache(inv2_source);
+    string data = read_test_cache();
+
+    /* the module name. */
+    {
+        string bad = data;
+        int32_t name = 1000;
+        memcpy(
+            &bad[offsetof(netlist_cache_header, name)], &name, sizeof(name));
+        patch_test_cache(bad);
+
+        TEST_EXPECT(
+            nullptr
+                == semantic_analyzer::read_cache(
+                    make_shared<environment>(), cache_path, hash));
+    }
+
+    /* the configs of the first component. */
+    {
+        string bad = data;
+        size_t pos = sizeof(netlist_cache_header);
+        pos = skip_section(bad, pos, sizeof(uint64_t));
+        pos = skip_section(bad, pos, sizeof(char));
+        pos = skip_section(bad, pos, sizeof(int));
+        pos += sizeof(uint64_t) + offsetof(flat_ast_component, config_count);
+        int count = 1000;
+        memcpy(&bad[pos], &count, sizeof(count));
+        patch_test_cache(bad);
+
+        TEST_EXPECT(
+            nullptr
+                == semantic_analyzer::read_cache(
+                    make_shared<environment>(), cache_path, hash));
+    }
+
+    /* the count of the first component, which would size the netlist. */
+    {
+        string bad = data;
+        size_t pos = sizeof(netlist_cache_header);
+        pos = skip_section(bad, pos, sizeof(uint64_t));
+        pos = skip_section(bad, pos, sizeof(char));
+        pos = skip_section(bad, pos, sizeof(int));
+        pos += sizeof(uint64_t) + offsetof(flat_ast_component, count);
+        int count = 1 << 30;
+        memcpy(&bad[pos], &count, sizeof(count));
+        patch_test_cache(bad);
+
+        TEST_EXPECT(
+            nullptr
+                == semantic_analyzer::read_cache(
+                    make_shared<environment>(), cache_path, hash));
+    }
+
+    /* the unpatched cache still reads. */
+    patch_test_cache(data);
+    TEST_EXPECT(
+        nullptr
+            != semantic_analyzer::read_cache(
+                make_shared<environment>(), cache_path, hash));
+
+    remove(cache_path);
+}
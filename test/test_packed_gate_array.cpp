@@ -0,0 +1,109 @@
+/**
+ * \file test/test_packed_gate_array.cpp
+ *
+ * \brief Unit tests for the packed gate array.
+ *
+ * \copyright Copyright 2021 Justin Handville.  All rights reserved.
+ */
+#include <homesim/ic/packed_gate_array.h>
+#include <minunit/minunit.h>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(packed_gate_array);
+
+/**
+ * \brief Run the global agenda to completion, counting the events performed.
+ */
+static int count_events()
+{
+    int count = 0;
+
+    for (;;)
+    {
+        auto a = global_agenda.next();
+        if (!a.first)
+            return count;
+
+        global_agenda.pop();
+        a.second();
+        ++count;
+    }
+}
+
+/**
+ * Every gate in the array is evaluated by the packed gate function.
+ */
+TEST(evaluate)
+{
+    wire a1, a2, b1, b2, y1, y2;
+
+    packed_gate_array gates(
+        {&a1, &a2}, {&b1, &b2}, {&y1, &y2},
+        [](uint32_t a, uint32_t b) -> uint32_t { return a & b; },
+        1.0);
+
+    propagate();
+    TEST_EXPECT(false == y1.get_signal());
+    TEST_EXPECT(false == y2.get_signal());
+
+    a1.set_signal(true);
+    b1.set_signal(true);
+    a2.set_signal(true);
+    propagate();
+    TEST_EXPECT(true == y1.get_signal());
+    TEST_EXPECT(false == y2.get_signal());
+
+    b2.set_signal(true);
+    propagate();
+    TEST_EXPECT(true == y1.get_signal());
+    TEST_EXPECT(true == y2.get_signal());
+}
+
+/**
+ * Single input gates only use the A inputs.
+ */
+TEST(single_input)
+{
+    wire a1, a2, y1, y2;
+
+    packed_gate_array gates(
+        {&a1, &a2}, {}, {&y1, &y2},
+        [](uint32_t a, uint32_t) -> uint32_t { return ~a; },
+        1.0);
+
+    propagate();
+    TEST_EXPECT(true == y1.get_signal());
+    TEST_EXPECT(true == y2.get_signal());
+
+    a2.set_signal(true);
+    propagate();
+    TEST_EXPECT(true == y1.get_signal());
+    TEST_EXPECT(false == y2.get_signal());
+}
+
+/**
+ * Input changes in the same instant share a single update event.
+ */
+TEST(coalesce_updates)
+{
+    wire a1, a2, b1, b2, y1, y2;
+
+    packed_gate_array gates(
+        {&a1, &a2}, {&b1, &b2}, {&y1, &y2},
+        [](uint32_t a, uint32_t b) -> uint32_t { return a | b; },
+        1.0);
+
+    /* construction schedules a single initial update. */
+    TEST_EXPECT(1 == count_events());
+
+    /* four input changes in the same instant cause one update. */
+    a1.set_signal(true);
+    b1.set_signal(true);
+    a2.set_signal(true);
+    b2.set_signal(true);
+    TEST_EXPECT(1 == count_events());
+    TEST_EXPECT(true == y1.get_signal());
+    TEST_EXPECT(true == y2.get_signal());
+}
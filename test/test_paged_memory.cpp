@@ -0,0 +1,183 @@
+/**
+ * \file test/test_paged_memory.cpp
+ *
+ * \brief Unit tests for paged memory.
+ *
+ * \copyright Copyright 2021 Justin Handville.  All rights reserved.
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <homesim/ic/paged_memory.h>
+#include <minunit/minunit.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(paged_memory);
+
+/**
+ * Invalid configurations throw a memory_error.
+ */
+TEST(invalid_configuration)
+{
+    try
+    {
+        paged_memory mem(16, 12);
+        TEST_FAILURE();
+    }
+    catch (memory_error& e)
+    {
+        TEST_SUCCESS();
+    }
+
+    try
+    {
+        paged_memory mem(0, 8);
+        TEST_FAILURE();
+    }
+    catch (memory_error& e)
+    {
+        TEST_SUCCESS();
+    }
+
+    try
+    {
+        paged_memory mem(16, 8, 1000);
+        TEST_FAILURE();
+    }
+    catch (memory_error& e)
+    {
+        TEST_SUCCESS();
+    }
+}
+
+/**
+ * A large memory starts empty, and only allocates the pages written.
+ */
+TEST(sparse_pages)
+{
+    paged_memory mem(24, 32);
+
+    TEST_EXPECT(24 == mem.address_bits());
+    TEST_EXPECT(32 == mem.word_bits());
+    TEST_EXPECT(64UL * 1024UL * 1024UL == mem.size());
+    TEST_EXPECT(0 == mem.pages());
+
+    /* unwritten memory reads as zero. */
+    TEST_EXPECT(0 == mem.read(12345));
+
+    /* writing zero doesn't allocate a page. */
+    mem.write(12345, 0);
+    TEST_EXPECT(0 == mem.pages());
+
+    /* writing a word allocates a single page. */
+    mem.write(12345, 0xDEADBEEF);
+    TEST_EXPECT(1 == mem.pages());
+    TEST_EXPECT(0xDEADBEEF == mem.read(12345));
+    TEST_EXPECT(0 == mem.read(12344));
+    TEST_EXPECT(0 == mem.read(12346));
+
+    /* a write far away allocates one more page. */
+    mem.write(0xFFFFFF, 0x12345678);
+    TEST_EXPECT(2 == mem.pages());
+    TEST_EXPECT(0x12345678 == mem.read(0xFFFFFF));
+    TEST_EXPECT(0xDEADBEEF == mem.read(12345));
+}
+
+/**
+ * Words are truncated to the word width and stored little endian.
+ */
+TEST(word_width)
+{
+    paged_memory mem(8, 16);
+
+    mem.write(1, 0xABCD1234);
+    TEST_EXPECT(0x1234 == mem.read(1));
+}
+
+/**
+ * Address bits above the width of the memory are ignored, so an out of range
+ * access wraps around, and a dump stays within the image.
+ */
+TEST(address_wraps)
+{
+    char path[] = "/tmp/test_paged_memory_XXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT(fd >= 0);
+    close(fd);
+
+    paged_memory mem(8, 16, 64);
+
+    mem.write(0x1003, 0xBEEF);
+    TEST_EXPECT(1 == mem.pages());
+    TEST_EXPECT(0xBEEF == mem.read(3));
+    TEST_EXPECT(0xBEEF == mem.read(0x7703));
+
+    /* the dump holds the word at its wrapped address. */
+    mem.dump(path);
+
+    ifstream in(path, ios::binary | ios::ate);
+    TEST_EXPECT(mem.size() == static_cast<size_t>(in.tellg()));
+    in.close();
+
+    paged_memory copy(8, 16, 64);
+    copy.load(path);
+    TEST_EXPECT(1 == copy.pages());
+    TEST_EXPECT(0xBEEF == copy.read(3));
+
+    unlink(path);
+}
+
+/**
+ * Memory can be loaded from and dumped to a binary file.
+ */
+TEST(load_dump)
+{
+    char path[] = "/tmp/test_paged_memory_XXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT(fd >= 0);
+    close(fd);
+
+    /* write an image with a zero page followed by a non-zero word. */
+    vector<uint8_t> bytes(8192, 0);
+    bytes[4096] = 0x34;
+    bytes[4097] = 0x12;
+    {
+        ofstream out(path, ios::binary);
+        out.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    }
+
+    /* load the image at an offset; only the non-zero page is allocated. */
+    paged_memory mem(16, 16);
+    mem.load(path, 2);
+    TEST_EXPECT(1 == mem.pages());
+    TEST_EXPECT(0x1234 == mem.read(2049));
+
+    /* dump the memory and load it back into a fresh memory. */
+    mem.write(7, 0x5555);
+    mem.dump(path);
+
+    paged_memory copy(16, 16);
+    copy.load(path);
+    TEST_EXPECT(2 == copy.pages());
+    TEST_EXPECT(0x1234 == copy.read(2049));
+    TEST_EXPECT(0x5555 == copy.read(7));
+    TEST_EXPECT(0 == copy.read(8));
+
+    /* an image larger than the memory can't be loaded. */
+    paged_memory small(4, 8);
+    try
+    {
+        small.load(path);
+        TEST_FAILURE();
+    }
+    catch (memory_error& e)
+    {
+        TEST_SUCCESS();
+    }
+
+    unlink(path);
+}
@@ -0,0 +1,73 @@
+/**
+ * \file test/test_parallel.cpp
+ *
+ * \brief Unit tests for parallel_for.
+ *
+ * \copyright Copyright 2021 Justin Handville. All rights reserved.
+ */
+#include <homesim/parallel.h>
+#include <minunit/minunit.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(parallel);
+
+/**
+ * The body runs exactly once for each index, whatever the worker count.
+ */
+TEST(every_index)
+{
+    for (unsigned workers : { 0U, 1U, 4U, 64U })
+    {
+        vector<int> hits(1000, 0);
+
+        parallel_for(
+            hits.size(), [&](size_t i) { ++hits[i]; }, workers);
+
+        for (auto h : hits)
+            TEST_EXPECT(1 == h);
+    }
+}
+
+/**
+ * An empty loop does nothing.
+ */
+TEST(empty)
+{
+    bool called = false;
+
+    parallel_for(0, [&](size_t) { called = true; }, 4);
+
+    TEST_EXPECT(!called);
+}
+
+/**
+ * The exception from the lowest failing index is the one rethrown.
+ */
+TEST(lowest_exception)
+{
+    for (unsigned workers : { 1U, 8U })
+    {
+        try
+        {
+            parallel_for(
+                100,
+                [](size_t i) {
+                    if (0 == i % 10 && i > 0)
+                        throw runtime_error(to_string(i));
+                },
+                workers);
+
+            /* the failures should have been rethrown. */
+            TEST_FAILURE();
+        }
+        catch (runtime_error& e)
+        {
+            TEST_EXPECT(string("10") == e.what());
+        }
+    }
+}
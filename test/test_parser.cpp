@@ -5,10 +5,12 @@
  *
  * \copyright Copyright 2020 Justin Handville. All rights reserved.
  */
+#include <homesim/flat_ast.h>
 #include <homesim/parser.h>
 #include <memory>
 #include <minunit/minunit.h>
 #include <sstream>
+#include <vector>
 
 using namespace homesim;
 using namespace std;
@@ -1171,3 +1173,112 @@ TEST(step_after_ns_27_with_expectation)
     TEST_EXPECT(HOMESIM_TOKEN_KEYWORD_TRUE == assertion->rhs->type());
     TEST_EXPECT(string("true") == assertion->rhs->eval());
 }
+
+/**
+ * A module can be parsed directly from a buffer.
+ */
+TEST(buffer_module)
+{
+    const string VALUE =
+        "module foo { component u1 { type and_gate } "
+        "wire w { u1.pin[\"a\"] } }";
+    parser p(VALUE.data(), VALUE.data() + VALUE.size());
+
+    auto res = p.parse();
+
+    TEST_EXPECT(string("foo") == res->name);
+    TEST_ASSERT(1 == res->component_map.size());
+    TEST_EXPECT(
+        string("and_gate") == *res->component_map.begin()->second->type);
+    TEST_ASSERT(1 == res->wire_map.size());
+    TEST_EXPECT(
+        string("a")
+            == res->wire_map.begin()->second->connection_list.front()->pin);
+}
+
+/**
+ * An unexpected token reports the position and the expected choices.
+ */
+TEST(choice_error_message)
+{
+    stringstream in("module foo {\n  component u1 { pin }\n}");
+    parser p(in);
+
+    try
+    {
+        p.parse();
+
+        /* we expected an exception to be thrown, and it wasn't. */
+        TEST_FAILURE();
+    }
+    catch (parser_error& e)
+    {
+        TEST_EXPECT(string(e.what()).find("Error at 2:18: ") == 0);
+        TEST_EXPECT(string::npos != string(e.what()).find("Got pin."));
+    }
+}
+
+/**
+ * \brief A listener that records the parse events it receives.
+ */
+class event_recorder : public module_listener
+{
+public:
+    vector<string> events;
+
+    virtual void on_module(const flat_module& mod) override
+    {
+        events.push_back("module " + mod.symbols.str(mod.name));
+    }
+
+    virtual void on_component(const flat_module& mod, int c) override
+    {
+        events.push_back(
+            "component " + mod.symbols.str(mod.components[c].name));
+    }
+
+    virtual void on_wire(const flat_module& mod, int w) override
+    {
+        events.push_back("wire " + mod.symbols.str(mod.wires[w].name));
+    }
+
+    virtual void on_connection(
+        const flat_module& mod, int w, int conn) override
+    {
+        events.push_back(
+            "connection " + mod.symbols.str(mod.wires[w].name) + " "
+          + mod.symbols.str(mod.connections[conn].component));
+    }
+
+    virtual void on_module_end(const flat_module&) override
+    {
+        events.push_back("end");
+    }
+};
+
+/**
+ * The parser announces nodes to a listener in source order.
+ */
+TEST(listener_events)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component u1 { type and_gate }
+                export wire w1 { u1.pin["y"] u2.pin["a"] }
+                component u2 { type inverter }
+            }
+        )TEST");
+    parser p(in);
+    event_recorder recorder;
+
+    auto mod = p.parse_flat(recorder);
+
+    vector<string> expected{
+        "module foo", "component u1", "wire w1", "connection w1 u1",
+        "connection w1 u2", "component u2", "end" };
+    TEST_EXPECT(expected == recorder.events);
+    TEST_ASSERT(1 == mod->wires.size());
+    TEST_EXPECT(mod->wires[0].exported);
+    TEST_EXPECT(2 == mod->wires[0].connection_count);
+}
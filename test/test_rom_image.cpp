@@ -0,0 +1,82 @@
+/**
+ * \file test/test_rom_image.cpp
+ *
+ * \brief Unit tests for the ROM image.
+ *
+ * \copyright Copyright 2021 Justin Handville.  All rights reserved.
+ */
+
+#include <cstdlib>
+#include <homesim/ic/rom_image.h>
+#include <minunit/minunit.h>
+#include <unistd.h>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(rom_image);
+
+/**
+ * A ROM image can take ownership of a byte vector.
+ */
+TEST(owned_bytes)
+{
+    rom_image image(vector<uint8_t>{ 1, 2, 3 });
+
+    TEST_ASSERT(3 == image.size());
+    TEST_EXPECT(1 == image[0]);
+    TEST_EXPECT(2 == image[1]);
+    TEST_EXPECT(3 == image[2]);
+}
+
+/**
+ * A ROM image can share a byte vector without copying it.
+ */
+TEST(shared_bytes)
+{
+    auto bytes = make_shared<const vector<uint8_t>>(vector<uint8_t>{ 4, 5 });
+    rom_image image(bytes);
+
+    TEST_ASSERT(2 == image.size());
+    TEST_EXPECT(bytes->data() == image.data());
+    TEST_EXPECT(5 == image[1]);
+}
+
+/**
+ * A ROM image can be written to a file and mapped back into memory.
+ */
+TEST(mapped_file)
+{
+    char path[] = "/tmp/test_rom_image_XXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT(fd >= 0);
+    close(fd);
+
+    write_rom_image(path, vector<uint8_t>{ 9, 8, 7, 6 });
+
+    {
+        rom_image image{string(path)};
+
+        TEST_EXPECT(4 == image.size());
+        TEST_EXPECT(9 == image[0]);
+        TEST_EXPECT(6 == image[3]);
+    }
+
+    unlink(path);
+}
+
+/**
+ * Mapping a missing file throws a rom_image_error.
+ */
+TEST(missing_file)
+{
+    try
+    {
+        rom_image image{string("/nonexistent/homesim/rom.bin")};
+        TEST_FAILURE();
+    }
+    catch (rom_image_error& e)
+    {
+        TEST_SUCCESS();
+    }
+}
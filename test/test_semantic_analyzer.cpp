@@ -5,11 +5,16 @@
  *
  * \copyright Copyright 2020 Justin Handville. All rights reserved.
  */
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <homesim/agenda.h>
 #include <homesim/environment.h>
 #include <homesim/semantic_analyzer.h>
 #include <iostream>
 #include <memory>
 #include <minunit/minunit.h>
+#include <set>
 #include <sstream>
 #include "test_component.h"
 
@@ -284,3 +289,964 @@ TEST(double_bound_pin)
         TEST_SUCCESS();
     }
 }
+
+/**
+ * Built-in parts can be instantiated, configured, and wired.
+ */
+TEST(builtin_component)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component u1 {
+                    type ic7400
+                    config["propagation_delay"] := ns(10)
+                }
+                wire bar {
+                    u1.pin["1a"]
+                    u1.pin["1b"]
+                }
+            }
+        )TEST");
+    parser p(in);
+    auto ast = p.parse();
+    auto en = make_shared<environment>();
+
+    semantic_analyzer analyzer(en, ast);
+
+    auto sim = analyzer.extract_simulation();
+    TEST_EXPECT(!!sim);
+}
+
+/**
+ * Unknown configuration for a built-in part is a semantic error.
+ */
+TEST(builtin_component_bad_config)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component u1 {
+                    type ic7400
+                    config["flux_capacitance"] := 0.1
+                }
+            }
+        )TEST");
+    parser p(in);
+    auto ast = p.parse();
+    auto en = make_shared<environment>();
+
+    semantic_analyzer analyzer(en, ast);
+
+    try
+    {
+        /* this should throw an exception. */
+        auto sim = analyzer.extract_simulation();
+
+        /* if we've made it this far, we've failed. */
+        TEST_FAILURE();
+    } catch (semantic_error& e)
+    {
+        TEST_SUCCESS();
+    }
+}
+
+/**
+ * A streamed module is analyzed as it is parsed, including wires that refer
+ * to components defined after them.
+ */
+TEST(analyze_stream)
+{
+    stringstream in(
+        R"TEST(
+            module inv2 {
+                export wire in { u1.pin["a"] }
+                component u1 { type inverter }
+                wire mid { u1.pin["y"] u2.pin["a"] }
+                component u2 { type inverter }
+                export wire out { u2.pin["y"] }
+            }
+        )TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+
+    auto analyzer = semantic_analyzer::analyze_stream(en, p);
+
+    auto c = analyzer->extract_component();
+    TEST_EXPECT(2 == c->pins());
+}
+
+/**
+ * A streamed module reports the same errors as a parsed one.
+ */
+TEST(analyze_stream_unknown_component)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component u1 { type and_gate }
+                wire w1 { u1.pin["y"] u2.pin["a"] }
+            }
+        )TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+
+    try
+    {
+        semantic_analyzer::analyze_stream(en, p);
+
+        /* the unknown component should have been reported. */
+        TEST_FAILURE();
+    }
+    catch (semantic_error& e)
+    {
+        TEST_EXPECT(
+            string("In wire w1: reference to unknown component u2.")
+                == e.what());
+    }
+}
+
+/**
+ * A streamed module stops at the first error, even mid-parse.
+ */
+TEST(analyze_stream_bad_pin)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component u1 { type and_gate }
+                wire w1 { u1.pin["q"] }
+                this is not valid
+            }
+        )TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+
+    try
+    {
+        semantic_analyzer::analyze_stream(en, p);
+
+        /* the bad pin should have been reported before the parse error. */
+        TEST_FAILURE();
+    }
+    catch (semantic_error& e)
+    {
+        TEST_EXPECT(
+            string("In wire w1: reference to unknown pin u1.pin[\"q\"].")
+                == e.what());
+    }
+}
+
+/**
+ * Wire and component arrays expand to an element per index.
+ */
+TEST(analyze_arrays)
+{
+    stringstream in(
+        R"TEST(
+            module inv4 {
+                export wire in[4] { inv[0:3].pin["a"] }
+                export wire out[4] { inv[3:0].pin["y"] }
+                component inv[4] { type inverter }
+            }
+        )TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+    wire win[4], wout[4];
+
+    auto analyzer = semantic_analyzer::analyze_stream(en, p);
+
+    auto c = analyzer->extract_component();
+    TEST_ASSERT(8 == c->pins());
+    for (int i = 0; i < 4; ++i)
+    {
+        c->set_pin("in[" + to_string(i) + "]", &win[i]);
+        c->set_pin("out[" + to_string(i) + "]", &wout[i]);
+    }
+    c->build();
+
+    /* out is wired in reverse. */
+    win[0].set_signal(true);
+    propagate();
+    TEST_EXPECT(false == wout[3].get_signal());
+    win[0].set_signal(false);
+    propagate();
+    TEST_EXPECT(true == wout[3].get_signal());
+}
+
+/**
+ * An element outside of a component array is an unknown component.
+ */
+TEST(analyze_arrays_unknown_element)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component inv[2] { type inverter }
+                wire en { inv[0:2].pin["a"] }
+            }
+        )TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+
+    try
+    {
+        semantic_analyzer::analyze_stream(en, p);
+        TEST_FAILURE();
+    }
+    catch (semantic_error& e)
+    {
+        TEST_EXPECT(
+            string("In wire en: reference to unknown component inv[2].")
+                == e.what());
+    }
+}
+
+/**
+ * A name may be declared once as a scalar and once as an array, but not
+ * twice as either.
+ */
+TEST(analyze_duplicate_names)
+{
+    const char* cases[][2] = {
+        { "component inv { type inverter }\n"
+          "component inv[2] { type inverter }\n"
+          "wire a { inv.pin[\"a\"] inv[1].pin[\"a\"] }\n",
+          "" },
+        { "component inv { type inverter }\n"
+          "component inv { type buffer }\n",
+          "Duplicate definition for component inv found." },
+        { "component inv[2] { type inverter }\n"
+          "component inv[4] { type inverter }\n",
+          "Duplicate definition for component inv[0] found." },
+        { "wire a[2] { }\n"
+          "wire a[2] { }\n",
+          "Duplicate definition for wire a[0] found." },
+    };
+
+    for (auto& c : cases)
+    {
+        stringstream in(string("module foo {\n") + c[0] + "}\n");
+        parser p(in);
+        auto en = make_shared<environment>();
+
+        try
+        {
+            semantic_analyzer::analyze_stream(en, p);
+            TEST_EXPECT(string() == c[1]);
+        }
+        catch (semantic_error& e)
+        {
+            TEST_EXPECT(string(c[1]) == e.what());
+        }
+    }
+}
+
+/**
+ * A scenario runs its repeat blocks in place, counting failed expectations.
+ */
+TEST(run_scenario_repeat)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component u1 { type inverter }
+                wire in { u1.pin["a"] }
+                wire out { u1.pin["y"] }
+                scenario toggle {
+                    execution 1 {
+                        at start { u1.pin["a"] := true }
+                        repeat 1000 {
+                            after ns(10) {
+                                expect wire.out.signal = false
+                                u1.pin["a"] := false
+                            }
+                            after ns(10) {
+                                expect wire.out.signal = true
+                                u1.pin["a"] := true
+                            }
+                        }
+                    }
+                }
+                scenario wrong {
+                    execution 1 {
+                        at start { u1.pin["a"] := false }
+                        repeat 3 {
+                            after ns(10) { expect wire.out.signal = false }
+                        }
+                    }
+                }
+            }
+        )TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+    stringstream log;
+
+    auto analyzer = semantic_analyzer::analyze_stream(en, p);
+
+    TEST_EXPECT(0 == analyzer->run_scenario("toggle", log));
+    TEST_EXPECT(20000e-9 - global_agenda.current_time() < 1e-12);
+    TEST_EXPECT(log.str().empty());
+
+    TEST_EXPECT(3 == analyzer->run_scenario("wrong", log));
+    TEST_EXPECT(
+        string::npos
+            != log.str().find(
+                "In scenario wrong, execution 1: expect wire.out.signal "
+                "= false failed at 1e-08 s."));
+}
+
+/**
+ * A failed assertion stops the scenario.
+ */
+TEST(run_scenario_assert)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component u1 { type inverter }
+                wire in { u1.pin["a"] }
+                wire out { u1.pin["y"] }
+                scenario x {
+                    execution 1 {
+                        at start { u1.pin["a"] := true }
+                        after ns(10) { assert wire.out.signal = true }
+                    }
+                }
+            }
+        )TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+    stringstream log;
+
+    auto analyzer = semantic_analyzer::analyze_stream(en, p);
+
+    try
+    {
+        analyzer->run_scenarios(log);
+        TEST_FAILURE();
+    }
+    catch (scenario_error& e)
+    {
+        string what = e.what();
+        TEST_EXPECT(
+            string::npos
+                != what.find(
+                    "In scenario x, execution 1: assert wire.out.signal "
+                    "= true failed at"));
+    }
+}
+
+/**
+ * A scenario can drive and check the elements of component and wire arrays.
+ */
+TEST(run_scenario_array_elements)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component inv[2] { type inverter }
+                wire in[2] { inv[0:1].pin["a"] }
+                wire out[2] { inv[0:1].pin["y"] }
+                scenario x {
+                    execution 1 {
+                        at start { inv[1].pin["a"] := true }
+                        after ns(10) {
+                            expect wire.out[0].signal = false
+                            expect wire.out[1].signal = false
+                            expect wire.out[1].signal = true
+                        }
+                    }
+                }
+                scenario missing {
+                    execution 1 {
+                        at start { inv[2].pin["a"] := true }
+                    }
+                }
+            }
+        )TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+    stringstream log;
+
+    auto analyzer = semantic_analyzer::analyze_stream(en, p);
+
+    /* only inv[1] is driven, so only the last expectation fails. */
+    TEST_EXPECT(1 == analyzer->run_scenario("x", log));
+    TEST_EXPECT(
+        string::npos
+            != log.str().find(
+                "In scenario x, execution 1: expect wire.out[1].signal "
+                "= true failed at"));
+
+    try
+    {
+        analyzer->run_scenario("missing", log);
+        TEST_FAILURE();
+    }
+    catch (scenario_error& e)
+    {
+        TEST_EXPECT(
+            string("In scenario missing, execution 1: reference to unknown "
+                   "component inv[2].")
+                == e.what());
+    }
+}
+
+/**
+ * A delay must be a time or a number of seconds.
+ */
+TEST(builtin_component_delay_type)
+{
+    stringstream in(
+        R"TEST(
+            module foo {
+                component u1 {
+                    type ic7400
+                    config["propagation_delay"] := "fast"
+                }
+            }
+        )TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+
+    try
+    {
+        semantic_analyzer::analyze_stream(en, p);
+        TEST_FAILURE();
+    }
+    catch (semantic_error& e)
+    {
+        TEST_EXPECT(
+            string("In component u1: Config propagation_delay must be a delay "
+                   "in seconds.")
+                == e.what());
+    }
+}
+
+/**
+ * \brief Write a module file for an import test.
+ */
+static void write_module(const char* path, const string& source)
+{
+    ofstream out(path);
+    out << source;
+}
+
+/**
+ * An imported module is a component type, parsed once and shared by every
+ * instance.
+ */
+TEST(import_module)
+{
+    write_module(
+        "test_import_inv2.hs",
+        R"TEST(
+            module inv2 {
+                component u1 { type inverter }
+                component u2 { type inverter }
+                export wire in { u1.pin["a"] }
+                wire mid { u1.pin["y"] u2.pin["a"] }
+                export wire out { u2.pin["y"] }
+            }
+        )TEST");
+    stringstream in(
+        R"TEST(
+            module top {
+                import "test_import_inv2.hs"
+                component a { type inv2 }
+                component b { type inv2 }
+                wire in { a.pin["in"] }
+                wire mid { a.pin["out"] b.pin["in"] }
+                wire out { b.pin["out"] }
+                scenario pass {
+                    execution 1 {
+                        at start { a.pin["in"] := true }
+                        after ns(100) { a.pin["in"] := false }
+                        after ns(100) { a.pin["in"] := true }
+                        after ns(100) {
+                            expect wire.mid.signal = true
+                            a.pin["in"] := false
+                        }
+                        after ns(100) { a.pin["in"] := true }
+                        after ns(100) { expect wire.out.signal = true }
+                    }
+                }
+            }
+        )TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+    stringstream log;
+
+    auto analyzer = semantic_analyzer::analyze_stream(en, p);
+    string canonical =
+        filesystem::weakly_canonical("test_import_inv2.hs").string();
+    auto def = en->find_import(canonical);
+    TEST_ASSERT(nullptr != def);
+    TEST_EXPECT(en->get_component_factory().contains("inv2"));
+
+    /* a second module importing the same file reuses the definition. */
+    stringstream in2(
+        R"TEST(
+            module other {
+                import "./test_import_inv2.hs"
+                component c { type inv2 }
+            }
+        )TEST");
+    parser p2(in2);
+    semantic_analyzer::analyze_stream(en, p2);
+    TEST_EXPECT(def == en->find_import(canonical));
+
+    TEST_EXPECT(0 == analyzer->run_scenario("pass", log));
+    TEST_EXPECT(log.str().empty());
+
+    remove("test_import_inv2.hs");
+}
+
+/**
+ * A module that imports itself, directly or not, is an error.
+ */
+TEST(import_circular)
+{
+    write_module(
+        "test_import_a.hs",
+        R"TEST(module a { import "test_import_b.hs" })TEST");
+    write_module(
+        "test_import_b.hs",
+        R"TEST(module b { import "test_import_a.hs" })TEST");
+    stringstream in(R"TEST(module top { import "test_import_a.hs" })TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+
+    try
+    {
+        semantic_analyzer::analyze_stream(en, p);
+
+        /* the circular import should have been reported. */
+        TEST_FAILURE();
+    }
+    catch (semantic_error& e)
+    {
+        TEST_EXPECT(
+            string(
+                "In import test_import_a.hs: In import test_import_b.hs: "
+                "Circular import of test_import_a.hs.")
+                    == e.what());
+    }
+
+    remove("test_import_a.hs");
+    remove("test_import_b.hs");
+}
+
+/**
+ * Importing a missing file is an error.
+ */
+TEST(import_missing)
+{
+    stringstream in(R"TEST(module top { import "test_import_none.hs" })TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+
+    try
+    {
+        semantic_analyzer::analyze_stream(en, p);
+
+        /* the missing file should have been reported. */
+        TEST_FAILURE();
+    }
+    catch (semantic_error& e)
+    {
+        TEST_EXPECT(string("Can't import test_import_none.hs.") == e.what());
+    }
+}
+
+/**
+ * \brief Write a library of imported modules: a row of leaves, each imported
+ * by a row of pairs, all imported by a single top module.  Leaves named in
+ * broken are given an unknown component type.
+ */
+static void write_library(int leaves, const set<int>& broken)
+{
+    for (int i = 0; i < leaves; ++i)
+    {
+        string type = broken.count(i) ? "widget" : "inverter";
+        write_module(
+            ("test_lib_leaf" + to_string(i) + ".hs").c_str(),
+            "module leaf" + to_string(i) + " {\n"
+            "    component u1 { type " + type + " }\n"
+            "    export wire in { u1.pin[\"a\"] }\n"
+            "    export wire out { u1.pin[\"y\"] }\n"
+            "}\n");
+    }
+
+    string top = "module lib {\n";
+    for (int i = 0; i + 1 < leaves; i += 2)
+    {
+        string pair = "pair" + to_string(i);
+        string a = "leaf" + to_string(i), b = "leaf" + to_string(i + 1);
+        write_module(
+            ("test_lib_" + pair + ".hs").c_str(),
+            "module " + pair + " {\n"
+            "    import \"test_lib_" + a + ".hs\"\n"
+            "    import \"test_lib_" + b + ".hs\"\n"
+            "    component a { type " + a + " }\n"
+            "    component b { type " + b + " }\n"
+            "    export wire in { a.pin[\"in\"] }\n"
+            "    wire mid { a.pin[\"out\"] b.pin[\"in\"] }\n"
+            "    export wire out { b.pin[\"out\"] }\n"
+            "}\n");
+        top += "    import \"test_lib_" + pair + ".hs\"\n";
+        top += "    component " + pair + " { type " + pair + " }\n";
+    }
+    top += "}\n";
+    write_module("test_lib.hs", top);
+}
+
+/**
+ * \brief Remove the library written by write_library.
+ */
+static void remove_library(int leaves)
+{
+    for (int i = 0; i < leaves; ++i)
+    {
+        remove(("test_lib_leaf" + to_string(i) + ".hs").c_str());
+        if (0 == i % 2)
+            remove(("test_lib_pair" + to_string(i) + ".hs").c_str());
+    }
+    remove("test_lib.hs");
+}
+
+/**
+ * \brief Import the library with the given number of workers.
+ *
+ * \returns the error message, or an empty string on success.
+ */
+static string import_library(unsigned workers)
+{
+    stringstream in(R"TEST(module top { import "test_lib.hs" })TEST");
+    parser p(in);
+    auto en = make_shared<environment>();
+    en->set_worker_count(workers);
+
+    try
+    {
+        semantic_analyzer::analyze_stream(en, p);
+        return en->get_component_factory().contains("lib") ? "" : "missing";
+    }
+    catch (semantic_error& e)
+    {
+        return e.what();
+    }
+}
+
+/**
+ * Imports are parsed and analyzed concurrently, with the same result as a
+ * single worker.
+ */
+TEST(import_parallel)
+{
+    write_library(32, {});
+
+    TEST_EXPECT(string() == import_library(1));
+    TEST_EXPECT(string() == import_library(8));
+
+    remove_library(32);
+}
+
+/**
+ * When several imports fail, the error reported does not depend on the
+ * number of workers.
+ */
+TEST(import_parallel_errors)
+{
+    write_library(32, { 5, 12, 30 });
+
+    string expected =
+        "In import test_lib.hs: In import test_lib_pair4.hs: "
+        "In import test_lib_leaf5.hs: Component type widget can't be "
+        "found.";
+
+    TEST_EXPECT(expected == import_library(1));
+    for (int i = 0; i < 8; ++i)
+        TEST_EXPECT(expected == import_library(8));
+
+    remove_library(32);
+}
+
+/**
+ * Sibling imports of a streamed module are imported together, with the same
+ * error as importing them one at a time.
+ */
+TEST(import_streamed_siblings)
+{
+    write_library(8, { 3, 6 });
+
+    string source =
+        "module top {\n"
+        "    import \"test_lib_pair0.hs\"\n"
+        "    import \"test_lib_pair2.hs\"\n"
+        "    import \"test_lib_pair4.hs\"\n"
+        "    import \"test_lib_pair6.hs\"\n"
+        "    component u1 { type pair0 }\n"
+        "}\n";
+    string expected =
+        "In import test_lib_pair2.hs: In import test_lib_leaf3.hs: "
+        "Component type widget can't be found.";
+
+    for (unsigned workers : { 1, 8 })
+    {
+        stringstream in(source);
+        parser p(in);
+        auto en = make_shared<environment>();
+        en->set_worker_count(workers);
+
+        try
+        {
+            semantic_analyzer::analyze_stream(en, p);
+            TEST_FAILURE();
+        }
+        catch (semantic_error& e)
+        {
+            TEST_EXPECT(expected == e.what());
+        }
+    }
+
+    remove_library(8);
+}
+
+/**
+ * \brief A two-stage module, with the second stage of the given type, and a
+ * scenario that expects the output to follow the given value.
+ */
+static string two_stage(const string& type, const string& expected)
+{
+    return
+        "module foo {\n"
+        "    component u1 { type inverter }\n"
+        "    component u2 { type " + type + " }\n"
+        "    wire in { u1.pin[\"a\"] }\n"
+        "    wire mid { u1.pin[\"y\"] u2.pin[\"a\"] }\n"
+        "    wire out { u2.pin[\"y\"] }\n"
+        "    scenario s {\n"
+        "        execution 1 {\n"
+        "            at start { u1.pin[\"a\"] := true }\n"
+        "            after ns(100) { u1.pin[\"a\"] := false }\n"
+        "            after ns(100) { expect wire.out.signal = "
+            + expected + " }\n"
+        "        }\n"
+        "    }\n"
+        "}\n";
+}
+
+/**
+ * \brief Parse a module from a string.
+ */
+static shared_ptr<flat_module> parse_string(const string& source)
+{
+    parser p(source.data(), source.data() + source.size());
+
+    return p.parse_flat();
+}
+
+/**
+ * Updating a netlist rebuilds only the components that changed.
+ */
+TEST(update)
+{
+    auto en = make_shared<environment>();
+    semantic_analyzer analyzer(
+        en, parse_string(two_stage("inverter", "false")));
+    stringstream log;
+
+    analyzer.enable_updates();
+    TEST_EXPECT(0 == analyzer.run_scenario("s", log));
+
+    /* an unchanged module keeps everything. */
+    auto same = analyzer.update(parse_string(two_stage("inverter", "false")));
+    TEST_EXPECT(2 == same.components_kept);
+    TEST_EXPECT(0 == same.components_built);
+    TEST_EXPECT(3 == same.wires_kept);
+    TEST_EXPECT(0 == same.wires_created);
+
+    /* the second stage becomes a buffer, so the output follows mid. */
+    auto changed = analyzer.update(parse_string(two_stage("buffer", "true")));
+    TEST_EXPECT(1 == changed.components_kept);
+    TEST_EXPECT(1 == changed.components_built);
+    TEST_EXPECT(0 == changed.components_removed);
+    TEST_EXPECT(3 == changed.wires_kept);
+    TEST_EXPECT(0 == changed.wires_removed);
+    TEST_EXPECT(0 == analyzer.run_scenario("s", log));
+    TEST_EXPECT(log.str().empty());
+}
+
+/**
+ * A failed update leaves the netlist as it was.
+ */
+TEST(update_error)
+{
+    auto en = make_shared<environment>();
+    semantic_analyzer analyzer(
+        en, parse_string(two_stage("inverter", "false")));
+    stringstream log;
+
+    analyzer.enable_updates();
+    TEST_EXPECT(0 == analyzer.run_scenario("s", log));
+
+    try
+    {
+        analyzer.update(parse_string(two_stage("widget", "true")));
+
+        /* the unknown type should have been reported. */
+        TEST_FAILURE();
+    }
+    catch (semantic_error& e)
+    {
+        TEST_EXPECT(
+            string("Component type widget can't be found.") == e.what());
+    }
+
+    TEST_EXPECT(0 == analyzer.run_scenario("s", log));
+    TEST_EXPECT(log.str().empty());
+
+    auto same = analyzer.update(parse_string(two_stage("inverter", "false")));
+    TEST_EXPECT(2 == same.components_kept);
+}
+
+/**
+ * An update that leaves a rebuilt component with an unbound pin leaves the
+ * netlist as it was.
+ */
+TEST(update_unbound_pin)
+{
+    auto en = make_shared<environment>();
+    semantic_analyzer analyzer(
+        en, parse_string(two_stage("inverter", "false")));
+    stringstream log;
+
+    analyzer.enable_updates();
+    TEST_EXPECT(0 == analyzer.run_scenario("s", log));
+
+    /* drop the output wire, so u2.pin["y"] is unbound. */
+    string source = two_stage("inverter", "false");
+    size_t out = source.find("    wire out");
+    source.erase(out, source.find("    scenario") - out);
+
+    try
+    {
+        analyzer.update(parse_string(source));
+
+        /* the unbound pin should have been reported. */
+        TEST_FAILURE();
+    }
+    catch (scenario_error& e)
+    {
+        TEST_EXPECT(string(e.what()).find("In component u2: ") == 0);
+    }
+
+    TEST_EXPECT(0 == analyzer.run_scenario("s", log));
+    TEST_EXPECT(log.str().empty());
+}
+
+/**
+ * An error building a component, such as a missing or unreadable ROM image,
+ * is reported with the name of the component.
+ */
+TEST(build_error_names_component)
+{
+    auto en = make_shared<environment>();
+    stringstream log;
+
+    semantic_analyzer missing(
+        en, parse_string(
+            "module foo {\n"
+            "    component r { type icrom }\n"
+            "    scenario s { execution 1 { at start { } } }\n"
+            "}\n"));
+
+    try
+    {
+        missing.run_scenario("s", log);
+        TEST_FAILURE();
+    }
+    catch (scenario_error& e)
+    {
+        TEST_EXPECT(
+            string("In component r: ROM requires config image.") == e.what());
+    }
+
+    semantic_analyzer unreadable(
+        en, parse_string(
+            "module foo {\n"
+            "    component r {\n"
+            "        type icrom\n"
+            "        config[\"image\"] := \"/nonexistent/rom.bin\"\n"
+            "    }\n"
+            "    scenario s { execution 1 { at start { } } }\n"
+            "}\n"));
+
+    try
+    {
+        unreadable.run_scenario("s", log);
+        TEST_FAILURE();
+    }
+    catch (scenario_error& e)
+    {
+        TEST_EXPECT(string(e.what()).find("In component r: ") == 0);
+    }
+}
+
+/**
+ * An error building a component during an update is reported with its name,
+ * and the netlist is left as it was.
+ */
+TEST(update_build_error)
+{
+    auto en = make_shared<environment>();
+    semantic_analyzer analyzer(
+        en, parse_string(two_stage("inverter", "false")));
+    stringstream log;
+
+    analyzer.enable_updates();
+    TEST_EXPECT(0 == analyzer.run_scenario("s", log));
+
+    /* add a ROM with no image. */
+    string source = two_stage("inverter", "false");
+    size_t wires = source.find("    wire in");
+    source.insert(wires, "    component r { type icrom }\n");
+
+    try
+    {
+        analyzer.update(parse_string(source));
+        TEST_FAILURE();
+    }
+    catch (scenario_error& e)
+    {
+        TEST_EXPECT(
+            string("In component r: ROM requires config image.") == e.what());
+    }
+
+    TEST_EXPECT(0 == analyzer.run_scenario("s", log));
+    TEST_EXPECT(log.str().empty());
+}
+
+/**
+ * Updates must be enabled before the netlist is built.
+ */
+TEST(update_not_enabled)
+{
+    auto en = make_shared<environment>();
+    semantic_analyzer analyzer(
+        en, parse_string(two_stage("inverter", "false")));
+
+    try
+    {
+        analyzer.update(parse_string(two_stage("buffer", "true")));
+
+        /* the update should have been refused. */
+        TEST_FAILURE();
+    }
+    catch (semantic_error& e)
+    {
+        TEST_EXPECT(string("Netlist updates are not enabled.") == e.what());
+    }
+}
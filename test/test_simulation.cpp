@@ -0,0 +1,236 @@
+/**
+ * \file test/test_simulation.cpp
+ *
+ * \brief Unit tests for simulations extracted from the analyzer.
+ *
+ * \copyright Copyright 2021 Justin Handville.  All rights reserved.
+ */
+#include <homesim/agenda.h>
+#include <homesim/environment.h>
+#include <homesim/semantic_analyzer.h>
+#include <homesim/simulation.h>
+#include <minunit/minunit.h>
+#include <sstream>
+
+using namespace homesim;
+using namespace std;
+
+TEST_SUITE(simulation);
+
+/**
+ * \brief Extract a simulation of a module.
+ */
+static shared_ptr<simulation> extract(const string& source)
+{
+    stringstream in(source);
+    parser p(in);
+    auto en = make_shared<environment>();
+
+    return semantic_analyzer::analyze_stream(en, p)->extract_simulation();
+}
+
+/**
+ * An empty simulation has no components or nets.
+ */
+TEST(empty)
+{
+    simulation sim;
+
+    TEST_EXPECT(0 == sim.component_count());
+    TEST_EXPECT(0 == sim.net_count());
+    TEST_EXPECT(-1 == sim.find_port("in"));
+    TEST_EXPECT(0.0 == sim.current_time());
+}
+
+/**
+ * A simulation drives its inputs and reads its outputs.
+ */
+TEST(set_input_run_get_signal)
+{
+    auto sim =
+        extract(R"TEST(
+            module foo {
+                component u1 { type inverter }
+                component u2 { type inverter }
+                wire in { signal source external u1.pin["a"] }
+                wire mid { u1.pin["y"] u2.pin["a"] }
+                export wire out { u2.pin["y"] }
+            }
+        )TEST");
+
+    TEST_EXPECT(2 == sim->component_count());
+    TEST_EXPECT(3 == sim->net_count());
+
+    /* only exported and external wires are ports. */
+    int in = sim->find_port("in");
+    int out = sim->find_port("out");
+    TEST_EXPECT(0 == in);
+    TEST_EXPECT(2 == out);
+    TEST_EXPECT(-1 == sim->find_port("mid"));
+
+    sim->set_input(in, true);
+    sim->run_until(1e-6);
+    TEST_EXPECT(1e-6 == sim->current_time());
+    TEST_EXPECT(true == sim->get_signal(out));
+    TEST_EXPECT(false == sim->get_signal(1));
+
+    sim->set_input("in", false);
+    sim->run_until(2e-6);
+    TEST_EXPECT(false == sim->get_signal("out"));
+    TEST_EXPECT(true == sim->get_signal(1));
+}
+
+/**
+ * A simulation runs on its own agenda, independent of the global agenda and
+ * of other simulations.
+ */
+TEST(own_agenda)
+{
+    const char* source =
+        R"TEST(
+            module foo {
+                component u1 { type inverter }
+                wire in { signal source external u1.pin["a"] }
+                export wire out { u1.pin["y"] }
+            }
+        )TEST";
+    auto a = extract(source);
+    auto b = extract(source);
+
+    global_agenda.clear();
+    bool ran = false;
+    global_agenda.add(1e-9, [&]() { ran = true; });
+
+    a->set_input("in", true);
+    a->run_until(1e-6);
+    TEST_EXPECT(false == a->get_signal("out"));
+    TEST_EXPECT(false == b->get_signal("out"));
+    TEST_EXPECT(0.0 == b->current_time());
+
+    /* the global agenda still holds its own event. */
+    TEST_EXPECT(!ran);
+    TEST_EXPECT(0.0 == global_agenda.current_time());
+    propagate();
+    TEST_EXPECT(ran);
+}
+
+/**
+ * The fanout of each net lists the component pins bound to it.
+ */
+TEST(fanout)
+{
+    auto sim =
+        extract(R"TEST(
+            module foo {
+                component inv[2] { type inverter }
+                export wire in[2] {
+                    signal source external
+                    inv[0:1].pin["a"]
+                }
+                wire out { inv[0:1].pin["y"] }
+            }
+        )TEST");
+
+    TEST_EXPECT(2 == sim->component_count());
+    TEST_EXPECT(3 == sim->net_count());
+    TEST_EXPECT(1 == sim->find_port("in[1]"));
+
+    auto f = sim->fanout(1);
+    TEST_ASSERT(1 == f.second - f.first);
+    TEST_EXPECT(1 == f.first->component);
+    TEST_EXPECT(0 == f.first->pin);
+
+    auto g = sim->fanout(2);
+    TEST_ASSERT(2 == g.second - g.first);
+    TEST_EXPECT(0 == g.first[0].component);
+    TEST_EXPECT(1 == g.first[1].component);
+    TEST_EXPECT(g.first[0].pin == g.first[1].pin);
+    TEST_EXPECT(g.first[0].pin != f.first->pin);
+}
+
+/**
+ * Only inputs can be driven, only ports can be read by name, and time only
+ * runs forward.
+ */
+TEST(errors)
+{
+    auto sim =
+        extract(R"TEST(
+            module foo {
+                component u1 { type inverter }
+                wire in { signal source external u1.pin["a"] }
+                export wire out { u1.pin["y"] }
+            }
+        )TEST");
+
+    try
+    {
+        sim->set_input("out", true);
+        TEST_FAILURE();
+    }
+    catch (simulation_error& e)
+    {
+        TEST_EXPECT(string("Wire out is not an input.") == e.what());
+    }
+
+    try
+    {
+        sim->set_input(1, true);
+        TEST_FAILURE();
+    }
+    catch (simulation_error& e)
+    {
+        TEST_EXPECT(string("Net 1 is not an input.") == e.what());
+    }
+
+    try
+    {
+        sim->get_signal("missing");
+        TEST_FAILURE();
+    }
+    catch (simulation_error& e)
+    {
+        TEST_EXPECT(string("Wire missing is not a port.") == e.what());
+    }
+
+    sim->run_until(1e-6);
+
+    try
+    {
+        sim->run_until(0.0);
+        TEST_FAILURE();
+    }
+    catch (simulation_error& e)
+    {
+    }
+
+    TEST_EXPECT(1e-6 == sim->current_time());
+}
+
+/**
+ * A pin left unconnected floats on a net of its own, after the module's nets.
+ */
+TEST(unconnected_pin)
+{
+    auto sim =
+        extract(R"TEST(
+            module foo {
+                component u1 { type inverter }
+                wire in { signal source external u1.pin["a"] }
+            }
+        )TEST");
+
+    TEST_EXPECT(1 == sim->component_count());
+    TEST_ASSERT(2 == sim->net_count());
+    TEST_EXPECT(-1 == sim->find_port("y"));
+
+    auto in = sim->fanout(0);
+    auto f = sim->fanout(1);
+    TEST_ASSERT(1 == f.second - f.first);
+    TEST_EXPECT(0 == f.first->component);
+    TEST_EXPECT(in.first->pin != f.first->pin);
+
+    sim->set_input("in", true);
+    sim->run_until(1e-6);
+    TEST_EXPECT(false == sim->get_signal(1));
+}
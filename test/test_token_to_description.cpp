@@ -122,6 +122,13 @@ TEST(keyword_false)
             token_to_description(HOMESIM_TOKEN_KEYWORD_FALSE));
 }
 
+TEST(keyword_import)
+{
+    TEST_EXPECT(
+        string("import") ==
+            token_to_description(HOMESIM_TOKEN_KEYWORD_IMPORT));
+}
+
 TEST(keyword_module)
 {
     TEST_EXPECT(
@@ -157,6 +164,13 @@ TEST(keyword_pullup)
             token_to_description(HOMESIM_TOKEN_KEYWORD_PULLUP));
 }
 
+TEST(keyword_repeat)
+{
+    TEST_EXPECT(
+        string("repeat") ==
+            token_to_description(HOMESIM_TOKEN_KEYWORD_REPEAT));
+}
+
 TEST(keyword_scenario)
 {
     TEST_EXPECT(
@@ -5,6 +5,7 @@
  *
  * \copyright Copyright 2020 Justin Handville. All rights reserved.
  */
+#include <homesim/agenda.h>
 #include <homesim/wire.h>
 #include <memory>
 #include <minunit/minunit.h>
@@ -375,3 +376,74 @@ TEST(capture_output_fault)
     /* no more faults occur. */
     TEST_EXPECT(1 == faults);
 }
+
+/**
+ * A wire owner removes the actions and connections added on its behalf, and
+ * leaves the rest alone.
+ */
+TEST(owner_detach)
+{
+    auto w = make_shared<wire>();
+    wire_owner owner;
+    int owned = 0, unowned = 0;
+
+    w->add_action([&]() { ++unowned; });
+    {
+        wire_owner::scope s(&owner);
+        w->add_action([&]() { ++owned; });
+        w->add_connection(WIRE_CONNECTION_TYPE_OUTPUT);
+    }
+    w->add_connection(WIRE_CONNECTION_TYPE_INPUT);
+
+    TEST_ASSERT(nullptr == wire_owner::current());
+    TEST_EXPECT(1 == w->get_outputs());
+
+    w->set_signal(true);
+    TEST_EXPECT(2 == owned);
+    TEST_EXPECT(2 == unowned);
+
+    owner.detach();
+    TEST_EXPECT(0 == w->get_outputs());
+    TEST_EXPECT(1 == w->get_inputs());
+    TEST_EXPECT(w->is_floating());
+
+    w->set_signal(false);
+    TEST_EXPECT(2 == owned);
+    TEST_EXPECT(3 == unowned);
+}
+
+/**
+ * Connection changes made later by an owned action, or by an event that it
+ * schedules, are recorded for the same owner.
+ */
+TEST(owner_later_changes)
+{
+    auto control = make_shared<wire>();
+    auto out = make_shared<wire>();
+    wire_owner owner;
+
+    global_agenda.clear();
+    {
+        wire_owner::scope s(&owner);
+        out->add_connection(WIRE_CONNECTION_TYPE_HIGH_Z);
+        control->add_action([=]() {
+            if (!control->get_signal())
+                return;
+
+            global_agenda.add(1e-9, [=]() {
+                out->change_connection_type(
+                    WIRE_CONNECTION_TYPE_HIGH_Z,
+                    WIRE_CONNECTION_TYPE_OUTPUT, true);
+            });
+        });
+    }
+
+    control->set_signal(true);
+    propagate();
+    TEST_EXPECT(1 == out->get_outputs());
+    TEST_EXPECT(0 == out->get_high_zs());
+
+    owner.detach();
+    TEST_EXPECT(0 == out->get_outputs());
+    TEST_EXPECT(0 == out->get_high_zs());
+}